@@ -59,7 +59,9 @@ enum _dcp_hash_digest_len
 
 enum _dcp_work_packet_bit_definitions
 {
+    kDCP_CONTROL0_INTERRUPT          = 1u << 0,  /* INTERRUPT */
     kDCP_CONTROL0_DECR_SEMAPHOR      = 1u << 1,  /* DECR_SEMAPHOR */
+    kDCP_CONTROL0_CHAIN              = 1u << 2,  /* CHAIN */
     kDCP_CONTROL0_ENABLE_HASH        = 1u << 6,  /* ENABLE_HASH */
     kDCP_CONTROL0_HASH_INIT          = 1u << 12, /* HASH_INIT */
     kDCP_CONTROL0_HASH_TERM          = 1u << 13, /* HASH_TERM */
@@ -1343,3 +1345,552 @@ status_t DCP_HASH(DCP_Type *base,
 
     return status;
 }
+
+static void dcp_job_reset(dcp_job_queue_t *queue)
+{
+    queue->packetUsed = 0;
+    memset(queue->head, 0, sizeof(queue->head));
+    memset(queue->tail, 0, sizeof(queue->tail));
+    memset(queue->count, 0, sizeof(queue->count));
+}
+
+static void dcp_job_append(dcp_job_queue_t *queue, uint32_t ch, dcp_job_packet_t *jobPacket)
+{
+    jobPacket->packet.nextCmdAddress = 0;
+    jobPacket->packet.status         = 0;
+
+    if (queue->tail[ch])
+    {
+        /* chain the packet behind the last one of the channel */
+        queue->tail[ch]->packet.nextCmdAddress = (uint32_t)&jobPacket->packet;
+        queue->tail[ch]->packet.control0 |= kDCP_CONTROL0_CHAIN;
+    }
+    else
+    {
+        queue->head[ch] = jobPacket;
+    }
+    queue->tail[ch] = jobPacket;
+    queue->count[ch]++;
+}
+
+static uint32_t dcp_job_channel_num(uint8_t channelMask)
+{
+    uint32_t num = 0;
+
+    for (uint32_t ch = 0; ch < 4u; ch++)
+    {
+        if (channelMask & (1u << ch))
+        {
+            num++;
+        }
+    }
+
+    return num;
+}
+
+static uint32_t *dcp_job_set_key(dcp_handle_t *handle, dcp_job_packet_t *jobPacket)
+{
+    uint32_t *iv = &jobPacket->payload[0];
+
+    /* payload is the iv, or the key followed by the iv for the payload key */
+    jobPacket->packet.payloadPointer = (uint32_t)&jobPacket->payload[0];
+
+    if (handle->keySlot == kDCP_OtpKey)
+    {
+        jobPacket->packet.control0 |= (1u << 10);   /* OTP_KEY */
+        jobPacket->packet.control1 |= (0xFFu << 8); /* KEY_SELECT = OTP_KEY */
+    }
+    else if (handle->keySlot == kDCP_OtpUniqueKey)
+    {
+        jobPacket->packet.control0 |= (1u << 10);   /* OTP_KEY */
+        jobPacket->packet.control1 |= (0xFEu << 8); /* KEY_SELECT = UNIQUE_KEY */
+    }
+    else if (handle->keySlot == kDCP_PayloadKey)
+    {
+        dcp_memcpy(&jobPacket->payload[0], handle->keyWord, 16);
+        iv = &jobPacket->payload[4];
+        jobPacket->packet.control0 |= (1u << 11); /* PAYLOAD_KEY */
+    }
+    else
+    {
+        jobPacket->packet.control1 |= ((uint32_t)handle->keySlot << 8); /* KEY_SELECT = keySlot */
+    }
+
+    return iv;
+}
+
+static void dcp_job_start_channel(DCP_Type *base, uint32_t ch, dcp_job_packet_t *jobPacket, uint32_t count)
+{
+    volatile uint32_t *cmdptr = NULL;
+    volatile uint32_t *chsema = NULL;
+
+    switch (ch)
+    {
+        case 0:
+            cmdptr = &base->CH0CMDPTR;
+            chsema = &base->CH0SEMA;
+            break;
+
+        case 1:
+            cmdptr = &base->CH1CMDPTR;
+            chsema = &base->CH1SEMA;
+            break;
+
+        case 2:
+            cmdptr = &base->CH2CMDPTR;
+            chsema = &base->CH2SEMA;
+            break;
+
+        case 3:
+            cmdptr = &base->CH3CMDPTR;
+            chsema = &base->CH3SEMA;
+            break;
+
+        default:
+            break;
+    }
+
+    if (cmdptr && chsema)
+    {
+        /* set the head of the chain to DCP CMDPTR */
+        *cmdptr = (uint32_t)&jobPacket->packet;
+
+        /* Make sure that all data memory accesses are completed before starting of the job */
+        __DSB();
+        __ISB();
+
+        /* each packet of the chain decrements the semaphore once */
+        *chsema = count;
+    }
+}
+
+/*!
+ * brief Initializes the DCP job queue.
+ *
+ * The queue builds chains of work packets in the packet pool, one chain per DCP channel, and starts
+ * all chains of a batch at once. The completion of the batch is signaled by the DCP channel interrupt,
+ * DCP_JOB_IRQHandler() must be called from the DCP interrupt handler. The channels must be enabled by
+ * DCP_Init() and must not be used by the other functions while the queue is busy.
+ *
+ * param base DCP peripheral base address.
+ * param queue Pointer to the queue structure.
+ * param packets Packet pool, 4 bytes aligned. It must stay valid while the queue is used.
+ * param packetNum Number of packets in the pool.
+ * param channelMask Channels used by the queue, OR'ed kDCP_ch0Enable to kDCP_ch3Enable.
+ * param callback Callback function called when all jobs of the batch are done.
+ * param userData Callback function parameter.
+ */
+void DCP_JOB_CreateQueue(DCP_Type *base,
+                         dcp_job_queue_t *queue,
+                         dcp_job_packet_t *packets,
+                         uint32_t packetNum,
+                         uint8_t channelMask,
+                         dcp_job_callback_t callback,
+                         void *userData)
+{
+    assert(queue);
+    assert(packets);
+    assert((channelMask != 0u) && ((channelMask & ~(uint8_t)kDCP_chEnableAll) == 0u));
+
+    memset(queue, 0, sizeof(*queue));
+
+    queue->base        = base;
+    queue->packets     = packets;
+    queue->packetNum   = packetNum;
+    queue->channelMask = channelMask;
+    queue->callback    = callback;
+    queue->userData    = userData;
+}
+
+/*!
+ * brief Adds AES CBC sectors to the batch.
+ *
+ * Each sector is one CBC work packet with its own IV, and the sectors are spread across the channels
+ * of the queue. For kDCP_SectorIvEssiv one more AES ECB work packet computes the IV of the sector
+ * right before it on the same channel. Only 128-bit keys are supported, as by DCP_AES_SetKey().
+ *
+ * param queue Pointer to the queue structure.
+ * param job AES sector job. The structure can be released after the call, the buffers must stay
+ *            valid until the callback is called.
+ * retval kStatus_Success The sectors are added to the batch.
+ * retval kStatus_InvalidArgument The sector size is not a multiple of 16 bytes.
+ * retval kStatus_OutOfRange The packet pool or a channel chain is full.
+ * retval kStatus_DCP_Again The queue is processing the previous batch.
+ */
+status_t DCP_JOB_AddAesSectors(dcp_job_queue_t *queue, const dcp_aes_sector_job_t *job)
+{
+    assert(queue);
+    assert(job);
+
+    uint32_t packetsPerSector = (job->ivMode == kDCP_SectorIvEssiv) ? 2u : 1u;
+    uint32_t channelNum       = dcp_job_channel_num(queue->channelMask);
+    uint32_t perChannel;
+    dcp_job_packet_t *ivPacket;
+    dcp_job_packet_t *dataPacket;
+    uint32_t *iv;
+    uint64_t sector;
+    uint32_t ch;
+
+    /* Size must be 16-byte multiple */
+    if ((job->sectorSize < 16u) || (job->sectorSize % 16u) ||
+        ((job->ivMode == kDCP_SectorIvEssiv) && (job->ivHandle == NULL)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (queue->busyChannels)
+    {
+        return kStatus_DCP_Again;
+    }
+
+    /* check the pool and the chains before any packet is taken */
+    if ((queue->packetNum - queue->packetUsed) < (job->sectorCount * packetsPerSector))
+    {
+        return kStatus_OutOfRange;
+    }
+    perChannel = ((job->sectorCount + channelNum - 1u) / channelNum) * packetsPerSector;
+    for (ch = 0; ch < 4u; ch++)
+    {
+        if ((queue->channelMask & (1u << ch)) && ((queue->count[ch] + perChannel) > DCP_JOB_MAX_CHANNEL_PACKETS))
+        {
+            return kStatus_OutOfRange;
+        }
+    }
+
+    for (uint32_t i = 0; i < job->sectorCount; i++)
+    {
+        /* next channel of the queue, round robin */
+        ch = queue->nextChannel;
+        while ((queue->channelMask & (1u << ch)) == 0u)
+        {
+            ch = (ch + 1u) & 3u;
+        }
+        queue->nextChannel = (ch + 1u) & 3u;
+
+        ivPacket = NULL;
+        if (job->ivMode == kDCP_SectorIvEssiv)
+        {
+            ivPacket = &queue->packets[queue->packetUsed++];
+        }
+        dataPacket = &queue->packets[queue->packetUsed++];
+
+        /* CIPHER_INIT | ENABLE_CIPHER | DECR_SEMAPHORE, and CIPHER_ENCRYPT for encryption */
+        dataPacket->output          = NULL;
+        dataPacket->packet.control0 = (job->encrypt ? 0x322u : 0x222u) | (job->handle->swapConfig & 0xFC0000u);
+        dataPacket->packet.control1 = 0x10u; /* CBC */
+        dataPacket->packet.sourceBufferAddress      = (uint32_t)&job->input[i * job->sectorSize];
+        dataPacket->packet.destinationBufferAddress = (uint32_t)&job->output[i * job->sectorSize];
+        dataPacket->packet.bufferSize               = (uint32_t)job->sectorSize;
+        iv                                          = dcp_job_set_key(job->handle, dataPacket);
+
+        /* plain64 IV, the sector number in little endian */
+        sector = job->firstSector + i;
+        iv[0]  = (uint32_t)sector;
+        iv[1]  = (uint32_t)(sector >> 32);
+        iv[2]  = 0;
+        iv[3]  = 0;
+
+        if (ivPacket)
+        {
+            /* encrypt the IV in place by AES ECB, before the sector on the same channel */
+            ivPacket->output = NULL;
+            ivPacket->packet.control0 =
+                0x122u | (job->ivHandle->swapConfig & 0xFC0000u); /* CIPHER_ENCRYPT | ENABLE_CIPHER | DECR_SEMAPHORE */
+            ivPacket->packet.control1                 = 0x0u;     /* ECB */
+            ivPacket->packet.sourceBufferAddress      = (uint32_t)iv;
+            ivPacket->packet.destinationBufferAddress = (uint32_t)iv;
+            ivPacket->packet.bufferSize               = 16u;
+            (void)dcp_job_set_key(job->ivHandle, ivPacket);
+            dcp_job_append(queue, ch, ivPacket);
+        }
+        dcp_job_append(queue, ch, dataPacket);
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Adds a HASH over a scatter-gather list to the batch.
+ *
+ * Each buffer is one work packet, the packets are chained on the least loaded channel of the queue.
+ * The digest is written to output when the batch is done.
+ *
+ * param queue Pointer to the queue structure.
+ * param algo Underlaying algorithm to use for hash computation.
+ * param buffers Scatter-gather list. All buffers but the last must be multiple of 64 bytes. The list
+ *                can be released after the call, the data must stay valid until the callback is called.
+ * param bufferNum Number of buffers in the list.
+ * param[out] output Output hash data
+ * param[in,out] outputSize Optional parameter (can be passed as NULL). On function entry, it specifies the size of
+ * output[] buffer. On function return, it stores the number of bytes to be written.
+ * retval kStatus_Success The hash is added to the batch.
+ * retval kStatus_InvalidArgument The algorithm or the buffer sizes are not valid.
+ * retval kStatus_OutOfRange The packet pool or the channel chain is full.
+ * retval kStatus_DCP_Again The queue is processing the previous batch.
+ */
+status_t DCP_JOB_AddHash(dcp_job_queue_t *queue,
+                         dcp_hash_algo_t algo,
+                         const dcp_buffer_t *buffers,
+                         size_t bufferNum,
+                         uint8_t *output,
+                         size_t *outputSize)
+{
+    assert(queue);
+    assert(buffers || (bufferNum == 0u));
+    assert(output);
+
+    dcp_job_packet_t *jobPacket = NULL;
+    uint32_t control1;
+    size_t outSize;
+    size_t messageSize = 0u;
+    uint32_t ch        = 4u;
+
+    /* compute algorithm output length */
+    switch (algo)
+    {
+        case kDCP_Sha256:
+            outSize  = kDCP_OutLenSha256;
+            control1 = kDCP_CONTROL1_HASH_SELECT_SHA256;
+            break;
+        case kDCP_Sha1:
+            outSize  = kDCP_OutLenSha1;
+            control1 = kDCP_CONTROL1_HASH_SELECT_SHA1;
+            break;
+        case kDCP_Crc32:
+            outSize  = kDCP_OutLenCrc32;
+            control1 = kDCP_CONTROL1_HASH_SELECT_CRC32;
+            break;
+        default:
+            return kStatus_InvalidArgument;
+    }
+
+    for (size_t i = 0; i < bufferNum; i++)
+    {
+        if (((i + 1u) < bufferNum) && (buffers[i].size % 64u))
+        {
+            return kStatus_InvalidArgument;
+        }
+        messageSize += buffers[i].size;
+    }
+
+    if (queue->busyChannels)
+    {
+        return kStatus_DCP_Again;
+    }
+
+    if (outputSize)
+    {
+        if (outSize < *outputSize)
+        {
+            *outputSize = outSize;
+        }
+        else
+        {
+            outSize = *outputSize;
+        }
+    }
+
+#if defined(DCP_HASH_CAVP_COMPATIBLE)
+    if (messageSize == 0u)
+    {
+        switch (algo)
+        {
+            case kDCP_Sha256:
+                dcp_memcpy(&output[0], &s_nullSha256, outSize);
+                break;
+            case kDCP_Sha1:
+                dcp_memcpy(&output[0], &s_nullSha1, outSize);
+                break;
+            default:
+                break;
+        }
+
+        return kStatus_Success;
+    }
+#endif /* DCP_HASH_CAVP_COMPATIBLE */
+
+    if (bufferNum == 0u)
+    {
+        bufferNum = 1u;
+        buffers   = NULL;
+    }
+
+    /* the whole hash is one chain, on the least loaded channel */
+    for (uint32_t i = 0; i < 4u; i++)
+    {
+        if ((queue->channelMask & (1u << i)) && ((ch == 4u) || (queue->count[i] < queue->count[ch])))
+        {
+            ch = i;
+        }
+    }
+    if (((queue->packetNum - queue->packetUsed) < bufferNum) ||
+        ((queue->count[ch] + bufferNum) > DCP_JOB_MAX_CHANNEL_PACKETS))
+    {
+        return kStatus_OutOfRange;
+    }
+
+    for (size_t i = 0; i < bufferNum; i++)
+    {
+        jobPacket = &queue->packets[queue->packetUsed++];
+
+        jobPacket->output                          = NULL;
+        jobPacket->packet.control0                 = kDCP_CONTROL0_ENABLE_HASH | kDCP_CONTROL0_DECR_SEMAPHOR;
+        jobPacket->packet.control1                 = control1;
+        jobPacket->packet.sourceBufferAddress      = buffers ? (uint32_t)buffers[i].data : 0u;
+        jobPacket->packet.destinationBufferAddress = 0;
+        jobPacket->packet.bufferSize               = buffers ? buffers[i].size : 0u;
+        jobPacket->packet.payloadPointer           = (uint32_t)&jobPacket->payload[0];
+        if (i == 0u)
+        {
+            jobPacket->packet.control0 |= kDCP_CONTROL0_HASH_INIT;
+        }
+        dcp_job_append(queue, ch, jobPacket);
+    }
+
+    /* the digest is written to the payload of the last packet */
+    jobPacket->packet.control0 |= kDCP_CONTROL0_HASH_TERM;
+    jobPacket->output     = output;
+    jobPacket->outputSize = outSize;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Starts the batch.
+ *
+ * The chain of each channel is started with one semaphore count per work packet. The callback is
+ * called from DCP_JOB_IRQHandler() when all channels are done, then new jobs can be added.
+ * If the batch is empty, the callback is called in this function.
+ *
+ * note The work packets, the buffers and the keys are read by DCP, the cache maintenance is the
+ *       responsibility of the application.
+ *
+ * param queue Pointer to the queue structure.
+ * retval kStatus_Success The batch is started.
+ * retval kStatus_DCP_Again The queue or one of its channels is busy.
+ */
+status_t DCP_JOB_Submit(dcp_job_queue_t *queue)
+{
+    assert(queue);
+
+    DCP_Type *base                   = queue->base;
+    volatile uint32_t *dcpStatClrPtr = &base->STAT + 2u;
+    uint8_t batchChannels            = 0u;
+
+    if (queue->busyChannels)
+    {
+        return kStatus_DCP_Again;
+    }
+
+    for (uint32_t ch = 0; ch < 4u; ch++)
+    {
+        if (queue->count[ch])
+        {
+            batchChannels |= (uint8_t)(1u << ch);
+        }
+    }
+
+    if (batchChannels == 0u)
+    {
+        if (queue->callback)
+        {
+            queue->callback(base, queue, kStatus_Success, queue->userData);
+        }
+        return kStatus_Success;
+    }
+
+    /* check if our channels are active */
+    if (base->STAT & DCP_STAT_READY_CHANNELS(batchChannels))
+    {
+        return kStatus_DCP_Again;
+    }
+
+    queue->status       = kStatus_Success;
+    queue->busyChannels = batchChannels;
+
+    for (uint32_t ch = 0; ch < 4u; ch++)
+    {
+        if (queue->count[ch])
+        {
+            /* interrupt at the end of the chain */
+            queue->tail[ch]->packet.control0 |= kDCP_CONTROL0_INTERRUPT;
+        }
+    }
+
+    /* clear the interrupts left by previous operations, then enable the interrupts of the batch */
+    *dcpStatClrPtr = batchChannels;
+    base->CTRL |= DCP_CTRL_CHANNEL_INTERRUPT_ENABLE(batchChannels);
+
+    for (uint32_t ch = 0; ch < 4u; ch++)
+    {
+        if (queue->count[ch])
+        {
+            dcp_job_start_channel(base, ch, queue->head[ch], queue->count[ch]);
+        }
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief DCP job queue interrupt handler.
+ *
+ * Clears the interrupt of the channels done, and calls the callback when the whole batch is done.
+ * The status is kStatus_Fail if a channel reported an error.
+ *
+ * param base DCP peripheral base address.
+ * param queue Pointer to the queue structure.
+ */
+void DCP_JOB_IRQHandler(DCP_Type *base, dcp_job_queue_t *queue)
+{
+    assert(queue);
+
+    volatile uint32_t *dcpStatClrPtr = &base->STAT + 2u;
+    uint32_t irq                     = base->STAT & DCP_STAT_IRQ_MASK & queue->busyChannels;
+
+    if (irq == 0u)
+    {
+        return;
+    }
+
+    for (uint32_t ch = 0; ch < 4u; ch++)
+    {
+        if (irq & (1u << ch))
+        {
+            if (dcp_get_channel_status(base, (dcp_channel_t)((uint32_t)kDCP_Channel0 << ch)) != kStatus_Success)
+            {
+                dcp_clear_channel_status(base, (uint32_t)kDCP_Channel0 << ch);
+                queue->status = kStatus_Fail;
+            }
+        }
+    }
+
+    /* clear the interrupt of the channels done */
+    *dcpStatClrPtr = irq;
+    queue->busyChannels &= (uint8_t)~irq;
+
+    if (queue->busyChannels == 0u)
+    {
+        base->CTRL &= ~DCP_CTRL_CHANNEL_INTERRUPT_ENABLE(queue->channelMask);
+
+        if (queue->status == kStatus_Success)
+        {
+            for (uint32_t i = 0; i < queue->packetUsed; i++)
+            {
+                if (queue->packets[i].output)
+                {
+                    /* Reverse and copy result to output[] */
+                    dcp_reverse_and_copy((uint8_t *)queue->packets[i].payload, queue->packets[i].output,
+                                         queue->packets[i].outputSize);
+                }
+            }
+        }
+
+        dcp_job_reset(queue);
+
+        if (queue->callback)
+        {
+            queue->callback(base, queue, queue->status, queue->userData);
+        }
+    }
+}
@@ -27,11 +27,14 @@ enum _dcp_status
  */
 /*! @name Driver version */
 /*@{*/
-/*! @brief DCP driver version. Version 2.1.1.
+/*! @brief DCP driver version. Version 2.1.2.
  *
- * Current version: 2.1.1
+ * Current version: 2.1.2
  *
  * Change log:
+ * - Version 2.1.2
+ *   - Add job queue of chained work packets for AES CBC sectors and scatter-gather HASH
+ *
  * - Version 2.1.1
  *   - Add DCP status clearing when channel operation is complete
  *
@@ -41,7 +44,7 @@ enum _dcp_status
  * - Version 2.0.0
  *   - Initial version
  */
-#define FSL_DCP_DRIVER_VERSION (MAKE_VERSION(2, 1, 1))
+#define FSL_DCP_DRIVER_VERSION (MAKE_VERSION(2, 1, 2))
 /*@}*/
 
 /*! @brief DCP channel enable.
@@ -203,6 +206,82 @@ typedef struct _dcp_hash_ctx_t
  *@}
  */ /* end of dcp_driver_hash */
 
+/*******************************************************************************
+ * Job queue Definitions
+ ******************************************************************************/
+/*!
+ * @addtogroup dcp_driver_job
+ * @{
+ */
+
+/*! @brief Maximum number of work packets chained on one DCP channel in one batch. */
+#define DCP_JOB_MAX_CHANNEL_PACKETS 255U
+
+/*! @brief IV derivation of the AES CBC sectors. */
+typedef enum _dcp_sector_iv
+{
+    kDCP_SectorIvPlain64 = 0U, /*!< IV is the 64-bit little endian sector number padded with zeros. */
+    kDCP_SectorIvEssiv   = 1U, /*!< IV is the plain64 IV encrypted by AES ECB with the IV key. */
+} dcp_sector_iv_t;
+
+/*! @brief Buffer of a scatter-gather list. */
+typedef struct _dcp_buffer
+{
+    const uint8_t *data; /*!< Data. */
+    size_t size;         /*!< Size of data in bytes. */
+} dcp_buffer_t;
+
+/*! @brief AES CBC operation on consecutive sectors, each sector with its own IV. */
+typedef struct _dcp_aes_sector_job
+{
+    dcp_handle_t *handle;   /*!< Key slot and swap options of the sector data. The channel is selected by the queue. */
+    dcp_handle_t *ivHandle; /*!< Key slot of the IV for kDCP_SectorIvEssiv, not used for kDCP_SectorIvPlain64. */
+    dcp_sector_iv_t ivMode; /*!< IV derivation. */
+    bool encrypt;           /*!< True to encrypt, false to decrypt. */
+    const uint8_t *input;   /*!< Input of the first sector, sectors are consecutive in memory. */
+    uint8_t *output;        /*!< Output of the first sector, sectors are consecutive in memory. */
+    size_t sectorSize;      /*!< Size of one sector in bytes. Must be multiple of 16 bytes. */
+    uint32_t sectorCount;   /*!< Number of sectors. */
+    uint64_t firstSector;   /*!< Sector number of the first sector, used for the IV. */
+} dcp_aes_sector_job_t;
+
+/*! @brief Job queue packet, the work packet with its payload. */
+typedef struct _dcp_job_packet
+{
+    dcp_work_packet_t packet; /*!< Work packet read by DCP. */
+    uint32_t payload[8];      /*!< Key and IV, or the hash digest. */
+    uint8_t *output;          /*!< Digest output, set on the last packet of a hash job. */
+    size_t outputSize;        /*!< Size of the digest output in bytes. */
+} dcp_job_packet_t;
+
+/* Forward declaration of the queue typedef. */
+typedef struct _dcp_job_queue dcp_job_queue_t;
+
+/*! @brief Job queue callback, called when all jobs of the batch are done. */
+typedef void (*dcp_job_callback_t)(DCP_Type *base, dcp_job_queue_t *queue, status_t status, void *userData);
+
+/*! @brief Job queue, chains of work packets on up to four DCP channels. */
+struct _dcp_job_queue
+{
+    DCP_Type *base;                /*!< DCP peripheral base address. */
+    dcp_job_packet_t *packets;     /*!< Packet pool. */
+    uint32_t packetNum;            /*!< Number of packets in the pool. */
+    uint32_t packetUsed;           /*!< Number of packets used by the batch. */
+    uint8_t channelMask;           /*!< Channels used by the queue, see _dcp_ch_enable_t. */
+    uint8_t nextChannel;           /*!< Channel of the next AES sector. */
+    volatile uint8_t busyChannels; /*!< Channels still processing the batch. */
+    dcp_job_packet_t *head[4];     /*!< First packet of each channel chain. */
+    dcp_job_packet_t *tail[4];     /*!< Last packet of each channel chain. */
+    uint32_t count[4];             /*!< Number of packets of each channel chain. */
+    status_t status;               /*!< Status of the batch. */
+    dcp_job_callback_t callback;   /*!< Callback function. */
+    void *userData;                /*!< Callback function parameter. */
+};
+
+/*!
+ *@}
+ */ /* end of dcp_driver_job */
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -545,6 +624,113 @@ status_t DCP_HASH(DCP_Type *base,
  *@}
  */ /* end of dcp_driver_hash */
 
+/*******************************************************************************
+ * Job queue API
+ ******************************************************************************/
+
+/*!
+ * @addtogroup dcp_driver_job
+ * @{
+ */
+
+/*!
+ * @brief Initializes the DCP job queue.
+ *
+ * The queue builds chains of work packets in the packet pool, one chain per DCP channel, and starts
+ * all chains of a batch at once. The completion of the batch is signaled by the DCP channel interrupt,
+ * DCP_JOB_IRQHandler() must be called from the DCP interrupt handler. The channels must be enabled by
+ * DCP_Init() and must not be used by the other functions while the queue is busy.
+ *
+ * @param base DCP peripheral base address.
+ * @param queue Pointer to the queue structure.
+ * @param packets Packet pool, 4 bytes aligned. It must stay valid while the queue is used.
+ * @param packetNum Number of packets in the pool.
+ * @param channelMask Channels used by the queue, OR'ed kDCP_ch0Enable to kDCP_ch3Enable.
+ * @param callback Callback function called when all jobs of the batch are done.
+ * @param userData Callback function parameter.
+ */
+void DCP_JOB_CreateQueue(DCP_Type *base,
+                         dcp_job_queue_t *queue,
+                         dcp_job_packet_t *packets,
+                         uint32_t packetNum,
+                         uint8_t channelMask,
+                         dcp_job_callback_t callback,
+                         void *userData);
+
+/*!
+ * @brief Adds AES CBC sectors to the batch.
+ *
+ * Each sector is one CBC work packet with its own IV, and the sectors are spread across the channels
+ * of the queue. For kDCP_SectorIvEssiv one more AES ECB work packet computes the IV of the sector
+ * right before it on the same channel. Only 128-bit keys are supported, as by DCP_AES_SetKey().
+ *
+ * @param queue Pointer to the queue structure.
+ * @param job AES sector job. The structure can be released after the call, the buffers must stay
+ *            valid until the callback is called.
+ * @retval kStatus_Success The sectors are added to the batch.
+ * @retval kStatus_InvalidArgument The sector size is not a multiple of 16 bytes.
+ * @retval kStatus_OutOfRange The packet pool or a channel chain is full.
+ * @retval kStatus_DCP_Again The queue is processing the previous batch.
+ */
+status_t DCP_JOB_AddAesSectors(dcp_job_queue_t *queue, const dcp_aes_sector_job_t *job);
+
+/*!
+ * @brief Adds a HASH over a scatter-gather list to the batch.
+ *
+ * Each buffer is one work packet, the packets are chained on the least loaded channel of the queue.
+ * The digest is written to output when the batch is done.
+ *
+ * @param queue Pointer to the queue structure.
+ * @param algo Underlaying algorithm to use for hash computation.
+ * @param buffers Scatter-gather list. All buffers but the last must be multiple of 64 bytes. The list
+ *                can be released after the call, the data must stay valid until the callback is called.
+ * @param bufferNum Number of buffers in the list.
+ * @param[out] output Output hash data
+ * @param[in,out] outputSize Optional parameter (can be passed as NULL). On function entry, it specifies the size of
+ * output[] buffer. On function return, it stores the number of bytes to be written.
+ * @retval kStatus_Success The hash is added to the batch.
+ * @retval kStatus_InvalidArgument The algorithm or the buffer sizes are not valid.
+ * @retval kStatus_OutOfRange The packet pool or the channel chain is full.
+ * @retval kStatus_DCP_Again The queue is processing the previous batch.
+ */
+status_t DCP_JOB_AddHash(dcp_job_queue_t *queue,
+                         dcp_hash_algo_t algo,
+                         const dcp_buffer_t *buffers,
+                         size_t bufferNum,
+                         uint8_t *output,
+                         size_t *outputSize);
+
+/*!
+ * @brief Starts the batch.
+ *
+ * The chain of each channel is started with one semaphore count per work packet. The callback is
+ * called from DCP_JOB_IRQHandler() when all channels are done, then new jobs can be added.
+ * If the batch is empty, the callback is called in this function.
+ *
+ * @note The work packets, the buffers and the keys are read by DCP, the cache maintenance is the
+ *       responsibility of the application.
+ *
+ * @param queue Pointer to the queue structure.
+ * @retval kStatus_Success The batch is started.
+ * @retval kStatus_DCP_Again The queue or one of its channels is busy.
+ */
+status_t DCP_JOB_Submit(dcp_job_queue_t *queue);
+
+/*!
+ * @brief DCP job queue interrupt handler.
+ *
+ * Clears the interrupt of the channels done, and calls the callback when the whole batch is done.
+ * The status is kStatus_Fail if a channel reported an error.
+ *
+ * @param base DCP peripheral base address.
+ * @param queue Pointer to the queue structure.
+ */
+void DCP_JOB_IRQHandler(DCP_Type *base, dcp_job_queue_t *queue);
+
+/*!
+ *@}
+ */ /* end of dcp_driver_job */
+
 #if defined(__cplusplus)
 }
 #endif
@@ -18,6 +18,8 @@
 #endif
 
 #define EDMA_TRANSFER_ENABLED_MASK 0x80U
+/* Maximum major loop count with the minor loop channel link enabled. */
+#define EDMA_MEMCPY_MAX_MAJOR_COUNT (DMA_CITER_ELINKYES_CITER_MASK >> DMA_CITER_ELINKYES_CITER_SHIFT)
 
 /*******************************************************************************
  * Prototypes
@@ -30,6 +32,68 @@
  */
 static uint32_t EDMA_GetInstance(DMA_Type *base);
 
+/*!
+ * @brief Links the TCDs just configured in the TCD pool to the live chain.
+ *
+ * The TCDs from firstTcd to lastTcd have been configured and chained to each other. This function links
+ * them behind the previous TCD, or installs the first one into the TCD registers when there is no live chain.
+ *
+ * @param handle eDMA handle pointer.
+ * @param firstTcd Index of the first configured TCD in the TCD pool.
+ * @param lastTcd Index of the last configured TCD in the TCD pool.
+ */
+static void EDMA_LinkTcdChain(edma_handle_t *handle, int8_t firstTcd, int8_t lastTcd);
+
+/*!
+ * @brief Gets the widest transfer size in bytes allowed by the address alignment.
+ *
+ * @param addr The source or destination address.
+ */
+static uint32_t EDMA_GetMemcpyWidth(uint32_t addr);
+
+/*!
+ * @brief Starts one channel of the memory copy job.
+ *
+ * @param handle eDMA memory copy handle pointer.
+ * @param index Index of the channel in the memory copy handle.
+ * @param srcAddr Source address.
+ * @param srcWidth Source transfer size in bytes.
+ * @param destAddr Destination address.
+ * @param destWidth Destination transfer size in bytes.
+ * @param size Number of bytes to copy, it is a multiple of the larger transfer size.
+ * @param srcIncrease Whether the source address is incremented, false for the memory set.
+ */
+static void EDMA_StartMemcpyChannel(edma_memcpy_handle_t *handle,
+                                    uint32_t index,
+                                    uint32_t srcAddr,
+                                    uint32_t srcWidth,
+                                    uint32_t destAddr,
+                                    uint32_t destWidth,
+                                    uint32_t size,
+                                    bool srcIncrease);
+
+/*!
+ * @brief Starts the memory copy or memory set job.
+ *
+ * @param handle eDMA memory copy handle pointer.
+ * @param destAddr Destination address.
+ * @param srcAddr Source address.
+ * @param size Number of bytes to copy.
+ * @param srcIncrease Whether the source address is incremented, false for the memory set.
+ */
+static status_t EDMA_StartMemcpy(
+    edma_memcpy_handle_t *handle, uint32_t destAddr, uint32_t srcAddr, uint32_t size, bool srcIncrease);
+
+/*!
+ * @brief eDMA callback of the channels used by the memory copy handle.
+ *
+ * @param handle eDMA handle pointer.
+ * @param userData The eDMA memory copy handle pointer.
+ * @param transferDone If the transfer of the channel is done.
+ * @param tcds Not used.
+ */
+static void EDMA_MemcpyCallback(edma_handle_t *handle, void *userData, bool transferDone, uint32_t tcds);
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -985,6 +1049,91 @@ void EDMA_PrepareTransfer(edma_transfer_config_t *config,
     }
 }
 
+static void EDMA_LinkTcdChain(edma_handle_t *handle, int8_t firstTcd, int8_t lastTcd)
+{
+    edma_tcd_t *tcdRegs = (edma_tcd_t *)(uint32_t)&handle->base->TCD[handle->channel];
+    int8_t previousTcd;
+    uint16_t csr;
+
+    /* Calculate index of previous TCD */
+    previousTcd = firstTcd != 0 ? firstTcd - 1 : (handle->tcdSize - 1);
+    /* Chain from previous descriptor unless tcd pool size is 1(this descriptor is its own predecessor). */
+    if (firstTcd != previousTcd)
+    {
+        /*
+            Enable scatter/gather feature in the previous TCD block, unless the chain takes the whole
+            tcd pool and the previous TCD block is the last one of the chain.
+        */
+        if (lastTcd != previousTcd)
+        {
+            csr = (uint16_t)((handle->tcdPool[previousTcd].CSR | DMA_CSR_ESG_MASK) & ~DMA_CSR_DREQ_MASK);
+            handle->tcdPool[previousTcd].CSR = csr;
+        }
+        /*
+            Check if the TCD block in the registers is the previous one (points to current TCD block). It
+            is used to check if the previous TCD linked has been loaded in TCD register. If so, it need to
+            link the TCD register in case link the current TCD with the dead chain when TCD loading occurs
+            before link the previous TCD block.
+        */
+        if (tcdRegs->DLAST_SGA == (uint32_t)&handle->tcdPool[firstTcd])
+        {
+            /* Clear the DREQ bits for the dynamic scatter gather */
+            tcdRegs->CSR |= DMA_CSR_DREQ_MASK;
+            /* Enable scatter/gather also in the TCD registers. */
+            csr = tcdRegs->CSR | DMA_CSR_ESG_MASK;
+            /* Must write the CSR register one-time, because the transfer maybe finished anytime. */
+            tcdRegs->CSR = csr;
+            /*
+                It is very important to check the ESG bit!
+                Because this hardware design: if DONE bit is set, the ESG bit can not be set. So it can
+                be used to check if the dynamic TCD link operation is successful. If ESG bit is not set
+                and the DLAST_SGA is not the current TCD address(it means the dynamic TCD link succeed and
+                the current TCD block has been loaded into TCD registers), it means transfer finished
+                and TCD link operation fail, so must install TCD content into TCD registers and enable
+                transfer again. And if ESG is set, it means transfer has not finished, so TCD dynamic
+                link succeed.
+            */
+            if (0U != (tcdRegs->CSR & DMA_CSR_ESG_MASK))
+            {
+                tcdRegs->CSR &= ~(uint16_t)DMA_CSR_DREQ_MASK;
+                return;
+            }
+            /*
+                Check whether the current TCD block is already loaded in the TCD registers. It is another
+                condition when ESG bit is not set: it means the dynamic TCD link succeed and the current
+                TCD block has been loaded into TCD registers.
+            */
+            if (tcdRegs->DLAST_SGA != (uint32_t)&handle->tcdPool[firstTcd])
+            {
+                return;
+            }
+            /*
+                If go to this, means the previous transfer finished, and the DONE bit is set.
+                So shall configure TCD registers.
+            */
+        }
+        else if (tcdRegs->DLAST_SGA != 0U)
+        {
+            /* The current TCD block has been linked successfully. */
+            return;
+        }
+        else
+        {
+            /*
+                DLAST_SGA is 0 and it means the first submit transfer, so shall configure
+                TCD registers.
+            */
+        }
+    }
+    /* There is no live chain, TCD block need to be installed in TCD registers. */
+    EDMA_InstallTCD(handle->base, handle->channel, &handle->tcdPool[firstTcd]);
+    /* Enable channel request again. */
+    if (0U != (handle->flags & EDMA_TRANSFER_ENABLED_MASK))
+    {
+        handle->base->SERQ = DMA_SERQ_SERQ(handle->channel);
+    }
+}
+
 /*!
  * brief Submits the eDMA transfer request.
  *
@@ -1032,9 +1181,7 @@ status_t EDMA_SubmitTransfer(edma_handle_t *handle, const edma_transfer_config_t
     else /* Use the TCD queue. */
     {
         uint32_t primask;
-        uint16_t csr;
         int8_t currentTcd;
-        int8_t previousTcd;
         int8_t nextTcd;
         int8_t tmpTcdUsed;
         int8_t tmpTcdSize;
@@ -1060,8 +1207,6 @@ status_t EDMA_SubmitTransfer(edma_handle_t *handle, const edma_transfer_config_t
         /* Advance queue tail index */
         handle->tail = nextTcd;
         EnableGlobalIRQ(primask);
-        /* Calculate index of previous TCD */
-        previousTcd = currentTcd != 0 ? currentTcd - 1 : (handle->tcdSize - 1);
         /* Configure current TCD block. */
         EDMA_TcdReset(&handle->tcdPool[currentTcd]);
         EDMA_TcdSetTransferConfig(&handle->tcdPool[currentTcd], config, NULL);
@@ -1069,78 +1214,89 @@ status_t EDMA_SubmitTransfer(edma_handle_t *handle, const edma_transfer_config_t
         handle->tcdPool[currentTcd].CSR |= DMA_CSR_INTMAJOR_MASK;
         /* Link current TCD with next TCD for identification of current TCD */
         handle->tcdPool[currentTcd].DLAST_SGA = (uint32_t)&handle->tcdPool[nextTcd];
-        /* Chain from previous descriptor unless tcd pool size is 1(this descriptor is its own predecessor). */
-        if (currentTcd != previousTcd)
+        /* Link the current TCD behind the previous one. */
+        EDMA_LinkTcdChain(handle, currentTcd, currentTcd);
+
+        return kStatus_Success;
+    }
+}
+
+/*!
+ * brief Submits a batch of eDMA transfer requests.
+ *
+ * This function links all the transfer configurations into the TCD pool in one call. The TCDs are configured
+ * and chained to each other outside the critical section, and the whole chain is linked behind the live chain
+ * only once, so queuing many buffers costs one critical section and one dynamic link instead of one per buffer.
+ * The TCD pool must be installed by EDMA_InstallTCDMemory before. Each TCD generates the major loop interrupt
+ * as the one submitted by EDMA_SubmitTransfer.
+ *
+ * param handle eDMA handle pointer.
+ * param config Pointer to the array of eDMA transfer configuration structures.
+ * param transferNum Number of transfer configurations in the array.
+ * retval kStatus_Success It means submit transfer request succeed.
+ * retval kStatus_EDMA_QueueFull It means there are not enough free TCD slots for the whole batch, no transfer is
+ *        submitted.
+ */
+status_t EDMA_SubmitTransferBatch(edma_handle_t *handle, const edma_transfer_config_t *config, uint32_t transferNum)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+    assert(handle->tcdPool != NULL);
+    assert(transferNum != 0U);
+
+    uint32_t primask;
+    uint32_t i;
+    int8_t firstTcd;
+    int8_t currentTcd;
+    int8_t nextTcd;
+    int8_t tmpTcdUsed;
+    int8_t tmpTcdSize;
+
+    /* Reserve the TCD slots for the whole batch. */
+    primask    = DisableGlobalIRQ();
+    tmpTcdUsed = handle->tcdUsed;
+    tmpTcdSize = handle->tcdSize;
+    if (transferNum > ((uint32_t)tmpTcdSize - (uint32_t)tmpTcdUsed))
+    {
+        EnableGlobalIRQ(primask);
+
+        return kStatus_EDMA_QueueFull;
+    }
+    firstTcd = handle->tail;
+    handle->tcdUsed += (int8_t)transferNum;
+    /* Advance queue tail index */
+    handle->tail = (int8_t)(((uint32_t)firstTcd + transferNum) % (uint32_t)tmpTcdSize);
+    EnableGlobalIRQ(primask);
+
+    /* Configure the TCD blocks and chain them to each other. */
+    currentTcd = firstTcd;
+    for (i = 0U; i < transferNum; i++)
+    {
+        /* Calculate index of next TCD */
+        nextTcd = currentTcd + 1;
+        if (nextTcd == tmpTcdSize)
         {
-            /* Enable scatter/gather feature in the previous TCD block. */
-            csr = (uint16_t)((handle->tcdPool[previousTcd].CSR | DMA_CSR_ESG_MASK) & ~DMA_CSR_DREQ_MASK);
-            handle->tcdPool[previousTcd].CSR = csr;
-            /*
-                Check if the TCD block in the registers is the previous one (points to current TCD block). It
-                is used to check if the previous TCD linked has been loaded in TCD register. If so, it need to
-                link the TCD register in case link the current TCD with the dead chain when TCD loading occurs
-                before link the previous TCD block.
-            */
-            if (tcdRegs->DLAST_SGA == (uint32_t)&handle->tcdPool[currentTcd])
-            {
-                /* Clear the DREQ bits for the dynamic scatter gather */
-                tcdRegs->CSR |= DMA_CSR_DREQ_MASK;
-                /* Enable scatter/gather also in the TCD registers. */
-                csr = tcdRegs->CSR | DMA_CSR_ESG_MASK;
-                /* Must write the CSR register one-time, because the transfer maybe finished anytime. */
-                tcdRegs->CSR = csr;
-                /*
-                    It is very important to check the ESG bit!
-                    Because this hardware design: if DONE bit is set, the ESG bit can not be set. So it can
-                    be used to check if the dynamic TCD link operation is successful. If ESG bit is not set
-                    and the DLAST_SGA is not the next TCD address(it means the dynamic TCD link succeed and
-                    the current TCD block has been loaded into TCD registers), it means transfer finished
-                    and TCD link operation fail, so must install TCD content into TCD registers and enable
-                    transfer again. And if ESG is set, it means transfer has not finished, so TCD dynamic
-                    link succeed.
-                */
-                if (0U != (tcdRegs->CSR & DMA_CSR_ESG_MASK))
-                {
-                    tcdRegs->CSR &= ~(uint16_t)DMA_CSR_DREQ_MASK;
-                    return kStatus_Success;
-                }
-                /*
-                    Check whether the current TCD block is already loaded in the TCD registers. It is another
-                    condition when ESG bit is not set: it means the dynamic TCD link succeed and the current
-                    TCD block has been loaded into TCD registers.
-                */
-                if (tcdRegs->DLAST_SGA == (uint32_t)&handle->tcdPool[nextTcd])
-                {
-                    return kStatus_Success;
-                }
-                /*
-                    If go to this, means the previous transfer finished, and the DONE bit is set.
-                    So shall configure TCD registers.
-                */
-            }
-            else if (tcdRegs->DLAST_SGA != 0U)
-            {
-                /* The current TCD block has been linked successfully. */
-                return kStatus_Success;
-            }
-            else
-            {
-                /*
-                    DLAST_SGA is 0 and it means the first submit transfer, so shall configure
-                    TCD registers.
-                */
-            }
+            nextTcd = 0;
         }
-        /* There is no live chain, TCD block need to be installed in TCD registers. */
-        EDMA_InstallTCD(handle->base, handle->channel, &handle->tcdPool[currentTcd]);
-        /* Enable channel request again. */
-        if (0U != (handle->flags & EDMA_TRANSFER_ENABLED_MASK))
+        EDMA_TcdReset(&handle->tcdPool[currentTcd]);
+        EDMA_TcdSetTransferConfig(&handle->tcdPool[currentTcd], &config[i], NULL);
+        /* Enable major interrupt */
+        handle->tcdPool[currentTcd].CSR |= DMA_CSR_INTMAJOR_MASK;
+        /* Link current TCD with next TCD for identification of current TCD */
+        handle->tcdPool[currentTcd].DLAST_SGA = (uint32_t)&handle->tcdPool[nextTcd];
+        /* Enable scatter/gather feature except for the last TCD block of the batch. */
+        if (i != (transferNum - 1U))
         {
-            handle->base->SERQ = DMA_SERQ_SERQ(handle->channel);
+            handle->tcdPool[currentTcd].CSR =
+                (uint16_t)((handle->tcdPool[currentTcd].CSR | DMA_CSR_ESG_MASK) & ~DMA_CSR_DREQ_MASK);
+            currentTcd = nextTcd;
         }
-
-        return kStatus_Success;
     }
+
+    /* Link the whole chain behind the previous TCD. */
+    EDMA_LinkTcdChain(handle, firstTcd, currentTcd);
+
+    return kStatus_Success;
 }
 
 /*!
@@ -1352,6 +1508,311 @@ void EDMA_HandleIRQ(edma_handle_t *handle)
     }
 }
 
+static uint32_t EDMA_GetMemcpyWidth(uint32_t addr)
+{
+    uint32_t width = 32U;
+
+    while ((addr & (width - 1U)) != 0U)
+    {
+        width >>= 1U;
+    }
+#if !(defined(FSL_FEATURE_EDMA_SUPPORT_16_BYTES_TRANSFER) && FSL_FEATURE_EDMA_SUPPORT_16_BYTES_TRANSFER)
+    if (width == 16U)
+    {
+        width = 8U;
+    }
+#endif
+#if !(defined(FSL_FEATURE_EDMA_SUPPORT_8_BYTES_TRANSFER) && FSL_FEATURE_EDMA_SUPPORT_8_BYTES_TRANSFER)
+    if (width == 8U)
+    {
+        width = 4U;
+    }
+#endif
+
+    return width;
+}
+
+static void EDMA_StartMemcpyChannel(edma_memcpy_handle_t *handle,
+                                    uint32_t index,
+                                    uint32_t srcAddr,
+                                    uint32_t srcWidth,
+                                    uint32_t destAddr,
+                                    uint32_t destWidth,
+                                    uint32_t size,
+                                    bool srcIncrease)
+{
+    edma_handle_t *edmaHandle = handle->edmaHandle[index];
+    edma_tcd_t *tcd           = &handle->tcdPool[index * EDMA_MEMCPY_TCD_PER_CHANNEL];
+    edma_transfer_config_t config;
+    uint32_t unit  = (srcWidth > destWidth) ? srcWidth : destWidth;
+    uint32_t units = size / unit;
+    uint32_t minorUnits;
+    uint32_t majorCount;
+    uint32_t restUnits;
+    uint32_t bytes;
+
+    /*
+        Each minor loop moves about EDMA_MEMCPY_MINOR_LOOP_BYTES, and the minor loop is enlarged when
+        the major loop count would exceed the limit. The rest which can't fill a minor loop is moved
+        by a second TCD loaded with scatter/gather.
+    */
+    minorUnits = EDMA_MEMCPY_MINOR_LOOP_BYTES / unit;
+    if (minorUnits < ((units + EDMA_MEMCPY_MAX_MAJOR_COUNT - 1U) / EDMA_MEMCPY_MAX_MAJOR_COUNT))
+    {
+        minorUnits = (units + EDMA_MEMCPY_MAX_MAJOR_COUNT - 1U) / EDMA_MEMCPY_MAX_MAJOR_COUNT;
+    }
+    if ((minorUnits == 0U) || (minorUnits > units))
+    {
+        minorUnits = units;
+    }
+    majorCount = units / minorUnits;
+    restUnits  = units - (majorCount * minorUnits);
+    bytes      = majorCount * minorUnits * unit;
+
+    EDMA_PrepareTransfer(&config, (void *)srcAddr, srcWidth, (void *)destAddr, destWidth, minorUnits * unit, bytes,
+                         kEDMA_MemoryToMemory);
+    if (!srcIncrease)
+    {
+        config.srcOffset = 0;
+    }
+    EDMA_TcdReset(&tcd[0]);
+    EDMA_TcdSetTransferConfig(&tcd[0], &config, (restUnits != 0U) ? &tcd[1] : NULL);
+    if (majorCount > 1U)
+    {
+        /* Link the channel to itself so that the next minor loop is started by hardware. */
+        EDMA_TcdSetChannelLink(&tcd[0], kEDMA_MinorLink, edmaHandle->channel);
+    }
+
+    if (restUnits != 0U)
+    {
+        EDMA_PrepareTransfer(&config, (void *)(srcIncrease ? (srcAddr + bytes) : srcAddr), srcWidth,
+                             (void *)(destAddr + bytes), destWidth, restUnits * unit, restUnits * unit,
+                             kEDMA_MemoryToMemory);
+        if (!srcIncrease)
+        {
+            config.srcOffset = 0;
+        }
+        EDMA_TcdReset(&tcd[1]);
+        EDMA_TcdSetTransferConfig(&tcd[1], &config, NULL);
+        /* The rest TCD starts once it is loaded. */
+        tcd[1].CSR |= DMA_CSR_INTMAJOR_MASK | DMA_CSR_START_MASK;
+    }
+    else
+    {
+        tcd[0].CSR |= DMA_CSR_INTMAJOR_MASK;
+    }
+
+    EDMA_InstallTCD(edmaHandle->base, edmaHandle->channel, &tcd[0]);
+    EDMA_TriggerChannelStart(edmaHandle->base, edmaHandle->channel);
+}
+
+static status_t EDMA_StartMemcpy(
+    edma_memcpy_handle_t *handle, uint32_t destAddr, uint32_t srcAddr, uint32_t size, bool srcIncrease)
+{
+    uint32_t srcWidth  = srcIncrease ? EDMA_GetMemcpyWidth(srcAddr) : sizeof(handle->pattern);
+    uint32_t destWidth = EDMA_GetMemcpyWidth(destAddr);
+    uint32_t unit      = (srcWidth > destWidth) ? srcWidth : destWidth;
+    uint32_t dmaSize   = size - (size % unit);
+    uint32_t channelNum;
+    uint32_t channelSize;
+    uint32_t offset;
+    uint32_t i;
+
+    /* Copy the tail bytes which can't be moved with the transfer size. */
+    for (i = dmaSize; i < size; i++)
+    {
+        ((uint8_t *)destAddr)[i] = srcIncrease ? ((const uint8_t *)srcAddr)[i] : (uint8_t)handle->pattern;
+    }
+
+    if (dmaSize == 0U)
+    {
+        if (handle->callback != NULL)
+        {
+            handle->callback(handle, handle->userData);
+        }
+        return kStatus_Success;
+    }
+
+    /* Fan out to several channels when each channel still copies enough bytes. */
+    channelNum = dmaSize / EDMA_MEMCPY_CHANNEL_MIN_BYTES;
+    if (channelNum > handle->channelNum)
+    {
+        channelNum = handle->channelNum;
+    }
+    if (channelNum == 0U)
+    {
+        channelNum = 1U;
+    }
+    channelSize = ((dmaSize / unit) / channelNum) * unit;
+
+    handle->busyChannels = (uint8_t)channelNum;
+    offset               = 0U;
+    for (i = 0U; i < channelNum; i++)
+    {
+        /* The last channel takes the remainder. */
+        if (i == (channelNum - 1U))
+        {
+            channelSize = dmaSize - offset;
+        }
+        EDMA_StartMemcpyChannel(handle, i, srcIncrease ? (srcAddr + offset) : srcAddr, srcWidth, destAddr + offset,
+                                destWidth, channelSize, srcIncrease);
+        offset += channelSize;
+    }
+
+    return kStatus_Success;
+}
+
+static void EDMA_MemcpyCallback(edma_handle_t *handle, void *userData, bool transferDone, uint32_t tcds)
+{
+    edma_memcpy_handle_t *memcpyHandle = (edma_memcpy_handle_t *)userData;
+    uint32_t primask;
+    uint8_t busyChannels;
+
+    if (transferDone)
+    {
+        /* The channels of the job may complete in different interrupts. */
+        primask      = DisableGlobalIRQ();
+        busyChannels = memcpyHandle->busyChannels;
+        if (busyChannels != 0U)
+        {
+            busyChannels--;
+            memcpyHandle->busyChannels = busyChannels;
+        }
+        EnableGlobalIRQ(primask);
+
+        if ((busyChannels == 0U) && (memcpyHandle->callback != NULL))
+        {
+            memcpyHandle->callback(memcpyHandle, memcpyHandle->userData);
+        }
+    }
+}
+
+/*!
+ * brief Creates the eDMA memory copy handle.
+ *
+ * The memory copy handle runs memory to memory copies and memory sets on the given eDMA channels
+ * asynchronously. The eDMA handles should be created by EDMA_CreateHandle before, and must not
+ * be used for other transfers. The channels must have no peripheral request routed, the copy is
+ * started by software.
+ *
+ * param handle eDMA memory copy handle pointer.
+ * param edmaHandles Array of the eDMA handle pointers.
+ * param channelNum Number of eDMA handles in edmaHandles, up to EDMA_MEMCPY_MAX_CHANNEL.
+ * param tcdPool A memory pool of channelNum * EDMA_MEMCPY_TCD_PER_CHANNEL TCDs. It must be 32 bytes aligned.
+ * param callback Callback function called when a job is done.
+ * param userData A parameter for the callback function.
+ */
+void EDMA_CreateMemcpyHandle(edma_memcpy_handle_t *handle,
+                             edma_handle_t **edmaHandles,
+                             uint32_t channelNum,
+                             edma_tcd_t *tcdPool,
+                             edma_memcpy_callback callback,
+                             void *userData)
+{
+    assert(handle != NULL);
+    assert(edmaHandles != NULL);
+    assert((channelNum != 0U) && (channelNum <= EDMA_MEMCPY_MAX_CHANNEL));
+    assert(tcdPool != NULL);
+    assert(((uint32_t)tcdPool & 0x1FU) == 0U);
+
+    uint32_t i;
+
+    /* Zero the handle */
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->tcdPool    = tcdPool;
+    handle->callback   = callback;
+    handle->userData   = userData;
+    handle->channelNum = (uint8_t)channelNum;
+    for (i = 0U; i < channelNum; i++)
+    {
+        assert(edmaHandles[i] != NULL);
+        assert(edmaHandles[i]->tcdPool == NULL);
+
+        handle->edmaHandle[i] = edmaHandles[i];
+        EDMA_SetCallback(edmaHandles[i], EDMA_MemcpyCallback, handle);
+    }
+}
+
+/*!
+ * brief Copies memory with eDMA asynchronously.
+ *
+ * The source and destination transfer sizes are the widest ones allowed by the address alignment.
+ * The copy is split into minor loops of about EDMA_MEMCPY_MINOR_LOOP_BYTES bytes and a major loop
+ * within the major loop count limit, and is fanned out to several channels when it is larger than
+ * EDMA_MEMCPY_CHANNEL_MIN_BYTES for each channel. The tail bytes which can't be moved with the
+ * transfer size are copied by CPU in this function. The callback is called when the copy is done.
+ * If the whole copy is done by CPU, the callback is called in this function.
+ *
+ * note The source and destination must not overlap. The cache maintenance for the buffers is
+ *       the responsibility of the application.
+ *
+ * param handle eDMA memory copy handle pointer.
+ * param destAddr Destination address.
+ * param srcAddr Source address.
+ * param size Number of bytes to copy.
+ * retval kStatus_Success The copy is started.
+ * retval kStatus_EDMA_Busy The previous job is not done.
+ */
+status_t EDMA_Memcpy(edma_memcpy_handle_t *handle, void *destAddr, const void *srcAddr, uint32_t size)
+{
+    assert(handle != NULL);
+    assert(destAddr != NULL);
+    assert(srcAddr != NULL);
+
+    if (handle->busyChannels != 0U)
+    {
+        return kStatus_EDMA_Busy;
+    }
+
+    return EDMA_StartMemcpy(handle, (uint32_t)destAddr, (uint32_t)srcAddr, size, true);
+}
+
+/*!
+ * brief Sets memory with eDMA asynchronously.
+ *
+ * This function is the same as EDMA_Memcpy, except that the source is the byte value
+ * repeated in a word and the source address is not incremented.
+ *
+ * param handle eDMA memory copy handle pointer.
+ * param destAddr Destination address.
+ * param value The byte value to set.
+ * param size Number of bytes to set.
+ * retval kStatus_Success The memory set is started.
+ * retval kStatus_EDMA_Busy The previous job is not done.
+ */
+status_t EDMA_Memset(edma_memcpy_handle_t *handle, void *destAddr, uint8_t value, uint32_t size)
+{
+    assert(handle != NULL);
+    assert(destAddr != NULL);
+
+    if (handle->busyChannels != 0U)
+    {
+        return kStatus_EDMA_Busy;
+    }
+    handle->pattern = (uint32_t)value * 0x01010101U;
+
+    return EDMA_StartMemcpy(handle, (uint32_t)destAddr, (uint32_t)&handle->pattern, size, false);
+}
+
+/*!
+ * brief Aborts the eDMA memory copy or memory set job.
+ *
+ * param handle eDMA memory copy handle pointer.
+ */
+void EDMA_AbortMemcpy(edma_memcpy_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    uint32_t i;
+
+    for (i = 0U; i < handle->channelNum; i++)
+    {
+        EDMA_AbortTransfer(handle->edmaHandle[i]);
+    }
+    handle->busyChannels = 0U;
+}
+
 #if defined(FSL_FEATURE_EDMA_MODULE_CHANNEL_IRQ_ENTRY_SHARED_OFFSET) && \
     (FSL_FEATURE_EDMA_MODULE_CHANNEL_IRQ_ENTRY_SHARED_OFFSET == 4)
 /* 8 channels (Shared): kl28 */
@@ -23,9 +23,27 @@
 /*! @name Driver version */
 /*@{*/
 /*! @brief eDMA driver version */
-#define FSL_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 1, 7)) /*!< Version 2.1.7. */
+#define FSL_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 1, 9)) /*!< Version 2.1.9. */
 /*@}*/
 
+/*! @brief Maximum number of eDMA channels used by one memory copy handle. */
+#ifndef EDMA_MEMCPY_MAX_CHANNEL
+#define EDMA_MEMCPY_MAX_CHANNEL (4U)
+#endif
+
+/*! @brief Minimum number of bytes each channel copies when a memory copy is fanned out to several channels. */
+#ifndef EDMA_MEMCPY_CHANNEL_MIN_BYTES
+#define EDMA_MEMCPY_CHANNEL_MIN_BYTES (4096U)
+#endif
+
+/*! @brief Preferred minor loop bytes of the memory copy, the channel is arbitrated again after each minor loop. */
+#ifndef EDMA_MEMCPY_MINOR_LOOP_BYTES
+#define EDMA_MEMCPY_MINOR_LOOP_BYTES (1024U)
+#endif
+
+/*! @brief Number of TCDs each channel of the memory copy handle needs in the TCD pool. */
+#define EDMA_MEMCPY_TCD_PER_CHANNEL (2U)
+
 /*! @brief Compute the offset unit from DCHPRI3 */
 #define DMA_DCHPRI_INDEX(channel) (((channel) & ~0x03U) | (3U - ((channel)&0x03U)))
 
@@ -254,6 +272,31 @@ typedef struct _edma_handle
     uint8_t flags;           /*!< The status of the current channel. */
 } edma_handle_t;
 
+/*! @brief Callback for eDMA memory copy */
+struct _edma_memcpy_handle;
+
+/*! @brief Define callback function for eDMA memory copy.
+ *
+ * This callback function is called in the EDMA interrupt handle once all the channels of the
+ * memory copy or memory set job are done.
+ *
+ * @param handle EDMA memory copy handle pointer, users shall not touch the values inside.
+ * @param userData The callback user parameter pointer.
+ */
+typedef void (*edma_memcpy_callback)(struct _edma_memcpy_handle *handle, void *userData);
+
+/*! @brief eDMA memory copy handle structure */
+typedef struct _edma_memcpy_handle
+{
+    edma_handle_t *edmaHandle[EDMA_MEMCPY_MAX_CHANNEL]; /*!< eDMA handles of the channels used for the copy. */
+    edma_tcd_t *tcdPool;                                /*!< TCD memory of the channels. */
+    edma_memcpy_callback callback;                      /*!< Callback function for the job completion. */
+    void *userData;                                     /*!< Callback function parameter. */
+    uint32_t pattern;                                   /*!< Source pattern of the memory set. */
+    uint8_t channelNum;                                 /*!< Number of channels in edmaHandle. */
+    volatile uint8_t busyChannels;                      /*!< Number of channels of the current job not done. */
+} edma_memcpy_handle_t;
+
 /*******************************************************************************
  * APIs
  ******************************************************************************/
@@ -822,6 +865,24 @@ void EDMA_PrepareTransfer(edma_transfer_config_t *config,
  */
 status_t EDMA_SubmitTransfer(edma_handle_t *handle, const edma_transfer_config_t *config);
 
+/*!
+ * @brief Submits a batch of eDMA transfer requests.
+ *
+ * This function links all the transfer configurations into the TCD pool in one call. The TCDs are configured
+ * and chained to each other outside the critical section, and the whole chain is linked behind the live chain
+ * only once, so queuing many buffers costs one critical section and one dynamic link instead of one per buffer.
+ * The TCD pool must be installed by EDMA_InstallTCDMemory before. Each TCD generates the major loop interrupt
+ * as the one submitted by EDMA_SubmitTransfer.
+ *
+ * @param handle eDMA handle pointer.
+ * @param config Pointer to the array of eDMA transfer configuration structures.
+ * @param transferNum Number of transfer configurations in the array.
+ * @retval kStatus_Success It means submit transfer request succeed.
+ * @retval kStatus_EDMA_QueueFull It means there are not enough free TCD slots for the whole batch, no transfer is
+ *         submitted.
+ */
+status_t EDMA_SubmitTransferBatch(edma_handle_t *handle, const edma_transfer_config_t *config, uint32_t transferNum);
+
 /*!
  * @brief eDMA starts transfer.
  *
@@ -912,6 +973,90 @@ void EDMA_HandleIRQ(edma_handle_t *handle);
 
 /* @} */
 
+/*!
+ * @name eDMA Memory Copy Operation
+ * @{
+ */
+
+/*!
+ * @brief Creates the eDMA memory copy handle.
+ *
+ * The memory copy handle runs memory to memory copies and memory sets on the given eDMA channels
+ * asynchronously. The eDMA handles should be created by EDMA_CreateHandle before, and must not
+ * be used for other transfers. The channels must have no peripheral request routed, the copy is
+ * started by software.
+ *
+ * @param handle eDMA memory copy handle pointer.
+ * @param edmaHandles Array of the eDMA handle pointers.
+ * @param channelNum Number of eDMA handles in edmaHandles, up to EDMA_MEMCPY_MAX_CHANNEL.
+ * @param tcdPool A memory pool of channelNum * EDMA_MEMCPY_TCD_PER_CHANNEL TCDs. It must be 32 bytes aligned.
+ * @param callback Callback function called when a job is done.
+ * @param userData A parameter for the callback function.
+ */
+void EDMA_CreateMemcpyHandle(edma_memcpy_handle_t *handle,
+                             edma_handle_t **edmaHandles,
+                             uint32_t channelNum,
+                             edma_tcd_t *tcdPool,
+                             edma_memcpy_callback callback,
+                             void *userData);
+
+/*!
+ * @brief Copies memory with eDMA asynchronously.
+ *
+ * The source and destination transfer sizes are the widest ones allowed by the address alignment.
+ * The copy is split into minor loops of about EDMA_MEMCPY_MINOR_LOOP_BYTES bytes and a major loop
+ * within the major loop count limit, and is fanned out to several channels when it is larger than
+ * EDMA_MEMCPY_CHANNEL_MIN_BYTES for each channel. The tail bytes which can't be moved with the
+ * transfer size are copied by CPU in this function. The callback is called when the copy is done.
+ * If the whole copy is done by CPU, the callback is called in this function.
+ *
+ * @note The source and destination must not overlap. The cache maintenance for the buffers is
+ *       the responsibility of the application.
+ *
+ * @param handle eDMA memory copy handle pointer.
+ * @param destAddr Destination address.
+ * @param srcAddr Source address.
+ * @param size Number of bytes to copy.
+ * @retval kStatus_Success The copy is started.
+ * @retval kStatus_EDMA_Busy The previous job is not done.
+ */
+status_t EDMA_Memcpy(edma_memcpy_handle_t *handle, void *destAddr, const void *srcAddr, uint32_t size);
+
+/*!
+ * @brief Sets memory with eDMA asynchronously.
+ *
+ * This function is the same as EDMA_Memcpy, except that the source is the byte value
+ * repeated in a word and the source address is not incremented.
+ *
+ * @param handle eDMA memory copy handle pointer.
+ * @param destAddr Destination address.
+ * @param value The byte value to set.
+ * @param size Number of bytes to set.
+ * @retval kStatus_Success The memory set is started.
+ * @retval kStatus_EDMA_Busy The previous job is not done.
+ */
+status_t EDMA_Memset(edma_memcpy_handle_t *handle, void *destAddr, uint8_t value, uint32_t size);
+
+/*!
+ * @brief Aborts the eDMA memory copy or memory set job.
+ *
+ * @param handle eDMA memory copy handle pointer.
+ */
+void EDMA_AbortMemcpy(edma_memcpy_handle_t *handle);
+
+/*!
+ * @brief Gets whether the eDMA memory copy handle is busy.
+ *
+ * @param handle eDMA memory copy handle pointer.
+ * @return True if a job is not done yet.
+ */
+static inline bool EDMA_IsMemcpyBusy(edma_memcpy_handle_t *handle)
+{
+    return (handle->busyChannels != 0U);
+}
+
+/* @} */
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -21,8 +21,8 @@
 
 /*! @name Driver version */
 /*@{*/
-/*! @brief FlexCAN driver version 2.4.0. */
-#define FSL_FLEXCAN_DRIVER_VERSION (MAKE_VERSION(2, 4, 0))
+/*! @brief FlexCAN driver version 2.4.5. */
+#define FSL_FLEXCAN_DRIVER_VERSION (MAKE_VERSION(2, 4, 5))
 /*@}*/
 
 #if !(defined(FLEXCAN_WAIT_TIMEOUT) && FLEXCAN_WAIT_TIMEOUT)
@@ -86,6 +86,13 @@
 #define FLEXCAN_RX_FIFO_EXT_MASK_TYPE_C_LOW(id) \
     ((FLEXCAN_ID_EXT(id) & 0x1FE00000) >> 21) /*!< Extend Rx FIFO Mask helper macro Type C lower part helper macro. */
 
+/*! @brief Number of the individual masks which can be used as the Rx FIFO filter mask. */
+#define FLEXCAN_RX_FIFO_INDIVIDUAL_MASK_NUM (32U)
+
+/*! @brief Work memory blocks of the Rx FIFO filter compiler for the rules, each rule splits into at most
+ *  56 blocks, and the same amount is needed to try a filter format. */
+#define FLEXCAN_RX_FIFO_FILTER_BLOCK_NUM(ruleNum) ((uint32_t)(ruleNum)*112U)
+
 /*! @brief FlexCAN Rx FIFO Filter helper macro. */
 #define FLEXCAN_RX_FIFO_STD_FILTER_TYPE_A(id, rtr, ide) \
     FLEXCAN_RX_FIFO_STD_MASK_TYPE_A(id, rtr, ide) /*!< Standard Rx FIFO Filter helper macro Type A helper macro. */
@@ -451,6 +458,48 @@ typedef struct _flexcan_rx_fifo_config
     flexcan_rx_fifo_priority_t priority;        /*!< The FlexCAN Rx FIFO receive priority. */
 } flexcan_rx_fifo_config_t;
 
+/*! @brief FlexCAN Rx FIFO filter rule, accepts the IDs from idLow to idHigh. */
+typedef struct _flexcan_rx_fifo_filter_rule
+{
+    uint32_t idLow;                /*!< The lowest accepted ID, 11 bits standard or 29 bits extended ID value. */
+    uint32_t idHigh;               /*!< The highest accepted ID, equal to idLow for a single ID. */
+    flexcan_frame_format_t format; /*!< CAN Frame Identifier format(Standard of Extend). */
+} flexcan_rx_fifo_filter_rule_t;
+
+/*! @brief FlexCAN Rx FIFO filter block, the IDs which match the value on the mask bits. */
+typedef struct _flexcan_rx_fifo_filter_block
+{
+    uint32_t value;                /*!< ID or filter element field value. */
+    uint32_t mask;                 /*!< ID or filter element field mask. */
+    flexcan_frame_format_t format; /*!< CAN Frame Identifier format(Standard of Extend). */
+} flexcan_rx_fifo_filter_block_t;
+
+/*! @brief FlexCAN Rx FIFO filter compiler configuration structure. */
+typedef struct _flexcan_rx_fifo_filter_compiler_config
+{
+    const flexcan_rx_fifo_filter_rule_t *rules; /*!< The accepted ID rules. */
+    uint32_t ruleNum;                           /*!< The quantity of rules. */
+    flexcan_rx_fifo_filter_block_t *blocks;     /*!< Work memory, FLEXCAN_RX_FIFO_FILTER_BLOCK_NUM(ruleNum)
+                                                     blocks are enough. */
+    uint32_t blockNum;                          /*!< The quantity of blocks in the work memory. */
+    uint8_t maxFilterNum;                       /*!< The maximum filter elements, multiple of 8, up to 128. */
+    uint8_t mbNum;                              /*!< The quantity of Message Buffers of the instance,
+                                                     FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base). */
+    bool enableIndividMask;                     /*!< Same as the enableIndividMask of flexcan_config_t. */
+} flexcan_rx_fifo_filter_compiler_config_t;
+
+/*! @brief FlexCAN Rx FIFO filter masks compiled with the filter table. */
+typedef struct _flexcan_rx_fifo_filter_program
+{
+    uint32_t individualMask[FLEXCAN_RX_FIFO_INDIVIDUAL_MASK_NUM]; /*!< Masks of the first filter elements. */
+    uint8_t individualMaskNum;                                    /*!< The quantity of individual masks. */
+    uint32_t globalMask;                                          /*!< Rx FIFO global mask for the other elements. */
+    uint64_t wantedIdNum;                                         /*!< The quantity of IDs accepted by the rules. */
+    uint64_t falseAcceptIdNum;                                    /*!< Upper bound of the IDs accepted by the filter
+                                                                       but not by the rules, the frames of these
+                                                                       IDs need software filtering. */
+} flexcan_rx_fifo_filter_program_t;
+
 /*! @brief FlexCAN Message Buffer transfer. */
 typedef struct _flexcan_mb_transfer
 {
@@ -467,6 +516,60 @@ typedef struct _flexcan_fifo_transfer
     flexcan_frame_t *frame; /*!< The buffer of CAN Message to be received from Rx FIFO. */
 } flexcan_fifo_transfer_t;
 
+/*! @brief FlexCAN Tx queue arbitration. */
+typedef enum _flexcan_tx_queue_arbitration
+{
+    kFLEXCAN_TxQueueLowestIdFirst = 0x0U, /*!< Frames are sent in the CAN ID order, same as the bus arbitration. */
+    kFLEXCAN_TxQueueLocalPriority = 0x1U, /*!< Frames are sent in the local priority order, then the CAN ID order. */
+} flexcan_tx_queue_arbitration_t;
+
+/*! @brief FlexCAN Tx queue entry, the storage of a queued frame. */
+typedef struct _flexcan_tx_queue_entry
+{
+    flexcan_frame_t frame; /*!< The queued frame. */
+    uint64_t key;          /*!< The queue order key, the local priority and the bus arbitration value of the frame. */
+    uint32_t sequence;     /*!< The queue sequence number, keeps the order of the frames with the same key. */
+    uint16_t queueTime;    /*!< FlexCAN timer value when the frame is queued. */
+} flexcan_tx_queue_entry_t;
+
+/*! @brief FlexCAN Tx queue configuration structure. */
+typedef struct _flexcan_tx_queue_config
+{
+    flexcan_tx_queue_entry_t *entries;          /*!< The storage of the queued frames. */
+    uint16_t entryNum;                          /*!< Number of the entries in the storage. */
+    uint8_t firstMbIdx;                         /*!< The first Tx Message Buffer used by the queue. */
+    uint8_t mbNum;                              /*!< Number of the consecutive Tx Message Buffers used by the queue. */
+    flexcan_tx_queue_arbitration_t arbitration; /*!< The arbitration among the queued frames. */
+} flexcan_tx_queue_config_t;
+
+/*! @brief FlexCAN Tx queue statistics, the latencies are in FlexCAN timer ticks (CAN bit times). */
+typedef struct _flexcan_tx_queue_statistics
+{
+    uint32_t sentFrames;     /*!< Number of the sent frames. */
+    uint32_t rejectedFrames; /*!< Number of the frames rejected as the queue is full. */
+    uint32_t totalLatency;   /*!< Sum of the latencies of the sent frames. */
+    uint16_t depth;          /*!< Number of the frames waiting in the queue, not in the Message Buffers. */
+    uint16_t maxDepth;       /*!< Maximum number of the frames waiting in the queue. */
+    uint16_t lastLatency;    /*!< Latency from queue to the start of transmission of the last sent frame. */
+    uint16_t maxLatency;     /*!< Maximum latency of the sent frames. */
+} flexcan_tx_queue_statistics_t;
+
+/*! @brief FlexCAN Tx queue. It is used by the FlexCAN transactional functions, the members should not be accessed
+ *  by the application. */
+typedef struct _flexcan_tx_queue
+{
+    flexcan_tx_queue_entry_t *entries;        /*!< The storage of the queued frames, a binary heap by the key. */
+    uint16_t entryNum;                        /*!< Number of the entries in the storage. */
+    volatile uint16_t count;                  /*!< Number of the frames in the heap. */
+    uint8_t firstMbIdx;                       /*!< The first Tx Message Buffer used by the queue. */
+    uint8_t mbNum;                            /*!< Number of the Tx Message Buffers used by the queue. */
+    uint8_t arbitration;                      /*!< The arbitration among the queued frames. */
+    uint32_t sequence;                        /*!< The sequence number of the next queued frame. */
+    uint16_t mbQueueTime[CAN_WORD1_COUNT];    /*!< Queue time of the frame in each Message Buffer. */
+    uint64_t mbKey[CAN_WORD1_COUNT];          /*!< Queue order key of the frame in each Message Buffer. */
+    flexcan_tx_queue_statistics_t statistics; /*!< The queue statistics. */
+} flexcan_tx_queue_t;
+
 /*! @brief FlexCAN handle structure definition. */
 typedef struct _flexcan_handle flexcan_handle_t;
 
@@ -496,6 +599,15 @@ struct _flexcan_handle
     flexcan_frame_t *volatile rxFifoFrameBuf;  /*!< The buffer for received data from Rx FIFO. */
     volatile uint8_t mbState[CAN_WORD1_COUNT]; /*!< Message Buffer transfer state. */
     volatile uint8_t rxFifoState;              /*!< Rx FIFO transfer state. */
+
+    flexcan_frame_t *rxFifoRing;         /*!< The frame ring for the Rx FIFO streaming receive. */
+    size_t rxFifoRingSize;               /*!< Number of frames in the frame ring. */
+    volatile size_t rxFifoRingHead;      /*!< Index the next frame is written to, only changed by the IRQ. */
+    volatile size_t rxFifoRingTail;      /*!< Index of the oldest frame not released, only changed by the user. */
+    volatile uint32_t rxFifoRingOverrun; /*!< Number of frames dropped as the frame ring is full. */
+    volatile uint32_t rxFifoOverflowNum; /*!< Number of Rx FIFO overflow events. */
+
+    flexcan_tx_queue_t *txQueue; /*!< The Tx queue, NULL if the Tx queue is not used. */
 };
 
 /******************************************************************************
@@ -783,6 +895,50 @@ void FLEXCAN_SetFDRxMbConfig(CAN_Type *base, uint8_t mbIdx, const flexcan_rx_mb_
  */
 void FLEXCAN_SetRxFifoConfig(CAN_Type *base, const flexcan_rx_fifo_config_t *config, bool enable);
 
+/*!
+ * @brief Compiles the Rx FIFO filter for the accepted ID rules.
+ *
+ * This function packs the ID ranges of the rules into the Rx FIFO filter table and masks. The ranges
+ * are split into blocks of IDs which match on the mask bits, and the blocks are fitted into the filter
+ * elements of format A, B and C. When the blocks don't fit, the blocks which accept the least more IDs
+ * are merged. The format with the least false accepted IDs is used, then the one with the least filter
+ * elements. Data and remote frames are both accepted. Note that the format C filter compares 8 ID bits
+ * for both standard and extended frames.
+ *
+ * The Rx FIFO and its filter table occupy 8 + 2 * RFFN Message Buffers, so the filter elements are
+ * limited by the mbNum of the configuration. Only the filter elements within the occupied Message
+ * Buffers, and at most the first 32 ones, have individual masks. The masked fields are put into these
+ * elements, the other elements match exactly with the Rx FIFO global mask.
+ *
+ * This function is pure computation and doesn't access the FlexCAN.
+ *
+ * @param config Pointer to the filter compiler configuration structure.
+ * @param fifoConfig Pointer to the Rx FIFO configuration structure. The idFilterTable should have
+ *                   maxFilterNum elements, idFilterNum and idFilterType are set by this function.
+ * @param program Pointer to the compiled filter masks.
+ * @retval kStatus_Success The filter is compiled.
+ * @retval kStatus_OutOfRange The work memory is not enough.
+ * @retval kStatus_Fail The rules can't fit into the filter elements.
+ */
+status_t FLEXCAN_CompileRxFifoFilter(const flexcan_rx_fifo_filter_compiler_config_t *config,
+                                     flexcan_rx_fifo_config_t *fifoConfig,
+                                     flexcan_rx_fifo_filter_program_t *program);
+
+/*!
+ * @brief Configures the FlexCAN Rx FIFO with the compiled filter.
+ *
+ * This function sets the individual masks and the Rx FIFO global mask of the compiled filter, then
+ * configures and enables the Rx FIFO. The individual masks must not be more than the Message Buffers
+ * of the instance.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param fifoConfig Pointer to the Rx FIFO configuration structure compiled by FLEXCAN_CompileRxFifoFilter().
+ * @param program Pointer to the compiled filter masks.
+ */
+void FLEXCAN_SetRxFifoFilterProgram(CAN_Type *base,
+                                    const flexcan_rx_fifo_config_t *fifoConfig,
+                                    const flexcan_rx_fifo_filter_program_t *program);
+
 /* @} */
 
 /*!
@@ -1113,6 +1269,49 @@ status_t FLEXCAN_WriteFDTxMb(CAN_Type *base, uint8_t mbIdx, const flexcan_fd_fra
  * @retval kStatus_Fail               - Rx Message Buffer is empty.
  */
 status_t FLEXCAN_ReadFDRxMb(CAN_Type *base, uint8_t mbIdx, flexcan_fd_frame_t *rxFrame);
+
+/*!
+ * @brief Gets the CAN FD payload length in bytes of a DLC.
+ *
+ * @param dlc The CAN FD Data Length Code, 0 ~ 15.
+ * @return The payload length in bytes, 0 ~ 8, 12, 16, 20, 24, 32, 48 or 64.
+ */
+uint8_t FLEXCAN_FDDlcToLength(uint8_t dlc);
+
+/*!
+ * @brief Gets the CAN FD DLC of a payload length in bytes.
+ *
+ * The length which is not a valid CAN FD payload length is rounded up to the next one.
+ *
+ * @param length The payload length in bytes, 0 ~ 64.
+ * @return The CAN FD Data Length Code.
+ */
+uint8_t FLEXCAN_FDLengthToDlc(uint8_t length);
+
+/*!
+ * @brief Sets the payload of a CAN FD frame from a byte buffer.
+ *
+ * This function packs the bytes into the frame dataWord in the Message Buffer byte order, data[0] is the
+ * MSByte of dataWord[0], a word at a time. The frame length is set to the DLC of the payload length, and
+ * the padding bytes up to the DLC length are zero.
+ *
+ * @param frame Pointer to CAN FD message frame.
+ * @param data The payload bytes.
+ * @param length The payload length in bytes, 0 ~ 64.
+ */
+void FLEXCAN_FDSetFramePayload(flexcan_fd_frame_t *frame, const uint8_t *data, uint8_t length);
+
+/*!
+ * @brief Gets the payload of a CAN FD frame to a byte buffer.
+ *
+ * This function unpacks the frame dataWord in the Message Buffer byte order, dataWord[0] MSByte to data[0],
+ * a word at a time.
+ *
+ * @param frame Pointer to CAN FD message frame.
+ * @param data The buffer for the payload, which should hold the payload length of the frame DLC.
+ * @return The payload length in bytes.
+ */
+uint8_t FLEXCAN_FDGetFramePayload(const flexcan_fd_frame_t *frame, uint8_t *data);
 #endif
 
 /*!
@@ -1315,6 +1514,139 @@ status_t FLEXCAN_TransferReceiveFifoNonBlocking(CAN_Type *base,
                                                 flexcan_handle_t *handle,
                                                 flexcan_fifo_transfer_t *xfer);
 
+/*!
+ * @brief Starts streaming the Rx FIFO into a frame ring using IRQ.
+ *
+ * This function keeps the Rx FIFO receiving until FLEXCAN_TransferAbortReceiveFifo() is called. Each
+ * Rx FIFO interrupt drains all the available frames into the frame ring, and the callback is called
+ * with kStatus_FLEXCAN_RxFifoIdle after that. The frames are got with
+ * FLEXCAN_TransferGetReceiveFifoRingData() and released with FLEXCAN_TransferReleaseReceiveFifoRing().
+ * The frame ring is a single-producer single-consumer ring, the IRQ handler is the only writer and the
+ * user is the only reader, so no lock is needed. One frame of the ring is kept empty to tell full
+ * from empty. When the ring is full, the new frame is dropped and counted, and the Rx FIFO overflow
+ * is counted too, see FLEXCAN_TransferGetReceiveFifoRingOverrun().
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ * @param ring The frame ring.
+ * @param ringSize Number of frames in the frame ring, at least 2.
+ * @retval kStatus_Success            - Start Rx FIFO streaming successfully.
+ * @retval kStatus_FLEXCAN_RxFifoBusy - Rx FIFO is currently in use.
+ */
+status_t FLEXCAN_TransferStartReceiveFifoRing(CAN_Type *base,
+                                              flexcan_handle_t *handle,
+                                              flexcan_frame_t *ring,
+                                              size_t ringSize);
+
+/*!
+ * @brief Gets the received frames in the frame ring.
+ *
+ * This function returns the oldest frames not released yet. When the frames wrap around the end of
+ * the ring, only the part till the end of the ring is returned, the rest is returned after this part
+ * is released.
+ *
+ * @param handle FlexCAN handle pointer.
+ * @param frames Pointer to get the address of the frames in the ring.
+ * @param count Pointer to get the number of frames at @p frames.
+ * @retval kStatus_Success Get successfully through the parameters.
+ * @retval kStatus_NoTransferInProgress Rx FIFO streaming is not started.
+ */
+status_t FLEXCAN_TransferGetReceiveFifoRingData(flexcan_handle_t *handle, flexcan_frame_t **frames, size_t *count);
+
+/*!
+ * @brief Releases the frames in the frame ring.
+ *
+ * @param handle FlexCAN handle pointer.
+ * @param count Number of frames to release, must not exceed the number got by
+ *              FLEXCAN_TransferGetReceiveFifoRingData().
+ */
+void FLEXCAN_TransferReleaseReceiveFifoRing(flexcan_handle_t *handle, size_t count);
+
+/*!
+ * @brief Gets the overrun counters of the Rx FIFO streaming.
+ *
+ * @param handle FlexCAN handle pointer.
+ * @param ringOverrun Pointer to get the number of frames dropped as the frame ring is full.
+ * @param fifoOverflow Pointer to get the number of Rx FIFO overflow events, the frames lost in the
+ *                     Rx FIFO are not counted by hardware.
+ */
+void FLEXCAN_TransferGetReceiveFifoRingOverrun(flexcan_handle_t *handle,
+                                               uint32_t *ringOverrun,
+                                               uint32_t *fifoOverflow);
+
+/*!
+ * @brief Creates the Tx queue on the FlexCAN handle.
+ *
+ * The Tx queue keeps the frames in the order of the CAN ID, or of the local priority then the CAN ID,
+ * and keeps the Tx Message Buffers of the queue filled. When a frame is sent, the Message Buffer is
+ * filled again from the queue head in the IRQ handler, so the bus keeps busy without the application.
+ * The arbitration among the Message Buffers is configured to the lowest CAN ID first, or to the local
+ * priority first when kFLEXCAN_TxQueueLocalPriority is used. As the frames already in the Message
+ * Buffers are not taken back, a new frame may wait for at most mbNum frames of lower priority. The
+ * Message Buffers of the same arbitration value are sent in the lowest index first order, so a frame
+ * waits in the queue while a frame of the same key is in a Message Buffer, to keep the queue order.
+ *
+ * @note The FlexCAN module is put in the Freeze Mode to configure the arbitration. The Tx queue
+ *       supports the classic CAN frames only, the CAN FD must not be enabled.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ * @param queue The Tx queue, which must be kept until the Tx queue is aborted.
+ * @param config Pointer to the Tx queue configuration structure.
+ */
+void FLEXCAN_TransferTxQueueCreate(CAN_Type *base,
+                                   flexcan_handle_t *handle,
+                                   flexcan_tx_queue_t *queue,
+                                   const flexcan_tx_queue_config_t *config);
+
+/*!
+ * @brief Sends a frame through the Tx queue.
+ *
+ * The frame is written to a free Message Buffer of the queue at once, or copied to the queue. The
+ * callback is called with kStatus_FLEXCAN_TxIdle and the Message Buffer index when each frame is sent.
+ *
+ * @note The FlexCAN timer is read for the latency statistics, which unlocks the Rx Message Buffer
+ *       locked by the application.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ * @param frame Pointer to CAN message frame to be sent.
+ * @param priority The local priority, 0 ~ 7, lower value is sent first. Only used with
+ *                 kFLEXCAN_TxQueueLocalPriority.
+ * @retval kStatus_Success        - The frame is queued.
+ * @retval kStatus_FLEXCAN_TxBusy - The queue is full.
+ */
+status_t FLEXCAN_TransferTxQueueSend(CAN_Type *base,
+                                     flexcan_handle_t *handle,
+                                     const flexcan_frame_t *frame,
+                                     uint8_t priority);
+
+/*!
+ * @brief Gets the Tx queue statistics.
+ *
+ * @param handle FlexCAN handle pointer.
+ * @param statistics Pointer to get the Tx queue statistics.
+ */
+void FLEXCAN_TransferTxQueueGetStatistics(flexcan_handle_t *handle, flexcan_tx_queue_statistics_t *statistics);
+
+/*!
+ * @brief Clears the Tx queue statistics.
+ *
+ * @param handle FlexCAN handle pointer.
+ */
+void FLEXCAN_TransferTxQueueClearStatistics(flexcan_handle_t *handle);
+
+/*!
+ * @brief Aborts the Tx queue.
+ *
+ * This function aborts the frames in the Message Buffers of the queue, drops the queued frames, and
+ * removes the Tx queue from the handle.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ */
+void FLEXCAN_TransferTxQueueAbort(CAN_Type *base, flexcan_handle_t *handle);
+
 /*!
  * @brief Aborts the interrupt driven message send process.
  *
@@ -1340,7 +1672,8 @@ void FLEXCAN_TransferAbortReceive(CAN_Type *base, flexcan_handle_t *handle, uint
 /*!
  * @brief Aborts the interrupt driven message receive from Rx FIFO process.
  *
- * This function aborts the interrupt driven message receive from Rx FIFO process.
+ * This function aborts the interrupt driven message receive from Rx FIFO process, and stops the Rx FIFO
+ * streaming started by FLEXCAN_TransferStartReceiveFifoRing().
  *
  * @param base FlexCAN peripheral base address.
  * @param handle FlexCAN handle pointer.
@@ -22,8 +22,8 @@
 
 /*! @name Driver version */
 /*@{*/
-/*! @brief FlexCAN EDMA driver version 2.4.0. */
-#define FSL_FLEXCAN_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 4, 0))
+/*! @brief FlexCAN EDMA driver version 2.4.1. */
+#define FSL_FLEXCAN_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 4, 1))
 /*@}*/
 
 /* Forward declaration of the handle typedef. */
@@ -44,6 +44,13 @@ struct _flexcan_edma_handle
     void *userData;                            /*!< FlexCAN callback function parameter.*/
     edma_handle_t *rxFifoEdmaHandle;           /*!< The EDMA Rx FIFO channel used. */
     volatile uint8_t rxFifoState;              /*!< Rx FIFO transfer state. */
+
+    flexcan_frame_t *rxFifoRing;         /*!< The frame ring for the Rx FIFO eDMA streaming. */
+    size_t rxFifoRingSize;               /*!< Number of frames in the frame ring. */
+    volatile size_t rxFifoRingHead;      /*!< Index the eDMA has written to when last checked. */
+    volatile size_t rxFifoRingTail;      /*!< Index of the oldest frame not released by the user. */
+    volatile size_t rxFifoRingUnread;    /*!< Number of received frames not released by the user. */
+    volatile uint32_t rxFifoRingOverrun; /*!< Number of frames dropped as they are overwritten. */
 };
 
 /*******************************************************************************
@@ -100,6 +107,75 @@ void FLEXCAN_TransferAbortReceiveFifoEDMA(CAN_Type *base, flexcan_edma_handle_t
 
 /*@}*/
 
+/*!
+ * @name eDMA frame ring
+ * @{
+ */
+
+/*!
+ * @brief Starts streaming the Rx FIFO into a frame ring using eDMA.
+ *
+ * This function configures the Rx FIFO eDMA channel to loop over the frame ring continuously, the
+ * destination address is rewound after each major loop so the channel never stops and no re-arm is
+ * needed between the frames. The half and major loop interrupts of the eDMA channel track the ring,
+ * the callback is called with @ref kStatus_FLEXCAN_RxFifoIdle when new frames are counted there. The
+ * frames are got with @ref FLEXCAN_TransferGetReceiveFifoRingDataEDMA and released with
+ * @ref FLEXCAN_TransferReleaseReceiveFifoRingEDMA. If the unreleased frames are overwritten, the
+ * callback is called with @ref kStatus_FLEXCAN_RxFifoOverflow, the unreleased frames are dropped and
+ * counted in the rxFifoRingOverrun of the handle.
+ *
+ * @note The Rx FIFO eDMA handle must not use a TCD pool in this mode. The ring size must not exceed
+ *       the eDMA major loop count limit.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle Pointer to flexcan_edma_handle_t structure.
+ * @param ring The frame ring.
+ * @param ringSize Number of frames in the frame ring.
+ * @retval kStatus_Success Rx FIFO streaming is started.
+ * @retval kStatus_FLEXCAN_RxFifoBusy Previous transfer ongoing.
+ */
+status_t FLEXCAN_TransferStartReceiveFifoRingEDMA(CAN_Type *base,
+                                                  flexcan_edma_handle_t *handle,
+                                                  flexcan_frame_t *ring,
+                                                  size_t ringSize);
+
+/*!
+ * @brief Stops streaming the Rx FIFO into the frame ring using eDMA.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle Pointer to flexcan_edma_handle_t structure.
+ */
+void FLEXCAN_TransferStopReceiveFifoRingEDMA(CAN_Type *base, flexcan_edma_handle_t *handle);
+
+/*!
+ * @brief Gets the received frames in the frame ring.
+ *
+ * This function returns the oldest frames not released yet. When the frames wrap around the end of
+ * the ring, only the part till the end of the ring is returned, the rest is returned after this part
+ * is released.
+ *
+ * @param handle Pointer to flexcan_edma_handle_t structure.
+ * @param frames Pointer to get the address of the frames in the ring.
+ * @param count Pointer to get the number of frames at @p frames.
+ * @retval kStatus_Success Get successfully through the parameters.
+ * @retval kStatus_NoTransferInProgress Rx FIFO streaming is not started.
+ */
+status_t FLEXCAN_TransferGetReceiveFifoRingDataEDMA(flexcan_edma_handle_t *handle,
+                                                    flexcan_frame_t **frames,
+                                                    size_t *count);
+
+/*!
+ * @brief Releases the frames in the frame ring.
+ *
+ * The released frames are used again by the eDMA to receive new frames.
+ *
+ * @param handle Pointer to flexcan_edma_handle_t structure.
+ * @param count Number of frames to release, must not exceed the number of the unreleased frames.
+ */
+void FLEXCAN_TransferReleaseReceiveFifoRingEDMA(flexcan_edma_handle_t *handle, size_t count);
+
+/*@}*/
+
 #if defined(__cplusplus)
 }
 #endif
@@ -105,6 +105,29 @@ static void LPUART_SendEDMACallback(edma_handle_t *handle, void *param, bool tra
  */
 static void LPUART_ReceiveEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
 
+/*!
+ * @brief Updates the eDMA receiver ring buffer state.
+ *
+ * This function gets the current eDMA write position in the ring buffer and adds the bytes received
+ * since the last update to the unreleased bytes.
+ *
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ * @param overrun Pointer to get whether the unreleased data is overwritten and dropped.
+ * @return Number of new bytes, 0 if the unreleased data is dropped.
+ */
+static size_t LPUART_UpdateRxRingBufferEDMA(lpuart_edma_handle_t *handle, bool *overrun);
+
+/*!
+ * @brief LPUART EDMA ring buffer callback function.
+ *
+ * This function is called on the half and major loop interrupts of the RX eDMA channel in ring buffer
+ * mode. It updates the ring buffer so the new bytes are counted before the eDMA wraps twice.
+ *
+ * @param handle The EDMA handle.
+ * @param param Callback function parameter.
+ */
+static void LPUART_RingBufferEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -154,6 +177,72 @@ static void LPUART_ReceiveEDMACallback(edma_handle_t *handle, void *param, bool
     }
 }
 
+static size_t LPUART_UpdateRxRingBufferEDMA(lpuart_edma_handle_t *handle, bool *overrun)
+{
+    size_t head;
+    size_t newBytes;
+    uint32_t remaining;
+    uint32_t primask;
+
+    /* The update is called both in the LPUART and the eDMA interrupts. */
+    primask = DisableGlobalIRQ();
+
+    /*
+     * Read CITER directly, EDMA_GetRemainingMajorLoopCount returns 0 while DONE is set. After the wrap
+     * DONE stays set till the eDMA interrupt clears it, but CITER is already reloaded and counting.
+     */
+    remaining = ((uint32_t)handle->rxEdmaHandle->base->TCD[handle->rxEdmaHandle->channel].CITER_ELINKNO &
+                 DMA_CITER_ELINKNO_CITER_MASK) >>
+                DMA_CITER_ELINKNO_CITER_SHIFT;
+    head = handle->rxRingBufferSize - ((size_t)handle->nbytes * remaining);
+    if (head == handle->rxRingBufferSize)
+    {
+        head = 0U;
+    }
+    newBytes = (head + handle->rxRingBufferSize - handle->rxRingBufferHead) % handle->rxRingBufferSize;
+
+    handle->rxRingBufferHead = head;
+    handle->rxRingBufferUnread += newBytes;
+    *overrun = (handle->rxRingBufferUnread > handle->rxRingBufferSize);
+    if (*overrun)
+    {
+        /* The unreleased data has been overwritten, drop all of it. */
+        handle->rxRingBufferTail   = head;
+        handle->rxRingBufferUnread = 0U;
+        newBytes                   = 0U;
+    }
+
+    EnableGlobalIRQ(primask);
+
+    return newBytes;
+}
+
+static void LPUART_RingBufferEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    assert(NULL != param);
+
+    lpuart_edma_private_handle_t *lpuartPrivateHandle = (lpuart_edma_private_handle_t *)param;
+    bool overrun;
+
+    /* Avoid warning for unused parameters. */
+    tcds = tcds;
+
+    if (transferDone)
+    {
+        /* The channel keeps running, clear DONE so that the remaining major loop count is valid. */
+        EDMA_ClearChannelStatusFlags(handle->base, handle->channel, (uint32_t)kEDMA_DoneFlag);
+    }
+
+    (void)LPUART_UpdateRxRingBufferEDMA(lpuartPrivateHandle->handle, &overrun);
+
+    if (overrun && (NULL != lpuartPrivateHandle->handle->callback))
+    {
+        lpuartPrivateHandle->handle->callback(lpuartPrivateHandle->base, lpuartPrivateHandle->handle,
+                                              kStatus_LPUART_RxRingBufferOverrun,
+                                              lpuartPrivateHandle->handle->userData);
+    }
+}
+
 /*!
  * brief Initializes the LPUART handle which is used in transactional functions.
  * param base LPUART peripheral base address.
@@ -437,3 +526,223 @@ status_t LPUART_TransferGetSendCountEDMA(LPUART_Type *base, lpuart_edma_handle_t
 
     return kStatus_Success;
 }
+
+/*!
+ * brief Starts receiving data into a ring buffer using eDMA.
+ *
+ * This function configures the RX eDMA channel to loop over the ring buffer continuously, the destination
+ * address is rewound after each major loop so the channel never stops. The received data stays in the ring
+ * buffer and is not copied by CPU. The idle line interrupt is enabled, and when the line becomes idle
+ * after a message, the callback is called with ref kStatus_LPUART_IdleLineDetected. Then the new data
+ * can be got with ref LPUART_TransferGetRxRingBufferDataEDMA and released with
+ * ref LPUART_TransferReleaseRxRingBufferEDMA. The half and major loop interrupts of the eDMA channel
+ * are used to track the ring buffer, if the unreleased data is overwritten, the callback is called with
+ * ref kStatus_LPUART_RxRingBufferOverrun and the unreleased data is dropped.
+ *
+ * note The application must call ref LPUART_TransferEdmaHandleIRQ in the LPUART interrupt handler.
+ *       The RX eDMA handle must not use a TCD pool in this mode. The ring buffer size must not exceed
+ *       the eDMA major loop count limit.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ * param ringBuffer Start address of the ring buffer.
+ * param ringBufferSize Size of the ring buffer.
+ * retval kStatus_Success Ring buffer receive is started.
+ * retval kStatus_LPUART_RxBusy Previous receive ongoing.
+ */
+status_t LPUART_TransferStartRingBufferEDMA(LPUART_Type *base,
+                                            lpuart_edma_handle_t *handle,
+                                            uint8_t *ringBuffer,
+                                            size_t ringBufferSize)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxEdmaHandle);
+    assert(NULL == handle->rxEdmaHandle->tcdPool);
+    assert(NULL != ringBuffer);
+    assert(0U != ringBufferSize);
+    assert(ringBufferSize <= (DMA_CITER_ELINKNO_CITER_MASK >> DMA_CITER_ELINKNO_CITER_SHIFT));
+
+    edma_transfer_config_t xferConfig;
+    DMA_Type *edmaBase = handle->rxEdmaHandle->base;
+    uint32_t channel   = handle->rxEdmaHandle->channel;
+
+    if ((uint8_t)kLPUART_RxBusy == handle->rxState)
+    {
+        return kStatus_LPUART_RxBusy;
+    }
+
+    handle->rxState            = (uint8_t)kLPUART_RxBusy;
+    handle->rxRingBuffer       = ringBuffer;
+    handle->rxRingBufferSize   = ringBufferSize;
+    handle->rxRingBufferHead   = 0U;
+    handle->rxRingBufferTail   = 0U;
+    handle->rxRingBufferUnread = 0U;
+    handle->nbytes             = (uint8_t)sizeof(uint8_t);
+
+    EDMA_PrepareTransfer(&xferConfig, (void *)(uint32_t *)LPUART_GetDataRegisterAddress(base), sizeof(uint8_t),
+                         ringBuffer, sizeof(uint8_t), sizeof(uint8_t), ringBufferSize, kEDMA_PeripheralToMemory);
+    EDMA_ResetChannel(edmaBase, channel);
+    EDMA_SetTransferConfig(edmaBase, channel, &xferConfig, NULL);
+    /* Rewind the destination after each major loop and keep the request enabled, so the channel loops forever. */
+    edmaBase->TCD[channel].DLAST_SGA = (uint32_t)(-(int32_t)ringBufferSize);
+    EDMA_EnableAutoStopRequest(edmaBase, channel, false);
+    EDMA_EnableChannelInterrupts(edmaBase, channel,
+                                 (uint32_t)kEDMA_HalfInterruptEnable | (uint32_t)kEDMA_MajorInterruptEnable);
+    EDMA_SetCallback(handle->rxEdmaHandle, LPUART_RingBufferEDMACallback,
+                     &s_lpuartEdmaPrivateHandle[LPUART_GetInstance(base)]);
+
+    /* Clear the stale IDLE flag, then wake up the user on each idle line. */
+    base->STAT |= LPUART_STAT_IDLE_MASK;
+    LPUART_EnableInterrupts(base,
+                            (uint32_t)kLPUART_IdleLineInterruptEnable | (uint32_t)kLPUART_RxOverrunInterruptEnable);
+
+    EDMA_StartTransfer(handle->rxEdmaHandle);
+
+    /* Enable LPUART RX EDMA. */
+    LPUART_EnableRxDMA(base, true);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops receiving data into the ring buffer using eDMA.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ */
+void LPUART_TransferStopRingBufferEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxEdmaHandle);
+
+    LPUART_DisableInterrupts(base,
+                             (uint32_t)kLPUART_IdleLineInterruptEnable | (uint32_t)kLPUART_RxOverrunInterruptEnable);
+
+    LPUART_TransferAbortReceiveEDMA(base, handle);
+
+    /* Restore the callback for the normal receive. */
+    EDMA_SetCallback(handle->rxEdmaHandle, LPUART_ReceiveEDMACallback,
+                     &s_lpuartEdmaPrivateHandle[LPUART_GetInstance(base)]);
+
+    handle->rxRingBuffer       = NULL;
+    handle->rxRingBufferSize   = 0U;
+    handle->rxRingBufferUnread = 0U;
+}
+
+/*!
+ * brief Gets the received data in the ring buffer.
+ *
+ * This function returns the oldest data not released yet. When the data wraps around the end of the
+ * ring buffer, only the part till the end of the ring buffer is returned, the rest is returned after
+ * this part is released.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ * param data Pointer to get the address of the data in the ring buffer.
+ * param count Pointer to get the number of bytes at p data.
+ * retval kStatus_NoTransferInProgress Ring buffer receive is not started.
+ * retval kStatus_Success Get successfully through the parameters.
+ */
+status_t LPUART_TransferGetRxRingBufferDataEDMA(LPUART_Type *base,
+                                                lpuart_edma_handle_t *handle,
+                                                uint8_t **data,
+                                                size_t *count)
+{
+    assert(NULL != handle);
+    assert(NULL != data);
+    assert(NULL != count);
+
+    bool overrun;
+    size_t tail;
+    size_t unread;
+    uint32_t primask;
+
+    if (NULL == handle->rxRingBuffer)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    (void)LPUART_UpdateRxRingBufferEDMA(handle, &overrun);
+
+    primask = DisableGlobalIRQ();
+    tail    = handle->rxRingBufferTail;
+    unread  = handle->rxRingBufferUnread;
+    EnableGlobalIRQ(primask);
+
+    *data  = &handle->rxRingBuffer[tail];
+    *count = MIN(unread, handle->rxRingBufferSize - tail);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Releases the data in the ring buffer.
+ *
+ * The released space is used again by the eDMA to receive new data.
+ *
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ * param count Number of bytes to release, must not exceed the number of the unreleased bytes.
+ */
+void LPUART_TransferReleaseRxRingBufferEDMA(lpuart_edma_handle_t *handle, size_t count)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxRingBuffer);
+
+    uint32_t primask;
+
+    primask = DisableGlobalIRQ();
+    /* The data may have been dropped by an overrun after it was got. */
+    count = MIN(count, handle->rxRingBufferUnread);
+    handle->rxRingBufferTail = (handle->rxRingBufferTail + count) % handle->rxRingBufferSize;
+    handle->rxRingBufferUnread -= count;
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief LPUART eDMA ring buffer IRQ handle function.
+ *
+ * This function handles the LPUART idle line and receiver overrun interrupts in eDMA ring buffer mode.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ */
+void LPUART_TransferEdmaHandleIRQ(LPUART_Type *base, lpuart_edma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    uint32_t status            = LPUART_GetStatusFlags(base);
+    uint32_t enabledInterrupts = LPUART_GetEnabledInterrupts(base);
+    bool overrun;
+
+    /* If RX overrun. */
+    if ((uint32_t)kLPUART_RxOverrunFlag == ((uint32_t)kLPUART_RxOverrunFlag & status))
+    {
+        /* Clear overrun flag, otherwise the RX does not work. */
+        base->STAT = ((base->STAT & 0x3FE00000U) | LPUART_STAT_OR_MASK);
+
+        if (NULL != handle->callback)
+        {
+            handle->callback(base, handle, kStatus_LPUART_RxHardwareOverrun, handle->userData);
+        }
+    }
+
+    /* If IDLE flag is set and the IDLE interrupt is enabled. */
+    if ((0U != ((uint32_t)kLPUART_IdleLineFlag & status)) &&
+        (0U != ((uint32_t)kLPUART_IdleLineInterruptEnable & enabledInterrupts)))
+    {
+        /* Clear IDLE flag.*/
+        base->STAT |= LPUART_STAT_IDLE_MASK;
+
+        if (NULL != handle->rxRingBuffer)
+        {
+            (void)LPUART_UpdateRxRingBufferEDMA(handle, &overrun);
+
+            if (NULL != handle->callback)
+            {
+                handle->callback(base, handle,
+                                 overrun ? kStatus_LPUART_RxRingBufferOverrun : kStatus_LPUART_IdleLineDetected,
+                                 handle->userData);
+            }
+        }
+    }
+}
@@ -22,8 +22,8 @@
 
 /*! @name Driver version */
 /*@{*/
-/*! @brief LPUART EDMA driver version 2.2.7. */
-#define FSL_LPUART_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 2, 7))
+/*! @brief LPUART EDMA driver version 2.2.8. */
+#define FSL_LPUART_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 2, 8))
 /*@}*/
 
 /* Forward declaration of the handle typedef. */
@@ -52,6 +52,12 @@ struct _lpuart_edma_handle
 
     volatile uint8_t txState; /*!< TX transfer state. */
     volatile uint8_t rxState; /*!< RX transfer state */
+
+    uint8_t *rxRingBuffer;              /*!< Start address of the eDMA receiver ring buffer. */
+    size_t rxRingBufferSize;            /*!< Size of the eDMA receiver ring buffer. */
+    volatile size_t rxRingBufferHead;   /*!< Index the eDMA has written to when last checked. */
+    volatile size_t rxRingBufferTail;   /*!< Index of the first byte not released by the user. */
+    volatile size_t rxRingBufferUnread; /*!< Number of received bytes not released by the user. */
 };
 
 /*******************************************************************************
@@ -164,6 +170,88 @@ status_t LPUART_TransferGetReceiveCountEDMA(LPUART_Type *base, lpuart_edma_handl
 
 /*@}*/
 
+/*!
+ * @name eDMA ring buffer
+ * @{
+ */
+
+/*!
+ * @brief Starts receiving data into a ring buffer using eDMA.
+ *
+ * This function configures the RX eDMA channel to loop over the ring buffer continuously, the destination
+ * address is rewound after each major loop so the channel never stops. The received data stays in the ring
+ * buffer and is not copied by CPU. The idle line interrupt is enabled, and when the line becomes idle
+ * after a message, the callback is called with @ref kStatus_LPUART_IdleLineDetected. Then the new data
+ * can be got with @ref LPUART_TransferGetRxRingBufferDataEDMA and released with
+ * @ref LPUART_TransferReleaseRxRingBufferEDMA. The half and major loop interrupts of the eDMA channel
+ * are used to track the ring buffer, if the unreleased data is overwritten, the callback is called with
+ * @ref kStatus_LPUART_RxRingBufferOverrun and the unreleased data is dropped.
+ *
+ * @note The application must call @ref LPUART_TransferEdmaHandleIRQ in the LPUART interrupt handler.
+ *       The RX eDMA handle must not use a TCD pool in this mode. The ring buffer size must not exceed
+ *       the eDMA major loop count limit.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ * @param ringBuffer Start address of the ring buffer.
+ * @param ringBufferSize Size of the ring buffer.
+ * @retval kStatus_Success Ring buffer receive is started.
+ * @retval kStatus_LPUART_RxBusy Previous receive ongoing.
+ */
+status_t LPUART_TransferStartRingBufferEDMA(LPUART_Type *base,
+                                            lpuart_edma_handle_t *handle,
+                                            uint8_t *ringBuffer,
+                                            size_t ringBufferSize);
+
+/*!
+ * @brief Stops receiving data into the ring buffer using eDMA.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ */
+void LPUART_TransferStopRingBufferEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle);
+
+/*!
+ * @brief Gets the received data in the ring buffer.
+ *
+ * This function returns the oldest data not released yet. When the data wraps around the end of the
+ * ring buffer, only the part till the end of the ring buffer is returned, the rest is returned after
+ * this part is released.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ * @param data Pointer to get the address of the data in the ring buffer.
+ * @param count Pointer to get the number of bytes at @p data.
+ * @retval kStatus_NoTransferInProgress Ring buffer receive is not started.
+ * @retval kStatus_Success Get successfully through the parameters.
+ */
+status_t LPUART_TransferGetRxRingBufferDataEDMA(LPUART_Type *base,
+                                                lpuart_edma_handle_t *handle,
+                                                uint8_t **data,
+                                                size_t *count);
+
+/*!
+ * @brief Releases the data in the ring buffer.
+ *
+ * The released space is used again by the eDMA to receive new data.
+ *
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ * @param count Number of bytes to release, must not exceed the number of the unreleased bytes.
+ */
+void LPUART_TransferReleaseRxRingBufferEDMA(lpuart_edma_handle_t *handle, size_t count);
+
+/*!
+ * @brief LPUART eDMA ring buffer IRQ handle function.
+ *
+ * This function handles the LPUART idle line and receiver overrun interrupts in eDMA ring buffer mode.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ */
+void LPUART_TransferEdmaHandleIRQ(LPUART_Type *base, lpuart_edma_handle_t *handle);
+
+/*@}*/
+
 #if defined(__cplusplus)
 }
 #endif
@@ -67,6 +67,32 @@ static void SAI_TxEDMACallback(edma_handle_t *handle, void *userData, bool done,
  */
 static void SAI_RxEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds);
 
+/*!
+ * @brief SAI EDMA callback for the stream.
+ *
+ * @param privHandle pointer to the private handle of the transfer direction.
+ * @param idleStatus The status passed to the user callback when the periods elapsed.
+ * @param xrunStatus The status passed to the user callback when an underrun or overrun occurs.
+ */
+static void SAI_StreamEDMACallback(sai_edma_private_handle_t *privHandle, status_t idleStatus, status_t xrunStatus);
+
+/*!
+ * @brief Chains the TCDs of the stream periods into a loop and starts the eDMA.
+ *
+ * @param handle SAI eDMA handle pointer.
+ * @param periods Array of the period buffers.
+ * @param periodNum Number of the period buffers.
+ * @param fifoAddr Address of the SAI data register.
+ * @param type The eDMA transfer type.
+ * @retval kStatus_Success The eDMA is started.
+ * @retval kStatus_InvalidArgument The input argument is invalid.
+ */
+static status_t SAI_StartStreamEDMA(sai_edma_handle_t *handle,
+                                    sai_transfer_t *periods,
+                                    uint8_t periodNum,
+                                    uint32_t fifoAddr,
+                                    edma_transfer_type_t type);
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -93,6 +119,12 @@ static void SAI_TxEDMACallback(edma_handle_t *handle, void *userData, bool done,
     sai_edma_private_handle_t *privHandle = (sai_edma_private_handle_t *)userData;
     sai_edma_handle_t *saiHandle          = privHandle->handle;
 
+    if (saiHandle->streamPeriods != NULL)
+    {
+        SAI_StreamEDMACallback(privHandle, kStatus_SAI_TxIdle, kStatus_SAI_TxError);
+        return;
+    }
+
     /* If finished a block, call the callback function */
     memset(&saiHandle->saiQueue[saiHandle->queueDriver], 0, sizeof(sai_transfer_t));
     saiHandle->queueDriver = (saiHandle->queueDriver + 1) % SAI_XFER_QUEUE_SIZE;
@@ -115,6 +147,12 @@ static void SAI_RxEDMACallback(edma_handle_t *handle, void *userData, bool done,
     sai_edma_private_handle_t *privHandle = (sai_edma_private_handle_t *)userData;
     sai_edma_handle_t *saiHandle          = privHandle->handle;
 
+    if (saiHandle->streamPeriods != NULL)
+    {
+        SAI_StreamEDMACallback(privHandle, kStatus_SAI_RxIdle, kStatus_SAI_RxError);
+        return;
+    }
+
     /* If finished a block, call the callback function */
     memset(&saiHandle->saiQueue[saiHandle->queueDriver], 0, sizeof(sai_transfer_t));
     saiHandle->queueDriver = (saiHandle->queueDriver + 1) % SAI_XFER_QUEUE_SIZE;
@@ -132,6 +170,108 @@ static void SAI_RxEDMACallback(edma_handle_t *handle, void *userData, bool done,
     }
 }
 
+static void SAI_StreamEDMACallback(sai_edma_private_handle_t *privHandle, status_t idleStatus, status_t xrunStatus)
+{
+    sai_edma_handle_t *saiHandle = privHandle->handle;
+    edma_handle_t *dmaHandle     = saiHandle->dmaHandle;
+    uint32_t sga                 = dmaHandle->base->TCD[dmaHandle->channel].DLAST_SGA;
+    uint32_t periodNum           = saiHandle->streamPeriodNum;
+    status_t status              = idleStatus;
+    uint32_t period;
+
+    /* The period being transferred is the one before the next TCD to be loaded. */
+    period = (((sga - (uint32_t)STCD_ADDR(saiHandle->tcd)) / sizeof(edma_tcd_t)) + periodNum - 1U) % periodNum;
+
+    while (saiHandle->streamPeriod != period)
+    {
+        saiHandle->streamPeriod = (uint8_t)((saiHandle->streamPeriod + 1U) % periodNum);
+        saiHandle->streamPeriodCount++;
+
+        /* The elapsed period is owned by the application. */
+        if (saiHandle->streamUserPeriodNum < periodNum)
+        {
+            saiHandle->streamUserPeriodNum++;
+        }
+
+        /* All the periods are owned by the application, the period being transferred is not released. */
+        if (saiHandle->streamUserPeriodNum == periodNum)
+        {
+            saiHandle->streamXrunCount++;
+            status = xrunStatus;
+        }
+    }
+
+    if (saiHandle->callback)
+    {
+        (saiHandle->callback)(privHandle->base, saiHandle, status, saiHandle->userData);
+    }
+}
+
+static status_t SAI_StartStreamEDMA(sai_edma_handle_t *handle,
+                                    sai_transfer_t *periods,
+                                    uint8_t periodNum,
+                                    uint32_t fifoAddr,
+                                    edma_transfer_type_t type)
+{
+    edma_transfer_config_t config = {0};
+    edma_tcd_t *tcd               = STCD_ADDR(handle->tcd);
+    uint32_t i;
+
+    /* Check if input parameter invalid */
+    if ((periodNum < 2U) || (periodNum > SAI_XFER_QUEUE_SIZE))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Store the initially configured eDMA minor byte transfer count into the SAI handle */
+    handle->nbytes = handle->count * handle->bytesPerFrame;
+
+    for (i = 0U; i < periodNum; i++)
+    {
+        if ((periods[i].data == NULL) || (periods[i].dataSize == 0U) || ((periods[i].dataSize % handle->nbytes) != 0U))
+        {
+            return kStatus_InvalidArgument;
+        }
+    }
+
+    for (i = 0U; i < periodNum; i++)
+    {
+        if (type == kEDMA_MemoryToPeripheral)
+        {
+            EDMA_PrepareTransfer(&config, periods[i].data, handle->bytesPerFrame, (void *)fifoAddr,
+                                 handle->bytesPerFrame, handle->nbytes, periods[i].dataSize, type);
+        }
+        else
+        {
+            EDMA_PrepareTransfer(&config, (void *)fifoAddr, handle->bytesPerFrame, periods[i].data,
+                                 handle->bytesPerFrame, handle->nbytes, periods[i].dataSize, type);
+        }
+
+        /* The last period is chained to the first one, so the eDMA loops over the periods. */
+        EDMA_TcdReset(&tcd[i]);
+        EDMA_TcdSetTransferConfig(&tcd[i], &config, &tcd[(i + 1U) % periodNum]);
+        EDMA_TcdEnableInterrupts(&tcd[i], (uint32_t)kEDMA_MajorInterruptEnable);
+    }
+
+    handle->streamPeriods       = periods;
+    handle->streamPeriodNum     = periodNum;
+    handle->streamPeriod        = 0U;
+    handle->streamUserPeriod    = 0U;
+    handle->streamUserPeriodNum = 0U;
+    handle->streamPeriodCount   = 0U;
+    handle->streamXrunCount     = 0U;
+    handle->state               = kSAI_Busy;
+
+    /* The TCD queue of the eDMA handle is not used, the TCDs are chained by the driver. */
+    handle->dmaHandle->tcdPool = NULL;
+    EDMA_InstallTCD(handle->dmaHandle->base, handle->dmaHandle->channel, &tcd[0]);
+
+    /* Start DMA transfer */
+    EDMA_StartTransfer(handle->dmaHandle);
+
+    return kStatus_Success;
+}
+
 /*!
  * brief Initializes the SAI eDMA handle.
  *
@@ -409,6 +549,12 @@ status_t SAI_TransferSendEDMA(I2S_Type *base, sai_edma_handle_t *handle, sai_tra
         return kStatus_InvalidArgument;
     }
 
+    /* A running period stream owns the channel and its TCD chain */
+    if (handle->streamPeriods != NULL)
+    {
+        return kStatus_SAI_TxBusy;
+    }
+
     if (handle->saiQueue[handle->queueUser].data)
     {
         return kStatus_SAI_QueueFull;
@@ -473,6 +619,12 @@ status_t SAI_TransferReceiveEDMA(I2S_Type *base, sai_edma_handle_t *handle, sai_
         return kStatus_InvalidArgument;
     }
 
+    /* A running period stream owns the channel and its TCD chain */
+    if (handle->streamPeriods != NULL)
+    {
+        return kStatus_SAI_RxBusy;
+    }
+
     if (handle->saiQueue[handle->queueUser].data)
     {
         return kStatus_SAI_QueueFull;
@@ -690,3 +842,215 @@ status_t SAI_TransferGetReceiveCountEDMA(I2S_Type *base, sai_edma_handle_t *hand
 
     return status;
 }
+
+/*!
+ * brief Starts sending a continuous stream over a ring of period buffers using eDMA.
+ *
+ * The TCDs of the periods are chained with scatter/gather into a loop, so the eDMA sends the periods in order
+ * indefinitely without the callback refilling the transfer queue. The callback is called with
+ * kStatus_SAI_TxIdle after each period is sent, the sent periods are owned by the application, see
+ * ref SAI_TransferGetStreamPeriodEDMA and ref SAI_TransferReleaseStreamPeriodEDMA. If the eDMA starts a
+ * period which is not released yet, the period is sent again and counted as an underrun, the callback is called
+ * with kStatus_SAI_TxError instead.
+ *
+ * note All the periods should be filled before this function. The periods use the TCD pool of the handle, so
+ *       the number of periods is up to SAI_XFER_QUEUE_SIZE, which can be defined larger for small periods. The
+ *       period buffers must be kept until the stream is stopped.
+ *
+ * param base SAI base pointer.
+ * param handle SAI eDMA handle pointer.
+ * param periods Array of the period buffers, dataSize should be multiple of the eDMA minor loop size.
+ * param periodNum Number of the period buffers, 2 ~ SAI_XFER_QUEUE_SIZE.
+ * retval kStatus_Success The stream is started.
+ * retval kStatus_InvalidArgument The input argument is invalid.
+ * retval kStatus_SAI_TxBusy SAI is busy sending data.
+ */
+status_t SAI_TransferStartSendStreamEDMA(I2S_Type *base,
+                                         sai_edma_handle_t *handle,
+                                         sai_transfer_t *periods,
+                                         uint8_t periodNum)
+{
+    assert(handle && periods);
+
+    status_t status;
+
+    if ((handle->streamPeriods != NULL) || (handle->saiQueue[handle->queueDriver].data != NULL))
+    {
+        return kStatus_SAI_TxBusy;
+    }
+
+    status = SAI_StartStreamEDMA(handle, periods, periodNum, SAI_TxGetDataRegisterAddress(base, handle->channel),
+                                 kEDMA_MemoryToPeripheral);
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+
+    /* Enable DMA enable bit */
+    SAI_TxEnableDMA(base, kSAI_FIFORequestDMAEnable, true);
+
+    /* Enable SAI Tx clock */
+    SAI_TxEnable(base, true);
+
+    /* Enable the channel FIFO */
+    base->TCR3 |= I2S_TCR3_TCE(1U << handle->channel);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Starts receiving a continuous stream over a ring of period buffers using eDMA.
+ *
+ * The TCDs of the periods are chained with scatter/gather into a loop, so the eDMA receives the periods in order
+ * indefinitely without the callback refilling the transfer queue. The callback is called with
+ * kStatus_SAI_RxIdle after each period is received, the received periods are owned by the application, see
+ * ref SAI_TransferGetStreamPeriodEDMA and ref SAI_TransferReleaseStreamPeriodEDMA. If the eDMA starts a
+ * period which is not released yet, the period is overwritten and counted as an overrun, the callback is called
+ * with kStatus_SAI_RxError instead.
+ *
+ * note The periods use the TCD pool of the handle, so the number of periods is up to SAI_XFER_QUEUE_SIZE,
+ *       which can be defined larger for small periods. The period buffers must be kept until the stream is
+ *       stopped.
+ *
+ * param base SAI base pointer.
+ * param handle SAI eDMA handle pointer.
+ * param periods Array of the period buffers, dataSize should be multiple of the eDMA minor loop size.
+ * param periodNum Number of the period buffers, 2 ~ SAI_XFER_QUEUE_SIZE.
+ * retval kStatus_Success The stream is started.
+ * retval kStatus_InvalidArgument The input argument is invalid.
+ * retval kStatus_SAI_RxBusy SAI is busy receiving data.
+ */
+status_t SAI_TransferStartReceiveStreamEDMA(I2S_Type *base,
+                                            sai_edma_handle_t *handle,
+                                            sai_transfer_t *periods,
+                                            uint8_t periodNum)
+{
+    assert(handle && periods);
+
+    status_t status;
+
+    if ((handle->streamPeriods != NULL) || (handle->saiQueue[handle->queueDriver].data != NULL))
+    {
+        return kStatus_SAI_RxBusy;
+    }
+
+    status = SAI_StartStreamEDMA(handle, periods, periodNum, SAI_RxGetDataRegisterAddress(base, handle->channel),
+                                 kEDMA_PeripheralToMemory);
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+
+    /* Enable DMA enable bit */
+    SAI_RxEnableDMA(base, kSAI_FIFORequestDMAEnable, true);
+
+    /* Enable the channel FIFO */
+    base->RCR3 |= I2S_RCR3_RCE(1U << handle->channel);
+
+    /* Enable SAI Rx clock */
+    SAI_RxEnable(base, true);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops sending the stream using eDMA.
+ *
+ * param base SAI base pointer.
+ * param handle SAI eDMA handle pointer.
+ */
+void SAI_TransferStopSendStreamEDMA(I2S_Type *base, sai_edma_handle_t *handle)
+{
+    assert(handle);
+
+    SAI_TransferTerminateSendEDMA(base, handle);
+
+    /* Give the TCD pool back to the eDMA handle for the transfer queue. */
+    EDMA_InstallTCDMemory(handle->dmaHandle, STCD_ADDR(handle->tcd), SAI_XFER_QUEUE_SIZE);
+    handle->streamPeriods = NULL;
+}
+
+/*!
+ * brief Stops receiving the stream using eDMA.
+ *
+ * param base SAI base pointer.
+ * param handle SAI eDMA handle pointer.
+ */
+void SAI_TransferStopReceiveStreamEDMA(I2S_Type *base, sai_edma_handle_t *handle)
+{
+    assert(handle);
+
+    SAI_TransferTerminateReceiveEDMA(base, handle);
+
+    /* Give the TCD pool back to the eDMA handle for the transfer queue. */
+    EDMA_InstallTCDMemory(handle->dmaHandle, STCD_ADDR(handle->tcd), SAI_XFER_QUEUE_SIZE);
+    handle->streamPeriods = NULL;
+}
+
+/*!
+ * brief Gets the oldest period owned by the application.
+ *
+ * For send, the period should be refilled, for receive, the period data should be consumed, then the period is
+ * released with ref SAI_TransferReleaseStreamPeriodEDMA.
+ *
+ * param handle SAI eDMA handle pointer.
+ * param periodIndex Index of the period in the period buffers array.
+ * retval kStatus_Success The period is got.
+ * retval kStatus_NoTransferInProgress No period is owned by the application or the stream is not started.
+ */
+status_t SAI_TransferGetStreamPeriodEDMA(sai_edma_handle_t *handle, uint8_t *periodIndex)
+{
+    assert(handle && periodIndex);
+
+    if ((handle->streamPeriods == NULL) || (handle->streamUserPeriodNum == 0U))
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    *periodIndex = handle->streamUserPeriod;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Releases the oldest period owned by the application to the eDMA.
+ *
+ * param handle SAI eDMA handle pointer.
+ */
+void SAI_TransferReleaseStreamPeriodEDMA(sai_edma_handle_t *handle)
+{
+    assert(handle);
+
+    uint32_t primask;
+
+    /* The number of the periods owned by the application is also updated in the eDMA callback. */
+    primask = DisableGlobalIRQ();
+    if (handle->streamUserPeriodNum != 0U)
+    {
+        handle->streamUserPeriod = (uint8_t)((handle->streamUserPeriod + 1U) % handle->streamPeriodNum);
+        handle->streamUserPeriodNum--;
+    }
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief Gets the stream counters.
+ *
+ * param handle SAI eDMA handle pointer.
+ * param periodCount Number of the elapsed periods, can be NULL.
+ * param xrunCount Number of the underrun (Tx) or overrun (Rx) periods, can be NULL.
+ */
+void SAI_TransferGetStreamCountEDMA(sai_edma_handle_t *handle, uint32_t *periodCount, uint32_t *xrunCount)
+{
+    assert(handle);
+
+    if (periodCount != NULL)
+    {
+        *periodCount = handle->streamPeriodCount;
+    }
+
+    if (xrunCount != NULL)
+    {
+        *xrunCount = handle->streamXrunCount;
+    }
+}
@@ -22,7 +22,7 @@
 
 /*! @name Driver version */
 /*@{*/
-#define FSL_SAI_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 2, 0)) /*!< Version 2.2.0 */
+#define FSL_SAI_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 2, 1)) /*!< Version 2.2.1 */
 /*@}*/
 
 typedef struct _sai_edma_handle sai_edma_handle_t;
@@ -46,6 +46,14 @@ struct _sai_edma_handle
     size_t transferSize[SAI_XFER_QUEUE_SIZE];                     /*!< Data bytes need to transfer */
     volatile uint8_t queueUser;                                   /*!< Index for user to queue transfer. */
     volatile uint8_t queueDriver; /*!< Index for driver to get the transfer data and size */
+    sai_transfer_t *streamPeriods;        /*!< Period buffers of the stream, NULL if not streaming. */
+    uint8_t streamPeriodNum;              /*!< Number of the period buffers. */
+    volatile uint8_t streamPeriod;        /*!< Index of the period the eDMA is transferring. */
+    volatile uint8_t streamUserPeriod;    /*!< Index of the oldest period owned by the application. */
+    volatile uint8_t streamUserPeriodNum; /*!< Number of the periods owned by the application. */
+    volatile uint32_t streamPeriodCount;  /*!< Number of the elapsed periods. */
+    volatile uint32_t streamXrunCount;    /*!< Number of the periods transferred again before the application
+                                               refills (Tx) or consumes (Rx) them. */
 };
 
 /*******************************************************************************
@@ -252,6 +260,112 @@ status_t SAI_TransferGetReceiveCountEDMA(I2S_Type *base, sai_edma_handle_t *hand
 
 /*! @} */
 
+/*!
+ * @name eDMA streaming
+ * @{
+ */
+
+/*!
+ * @brief Starts sending a continuous stream over a ring of period buffers using eDMA.
+ *
+ * The TCDs of the periods are chained with scatter/gather into a loop, so the eDMA sends the periods in order
+ * indefinitely without the callback refilling the transfer queue. The callback is called with
+ * kStatus_SAI_TxIdle after each period is sent, the sent periods are owned by the application, see
+ * @ref SAI_TransferGetStreamPeriodEDMA and @ref SAI_TransferReleaseStreamPeriodEDMA. If the eDMA starts a
+ * period which is not released yet, the period is sent again and counted as an underrun, the callback is called
+ * with kStatus_SAI_TxError instead.
+ *
+ * @note All the periods should be filled before this function. The periods use the TCD pool of the handle, so
+ *       the number of periods is up to SAI_XFER_QUEUE_SIZE, which can be defined larger for small periods. The
+ *       period buffers must be kept until the stream is stopped.
+ *
+ * @param base SAI base pointer.
+ * @param handle SAI eDMA handle pointer.
+ * @param periods Array of the period buffers, dataSize should be multiple of the eDMA minor loop size.
+ * @param periodNum Number of the period buffers, 2 ~ SAI_XFER_QUEUE_SIZE.
+ * @retval kStatus_Success The stream is started.
+ * @retval kStatus_InvalidArgument The input argument is invalid.
+ * @retval kStatus_SAI_TxBusy SAI is busy sending data.
+ */
+status_t SAI_TransferStartSendStreamEDMA(I2S_Type *base,
+                                         sai_edma_handle_t *handle,
+                                         sai_transfer_t *periods,
+                                         uint8_t periodNum);
+
+/*!
+ * @brief Starts receiving a continuous stream over a ring of period buffers using eDMA.
+ *
+ * The TCDs of the periods are chained with scatter/gather into a loop, so the eDMA receives the periods in order
+ * indefinitely without the callback refilling the transfer queue. The callback is called with
+ * kStatus_SAI_RxIdle after each period is received, the received periods are owned by the application, see
+ * @ref SAI_TransferGetStreamPeriodEDMA and @ref SAI_TransferReleaseStreamPeriodEDMA. If the eDMA starts a
+ * period which is not released yet, the period is overwritten and counted as an overrun, the callback is called
+ * with kStatus_SAI_RxError instead.
+ *
+ * @note The periods use the TCD pool of the handle, so the number of periods is up to SAI_XFER_QUEUE_SIZE,
+ *       which can be defined larger for small periods. The period buffers must be kept until the stream is
+ *       stopped.
+ *
+ * @param base SAI base pointer.
+ * @param handle SAI eDMA handle pointer.
+ * @param periods Array of the period buffers, dataSize should be multiple of the eDMA minor loop size.
+ * @param periodNum Number of the period buffers, 2 ~ SAI_XFER_QUEUE_SIZE.
+ * @retval kStatus_Success The stream is started.
+ * @retval kStatus_InvalidArgument The input argument is invalid.
+ * @retval kStatus_SAI_RxBusy SAI is busy receiving data.
+ */
+status_t SAI_TransferStartReceiveStreamEDMA(I2S_Type *base,
+                                            sai_edma_handle_t *handle,
+                                            sai_transfer_t *periods,
+                                            uint8_t periodNum);
+
+/*!
+ * @brief Stops sending the stream using eDMA.
+ *
+ * @param base SAI base pointer.
+ * @param handle SAI eDMA handle pointer.
+ */
+void SAI_TransferStopSendStreamEDMA(I2S_Type *base, sai_edma_handle_t *handle);
+
+/*!
+ * @brief Stops receiving the stream using eDMA.
+ *
+ * @param base SAI base pointer.
+ * @param handle SAI eDMA handle pointer.
+ */
+void SAI_TransferStopReceiveStreamEDMA(I2S_Type *base, sai_edma_handle_t *handle);
+
+/*!
+ * @brief Gets the oldest period owned by the application.
+ *
+ * For send, the period should be refilled, for receive, the period data should be consumed, then the period is
+ * released with @ref SAI_TransferReleaseStreamPeriodEDMA.
+ *
+ * @param handle SAI eDMA handle pointer.
+ * @param periodIndex Index of the period in the period buffers array.
+ * @retval kStatus_Success The period is got.
+ * @retval kStatus_NoTransferInProgress No period is owned by the application or the stream is not started.
+ */
+status_t SAI_TransferGetStreamPeriodEDMA(sai_edma_handle_t *handle, uint8_t *periodIndex);
+
+/*!
+ * @brief Releases the oldest period owned by the application to the eDMA.
+ *
+ * @param handle SAI eDMA handle pointer.
+ */
+void SAI_TransferReleaseStreamPeriodEDMA(sai_edma_handle_t *handle);
+
+/*!
+ * @brief Gets the stream counters.
+ *
+ * @param handle SAI eDMA handle pointer.
+ * @param periodCount Number of the elapsed periods, can be NULL.
+ * @param xrunCount Number of the underrun (Tx) or overrun (Rx) periods, can be NULL.
+ */
+void SAI_TransferGetStreamCountEDMA(sai_edma_handle_t *handle, uint32_t *periodCount, uint32_t *xrunCount);
+
+/*! @} */
+
 #if defined(__cplusplus)
 }
 #endif
@@ -1759,4 +1759,334 @@ status_t TRNG_GetRandomData(TRNG_Type *base, void *data, size_t dataSize)
     return result;
 }
 
+/*!
+ * @brief Increments the DRBG V, a big endian 128-bit counter.
+ */
+static void trng_DrbgIncrement(uint8_t *v)
+{
+    int i = 15;
+
+    do
+    {
+        v[i]++;
+    } while ((v[i] == 0u) && (--i >= 0));
+}
+
+/*!
+ * @brief CTR_DRBG update function.
+ *
+ * Generates TRNG_DRBG_SEED_SIZE bytes of the key stream, XORs them with the provided data
+ * and uses them as the new Key and V.
+ */
+static status_t trng_DrbgUpdate(trng_drbg_handle_t *handle, const uint8_t *providedData)
+{
+    uint8_t temp[TRNG_DRBG_SEED_SIZE];
+    status_t result = kStatus_Success;
+    uint32_t i;
+
+    for (i = 0U; (i < TRNG_DRBG_SEED_SIZE) && (kStatus_Success == result); i += 16U)
+    {
+        trng_DrbgIncrement(handle->v);
+        result = handle->aes(handle->aesData, handle->key, handle->v, &temp[i]);
+    }
+
+    if (kStatus_Success == result)
+    {
+        for (i = 0U; i < TRNG_DRBG_SEED_SIZE; i++)
+        {
+            temp[i] ^= providedData[i];
+        }
+        (void)memcpy(handle->key, &temp[0], 16U);
+        (void)memcpy(handle->v, &temp[16], 16U);
+    }
+
+    (void)memset(temp, 0, sizeof(temp));
+
+    return result;
+}
+
+/*!
+ * @brief Builds the CTR_DRBG seed material, the entropy XOR the input padded with zeros.
+ */
+static void trng_DrbgSeedMaterial(uint8_t *seed, const uint8_t *entropy, const uint8_t *input, size_t inputSize)
+{
+    uint32_t i;
+
+    for (i = 0U; i < TRNG_DRBG_SEED_SIZE; i++)
+    {
+        seed[i] = (NULL != entropy) ? entropy[i] : 0U;
+        if (i < inputSize)
+        {
+            seed[i] ^= input[i];
+        }
+    }
+}
+
+/*!
+ * @brief Starts the prefetch of the entropy for the next reseed.
+ */
+static void trng_DrbgStartPrefetch(trng_drbg_handle_t *handle)
+{
+    handle->entropyValid = false;
+    handle->base->INT_MASK |= TRNG_INT_MASK_ENT_VAL_MASK;
+}
+
+/*!
+ * @brief Gets the entropy of a reseed, the prefetched one or the one read by polling.
+ */
+static status_t trng_DrbgGetEntropy(trng_drbg_handle_t *handle, uint8_t *entropy)
+{
+    status_t result = kStatus_Success;
+
+    /* The interrupt must not take the entropy read here. */
+    handle->base->INT_MASK &= ~TRNG_INT_MASK_ENT_VAL_MASK;
+
+    if (handle->entropyValid)
+    {
+        (void)memcpy(entropy, handle->entropy, TRNG_DRBG_SEED_SIZE);
+    }
+    else
+    {
+        result = TRNG_GetRandomData(handle->base, entropy, TRNG_DRBG_SEED_SIZE);
+    }
+
+    (void)memset(handle->entropy, 0, sizeof(handle->entropy));
+    trng_DrbgStartPrefetch(handle);
+
+    return result;
+}
+
+/*!
+ * brief Instantiates the CTR_DRBG.
+ *
+ * This function instantiates a NIST SP 800-90A CTR_DRBG, AES-128 without derivation function, seeded
+ * by the TRNG entropy, and starts to prefetch the entropy of the next reseed. The entropy is prefetched
+ * in TRNG_DRBG_IRQHandler(), which must be called from the TRNG interrupt handler, so the reseed does
+ * not wait for the entropy generation. The TRNG must be initialized by TRNG_Init() before, and it must
+ * not be read by TRNG_GetRandomData() while the DRBG is instantiated.
+ *
+ * param base  TRNG base address.
+ * param handle  DRBG handle.
+ * param aes  AES-128 block cipher function.
+ * param aesData  Parameter of the block cipher function.
+ * param personalization  Personalization string, can be NULL.
+ * param personalizationSize  Size of the personalization string, up to TRNG_DRBG_SEED_SIZE bytes.
+ * return If successful, returns the kStatus_Success. Otherwise, it returns an error.
+ */
+status_t TRNG_DRBG_Init(TRNG_Type *base,
+                        trng_drbg_handle_t *handle,
+                        trng_drbg_aes_t aes,
+                        void *aesData,
+                        const uint8_t *personalization,
+                        size_t personalizationSize)
+{
+    uint8_t seed[TRNG_DRBG_SEED_SIZE];
+    status_t result;
+
+    /* Check input parameters.*/
+    if ((NULL == base) || (NULL == handle) || (NULL == aes) || (personalizationSize > TRNG_DRBG_SEED_SIZE) ||
+        ((NULL == personalization) && (0U != personalizationSize)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base    = base;
+    handle->aes     = aes;
+    handle->aesData = aesData;
+
+    /* Key and V are zero, the seed material is the entropy XOR the personalization string. */
+    result = trng_DrbgGetEntropy(handle, seed);
+    if (kStatus_Success == result)
+    {
+        trng_DrbgSeedMaterial(seed, seed, personalization, personalizationSize);
+        result                = trng_DrbgUpdate(handle, seed);
+        handle->reseedCounter = 1U;
+    }
+
+    (void)memset(seed, 0, sizeof(seed));
+
+    return result;
+}
+
+/*!
+ * brief Reseeds the CTR_DRBG.
+ *
+ * The prefetched entropy is used if it is ready, otherwise this function waits for the TRNG entropy.
+ *
+ * param handle  DRBG handle.
+ * param additional  Additional input, can be NULL.
+ * param additionalSize  Size of the additional input, up to TRNG_DRBG_SEED_SIZE bytes.
+ * return If successful, returns the kStatus_Success. Otherwise, it returns an error.
+ */
+status_t TRNG_DRBG_Reseed(trng_drbg_handle_t *handle, const uint8_t *additional, size_t additionalSize)
+{
+    uint8_t seed[TRNG_DRBG_SEED_SIZE];
+    status_t result;
+
+    /* Check input parameters.*/
+    if ((NULL == handle) || (additionalSize > TRNG_DRBG_SEED_SIZE) || ((NULL == additional) && (0U != additionalSize)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    result = trng_DrbgGetEntropy(handle, seed);
+    if (kStatus_Success == result)
+    {
+        trng_DrbgSeedMaterial(seed, seed, additional, additionalSize);
+        result                = trng_DrbgUpdate(handle, seed);
+        handle->reseedCounter = 1U;
+    }
+
+    (void)memset(seed, 0, sizeof(seed));
+
+    return result;
+}
+
+/*!
+ * brief Gets random data from the CTR_DRBG.
+ *
+ * The DRBG is reseeded first when TRNG_DRBG_RESEED_INTERVAL requests were served since the last reseed.
+ * Requests larger than TRNG_DRBG_MAX_REQUEST_SIZE bytes are split.
+ *
+ * param handle  DRBG handle.
+ * param data  Pointer address used to store random data.
+ * param dataSize  Size of the buffer pointed by the data parameter.
+ * param additional  Additional input, can be NULL.
+ * param additionalSize  Size of the additional input, up to TRNG_DRBG_SEED_SIZE bytes.
+ * return If successful, returns the kStatus_Success. Otherwise, it returns an error.
+ */
+status_t TRNG_DRBG_GetRandomData(
+    trng_drbg_handle_t *handle, void *data, size_t dataSize, const uint8_t *additional, size_t additionalSize)
+{
+    uint8_t input[TRNG_DRBG_SEED_SIZE];
+    uint8_t block[16];
+    uint8_t *data_p = (uint8_t *)data;
+    status_t result = kStatus_Success;
+    size_t requestSize;
+    size_t blockSize;
+
+    /* Check input parameters.*/
+    if ((NULL == handle) || (NULL == data) || (0U == dataSize) || (additionalSize > TRNG_DRBG_SEED_SIZE) ||
+        ((NULL == additional) && (0U != additionalSize)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    do
+    {
+        if (handle->reseedCounter > TRNG_DRBG_RESEED_INTERVAL)
+        {
+            /* The additional input is used by the reseed, then it is not used by the generate. */
+            result         = TRNG_DRBG_Reseed(handle, additional, additionalSize);
+            additionalSize = 0U;
+            if (kStatus_Success != result)
+            {
+                break;
+            }
+        }
+
+        trng_DrbgSeedMaterial(input, NULL, additional, additionalSize);
+        if (0U != additionalSize)
+        {
+            result = trng_DrbgUpdate(handle, input);
+            if (kStatus_Success != result)
+            {
+                break;
+            }
+        }
+
+        requestSize = (dataSize < TRNG_DRBG_MAX_REQUEST_SIZE) ? dataSize : TRNG_DRBG_MAX_REQUEST_SIZE;
+        dataSize -= requestSize;
+
+        while ((requestSize > 0U) && (kStatus_Success == result))
+        {
+            trng_DrbgIncrement(handle->v);
+            blockSize = (requestSize < 16U) ? requestSize : 16U;
+            if (blockSize == 16U)
+            {
+                result = handle->aes(handle->aesData, handle->key, handle->v, data_p);
+            }
+            else
+            {
+                result = handle->aes(handle->aesData, handle->key, handle->v, block);
+                (void)memcpy(data_p, block, blockSize);
+            }
+            data_p += blockSize;
+            requestSize -= blockSize;
+        }
+
+        if (kStatus_Success == result)
+        {
+            result = trng_DrbgUpdate(handle, input);
+            handle->reseedCounter++;
+        }
+
+        /* A split request is served with the additional input of its first part only. */
+        additionalSize = 0U;
+    } while ((dataSize > 0U) && (kStatus_Success == result));
+
+    (void)memset(input, 0, sizeof(input));
+    (void)memset(block, 0, sizeof(block));
+
+    return result;
+}
+
+/*!
+ * brief Uninstantiates the CTR_DRBG.
+ *
+ * Stops the entropy prefetch and clears the DRBG state.
+ *
+ * param handle  DRBG handle.
+ */
+void TRNG_DRBG_Deinit(trng_drbg_handle_t *handle)
+{
+    if (NULL != handle)
+    {
+        if (NULL != handle->base)
+        {
+            handle->base->INT_MASK &= ~TRNG_INT_MASK_ENT_VAL_MASK;
+        }
+        (void)memset(handle, 0, sizeof(*handle));
+    }
+}
+
+/*!
+ * brief TRNG DRBG interrupt handler.
+ *
+ * Reads the entropy generated for the next reseed and masks the TRNG interrupt till the entropy is used.
+ *
+ * param handle  DRBG handle.
+ */
+void TRNG_DRBG_IRQHandler(trng_drbg_handle_t *handle)
+{
+    TRNG_Type *base = handle->base;
+    uint32_t i;
+
+    if (0U != TRNG_RD_MCTL_ERR(base))
+    {
+        /* Clear error. The next reseed reads the entropy by polling and reports the error. */
+        TRNG_WR_MCTL_ERR(base, 1);
+        base->INT_MASK &= ~TRNG_INT_MASK_ENT_VAL_MASK;
+    }
+    else if (0U != TRNG_RD_MCTL_ENT_VAL(base))
+    {
+        for (i = 0U; i < (TRNG_DRBG_SEED_SIZE / sizeof(uint32_t)); i++)
+        {
+            handle->entropy[i] = trng_ReadEntropy(base, i);
+        }
+
+        /* Start a new entropy generation.
+        It is done by reading of the last entropy register.*/
+        (void)trng_ReadEntropy(base, (TRNG_ENT_COUNT - 1u));
+
+        handle->entropyValid = true;
+        base->INT_MASK &= ~TRNG_INT_MASK_ENT_VAL_MASK;
+    }
+    else
+    {
+        /* Entropy generation in progress. */
+    }
+}
+
 #endif /* FSL_FEATURE_SOC_TRNG_COUNT */
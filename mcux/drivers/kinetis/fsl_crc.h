@@ -22,15 +22,17 @@
 
 /*! @name Driver version */
 /*@{*/
-/*! @brief CRC driver version. Version 2.0.1.
+/*! @brief CRC driver version. Version 2.0.2.
  *
- * Current version: 2.0.1
+ * Current version: 2.0.2
  *
  * Change log:
+ * - Version 2.0.2
+ *   - add software CRC engine, used as the CRC module on parts without it
  * - Version 2.0.1
  *   - move DATA and DATALL macro definition from header file to source file
  */
-#define FSL_CRC_DRIVER_VERSION (MAKE_VERSION(2, 0, 1))
+#define FSL_CRC_DRIVER_VERSION (MAKE_VERSION(2, 0, 2))
 /*@}*/
 
 #ifndef CRC_DRIVER_CUSTOM_DEFAULTS
@@ -38,6 +40,14 @@
 #define CRC_DRIVER_USE_CRC16_CCIT_FALSE_AS_DEFAULT 1
 #endif
 
+#ifndef CRC_DRIVER_SOFTWARE_USE_TABLES
+/*! @brief Use slice-by-8 tables in the software CRC engine for CRC-16-CCITT and CRC-32 protocols.
+ *
+ * The tables take 12 KB of the flash. If it is 0, all the protocols are computed bit by bit.
+ */
+#define CRC_DRIVER_SOFTWARE_USE_TABLES 1
+#endif
+
 /*! @brief CRC bit width */
 typedef enum _crc_bits
 {
@@ -75,6 +85,29 @@ typedef struct _crc_config
                                 CRC_Get32bitResult() */
 } crc_config_t;
 
+/*!
+ * @brief CRC software engine.
+ *
+ * This structure holds the state of the software CRC engine. On parts without the CRC module,
+ * it is used as CRC_Type, so the CRC driver API works the same way.
+ */
+typedef struct _crc_software_engine
+{
+    const void *table;       /*!< Slice-by-8 table of the protocol, NULL if the protocol is computed bit by bit. */
+    uint32_t polynomial;     /*!< CRC Polynomial, bit reflected if reflectIn is true. */
+    uint32_t checksum;       /*!< Current checksum, bit reflected if reflectIn is true. */
+    bool reflectIn;          /*!< Reflect bits on input. */
+    bool reflectOut;         /*!< Reflect bits on output. */
+    bool complementChecksum; /*!< True if the result shall be complement of the actual checksum. */
+    crc_bits_t crcBits;      /*!< Selects 16- or 32- bit CRC protocol. */
+    crc_result_t crcResult;  /*!< Selects final or intermediate checksum return. */
+} crc_software_engine_t;
+
+#if !(defined(FSL_FEATURE_SOC_CRC_COUNT) && FSL_FEATURE_SOC_CRC_COUNT)
+/*! @brief The software CRC engine is used as the CRC module on parts without it. */
+typedef crc_software_engine_t CRC_Type;
+#endif
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -102,7 +135,8 @@ void CRC_Init(CRC_Type *base, const crc_config_t *config);
  */
 static inline void CRC_Deinit(CRC_Type *base)
 {
-#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL)
+#if !(defined(FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL) && \
+    (defined(FSL_FEATURE_SOC_CRC_COUNT) && FSL_FEATURE_SOC_CRC_COUNT)
     /* gate clock */
     CLOCK_DisableClock(kCLOCK_Crc0);
 #endif /* FSL_SDK_DISABLE_DRIVER_CLOCK_CONTROL */
@@ -160,6 +194,54 @@ uint32_t CRC_Get32bitResult(CRC_Type *base);
  */
 uint16_t CRC_Get16bitResult(CRC_Type *base);
 
+/*!
+ * @name Software CRC engine
+ * @{
+ */
+
+/*!
+ * @brief Configures the software CRC engine and starts a checksum computation with the seed.
+ *
+ * The configuration has the same meaning as for the CRC module. The seed and the intermediate checksum
+ * are not bit reflected, so the intermediate checksum can be used as a seed to continue the computation.
+ * The CRC-16-CCITT (polynomial 0x1021 without reflect in) and CRC-32 (polynomial 0x04C11DB7 with
+ * reflect in) protocols are computed with slice-by-8 tables, the others are computed bit by bit.
+ *
+ * @param engine Software CRC engine.
+ * @param config CRC protocol configuration structure.
+ */
+void CRC_SoftwareInit(crc_software_engine_t *engine, const crc_config_t *config);
+
+/*!
+ * @brief Writes data to the software CRC engine.
+ *
+ * @param engine Software CRC engine.
+ * @param data Input data stream, MSByte in data[0].
+ * @param dataSize Size in bytes of the input data buffer.
+ */
+void CRC_SoftwareWriteData(crc_software_engine_t *engine, const uint8_t *data, size_t dataSize);
+
+/*!
+ * @brief Reads the 32-bit checksum from the software CRC engine.
+ *
+ * @param engine Software CRC engine.
+ * @return An intermediate or the final 32-bit checksum, after configured reflect and complement operations.
+ */
+uint32_t CRC_SoftwareGet32bitResult(const crc_software_engine_t *engine);
+
+/*!
+ * @brief Reads a 16-bit checksum from the software CRC engine.
+ *
+ * @param engine Software CRC engine.
+ * @return An intermediate or the final 16-bit checksum, after configured reflect and complement operations.
+ */
+static inline uint16_t CRC_SoftwareGet16bitResult(const crc_software_engine_t *engine)
+{
+    return (uint16_t)CRC_SoftwareGet32bitResult(engine);
+}
+
+/*! @}*/
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,229 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_crc_edma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.crc_edma"
+#endif
+
+/*! @internal @brief Has data register with name CRC. */
+#if defined(FSL_FEATURE_CRC_HAS_CRC_REG) && FSL_FEATURE_CRC_HAS_CRC_REG
+#define DATA CRC
+#endif
+
+/*! @brief Maximum major loop count while the channel is linked to itself after each minor loop. */
+#define CRC_EDMA_MAX_MAJOR_COUNT (DMA_CITER_ELINKYES_CITER_MASK >> DMA_CITER_ELINKYES_CITER_SHIFT)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief CRC EDMA transfer finished callback function.
+ *
+ * This function is called when the eDMA transfer finished. It writes the tail data by CPU, and
+ * passes the checksum to the CRC callback.
+ *
+ * @param handle The EDMA handle.
+ * @param param Callback function parameter.
+ */
+static void CRC_WriteDataEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+
+/*!
+ * @brief Reads the checksum for the configured CRC protocol.
+ *
+ * @param base CRC peripheral address.
+ * @return The 32-bit or 16-bit checksum.
+ */
+static uint32_t CRC_GetResultEDMA(CRC_Type *base);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t CRC_GetResultEDMA(CRC_Type *base)
+{
+    uint32_t checksum;
+
+    if ((base->CTRL & CRC_CTRL_TCRC_MASK) != 0U)
+    {
+        checksum = CRC_Get32bitResult(base);
+    }
+    else
+    {
+        checksum = CRC_Get16bitResult(base);
+    }
+
+    return checksum;
+}
+
+static void CRC_WriteDataEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    assert(NULL != param);
+
+    crc_edma_handle_t *crcHandle = (crc_edma_handle_t *)param;
+
+    /* Avoid warning for unused parameters. */
+    handle = handle;
+    tcds   = tcds;
+
+    if (transferDone)
+    {
+        /* The rest words and the tail bytes, in stream order after the eDMA transfer. */
+        CRC_WriteData(crcHandle->base, crcHandle->tailData, crcHandle->tailDataSize);
+        crcHandle->busy = false;
+
+        if (NULL != crcHandle->callback)
+        {
+            crcHandle->callback(crcHandle->base, crcHandle, kStatus_Success, CRC_GetResultEDMA(crcHandle->base),
+                                crcHandle->userData);
+        }
+    }
+}
+
+/*!
+ * brief Initializes the CRC handle which is used in transactional functions.
+ *
+ * The eDMA handle should be created by EDMA_CreateHandle before, and must not use a TCD pool. The channel must
+ * have no peripheral request routed, the transfer is started by software.
+ *
+ * param base CRC peripheral address.
+ * param handle Pointer to crc_edma_handle_t structure.
+ * param callback Callback function.
+ * param userData User data.
+ * param edmaHandle User requested DMA handle for the CRC data transfer.
+ */
+void CRC_TransferCreateHandleEDMA(CRC_Type *base,
+                                  crc_edma_handle_t *handle,
+                                  crc_edma_callback_t callback,
+                                  void *userData,
+                                  edma_handle_t *edmaHandle)
+{
+    assert(NULL != handle);
+    assert(NULL != edmaHandle);
+    assert(NULL == edmaHandle->tcdPool);
+
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->base       = base;
+    handle->edmaHandle = edmaHandle;
+    handle->callback   = callback;
+    handle->userData   = userData;
+
+    EDMA_SetCallback(edmaHandle, CRC_WriteDataEDMACallback, handle);
+}
+
+/*!
+ * brief Writes data to the CRC module using eDMA.
+ *
+ * This function is the non-blocking version of CRC_WriteData. The head bytes till the source address is
+ * 4 bytes aligned are written by CPU in this function, then the words are written by eDMA, and the rest
+ * which can't fill a minor loop and the tail bytes are written by CPU in the eDMA interrupt. Then the
+ * callback is called with the checksum, read as CRC_Get32bitResult or CRC_Get16bitResult does for the
+ * configured CRC protocol. The CRC module must be configured by CRC_Init before.
+ *
+ * param base CRC peripheral address.
+ * param handle Pointer to crc_edma_handle_t structure.
+ * param data Input data stream, MSByte in data[0].
+ * param dataSize Size in bytes of the input data buffer.
+ * retval kStatus_Success The write is started.
+ * retval kStatus_EDMA_Busy The previous write is not done.
+ */
+status_t CRC_WriteDataEDMA(CRC_Type *base, crc_edma_handle_t *handle, const uint8_t *data, size_t dataSize)
+{
+    assert(NULL != handle);
+    assert((NULL != data) || (0U == dataSize));
+
+    edma_handle_t *edmaHandle = handle->edmaHandle;
+    edma_transfer_config_t xferConfig;
+    size_t headSize;
+    uint32_t words;
+    uint32_t minorWords;
+    uint32_t majorCount;
+
+    if (handle->busy)
+    {
+        return kStatus_EDMA_Busy;
+    }
+
+    /* 8-bit writes by CPU till source address is aligned 4 bytes */
+    headSize = (4U - ((uint32_t)data & 3U)) & 3U;
+    headSize = MIN(headSize, dataSize);
+    CRC_WriteData(base, data, headSize);
+    data += headSize;
+    dataSize -= headSize;
+
+    /*
+        Each minor loop writes about CRC_EDMA_MINOR_LOOP_BYTES, and the minor loop is enlarged when
+        the major loop count would exceed the limit.
+    */
+    words      = dataSize / sizeof(uint32_t);
+    minorWords = CRC_EDMA_MINOR_LOOP_BYTES / sizeof(uint32_t);
+    if (minorWords < ((words + CRC_EDMA_MAX_MAJOR_COUNT - 1U) / CRC_EDMA_MAX_MAJOR_COUNT))
+    {
+        minorWords = (words + CRC_EDMA_MAX_MAJOR_COUNT - 1U) / CRC_EDMA_MAX_MAJOR_COUNT;
+    }
+    majorCount = words / minorWords;
+
+    if (0U == majorCount)
+    {
+        /* Too short for the eDMA, write all by CPU. */
+        CRC_WriteData(base, data, dataSize);
+
+        if (NULL != handle->callback)
+        {
+            handle->callback(base, handle, kStatus_Success, CRC_GetResultEDMA(base), handle->userData);
+        }
+        return kStatus_Success;
+    }
+
+    handle->busy         = true;
+    handle->tailData     = data + (majorCount * minorWords * sizeof(uint32_t));
+    handle->tailDataSize = dataSize - (majorCount * minorWords * sizeof(uint32_t));
+
+    /* The destination is the CRC data register, the address does not increase. */
+    EDMA_PrepareTransfer(&xferConfig, (void *)(uint32_t)data, sizeof(uint32_t), (void *)(uint32_t)&base->DATA,
+                         sizeof(uint32_t), minorWords * sizeof(uint32_t),
+                         majorCount * minorWords * sizeof(uint32_t), kEDMA_MemoryToPeripheral);
+    EDMA_ResetChannel(edmaHandle->base, edmaHandle->channel);
+    EDMA_SetTransferConfig(edmaHandle->base, edmaHandle->channel, &xferConfig, NULL);
+    if (majorCount > 1U)
+    {
+        /* Link the channel to itself so that the next minor loop is started by hardware. */
+        EDMA_SetChannelLink(edmaHandle->base, edmaHandle->channel, kEDMA_MinorLink, edmaHandle->channel);
+    }
+    EDMA_EnableChannelInterrupts(edmaHandle->base, edmaHandle->channel, (uint32_t)kEDMA_MajorInterruptEnable);
+    EDMA_TriggerChannelStart(edmaHandle->base, edmaHandle->channel);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Aborts the data write using eDMA.
+ *
+ * The checksum is not valid after abort, the CRC module should be configured again by CRC_Init.
+ *
+ * param base CRC peripheral address.
+ * param handle Pointer to crc_edma_handle_t structure.
+ */
+void CRC_TransferAbortEDMA(CRC_Type *base, crc_edma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    /* Avoid warning for unused parameters. */
+    base = base;
+
+    EDMA_AbortTransfer(handle->edmaHandle);
+
+    handle->busy = false;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_CRC_EDMA_H_
+#define _FSL_CRC_EDMA_H_
+
+#include "fsl_crc.h"
+#include "fsl_edma.h"
+
+/*!
+ * @addtogroup crc_edma
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*@{*/
+/*! @brief CRC EDMA driver version. Version 2.0.0. */
+#define FSL_CRC_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*@}*/
+
+#ifndef CRC_EDMA_MINOR_LOOP_BYTES
+/*! @brief Bytes written to the CRC data register in one eDMA minor loop. Other channels can be serviced between
+ *  the minor loops. */
+#define CRC_EDMA_MINOR_LOOP_BYTES 1024U
+#endif
+
+/* Forward declaration of the handle typedef. */
+typedef struct _crc_edma_handle crc_edma_handle_t;
+
+/*! @brief CRC eDMA callback function, the checksum is valid only if status is kStatus_Success. */
+typedef void (*crc_edma_callback_t)(
+    CRC_Type *base, crc_edma_handle_t *handle, status_t status, uint32_t checksum, void *userData);
+
+/*!
+ * @brief CRC eDMA handle
+ */
+struct _crc_edma_handle
+{
+    CRC_Type *base;               /*!< CRC peripheral address. */
+    edma_handle_t *edmaHandle;    /*!< The eDMA channel used. */
+    crc_edma_callback_t callback; /*!< Callback function. */
+    void *userData;               /*!< CRC callback function parameter. */
+    const uint8_t *tailData;      /*!< Tail data written by CPU after the eDMA transfer. */
+    size_t tailDataSize;          /*!< Size of the tail data. */
+    volatile bool busy;           /*!< True while the data is being written. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name eDMA transactional
+ * @{
+ */
+
+/*!
+ * @brief Initializes the CRC handle which is used in transactional functions.
+ *
+ * The eDMA handle should be created by EDMA_CreateHandle before, and must not use a TCD pool. The channel must
+ * have no peripheral request routed, the transfer is started by software.
+ *
+ * @param base CRC peripheral address.
+ * @param handle Pointer to crc_edma_handle_t structure.
+ * @param callback Callback function.
+ * @param userData User data.
+ * @param edmaHandle User requested DMA handle for the CRC data transfer.
+ */
+void CRC_TransferCreateHandleEDMA(CRC_Type *base,
+                                  crc_edma_handle_t *handle,
+                                  crc_edma_callback_t callback,
+                                  void *userData,
+                                  edma_handle_t *edmaHandle);
+
+/*!
+ * @brief Writes data to the CRC module using eDMA.
+ *
+ * This function is the non-blocking version of CRC_WriteData. The head bytes till the source address is
+ * 4 bytes aligned are written by CPU in this function, then the words are written by eDMA, and the rest
+ * which can't fill a minor loop and the tail bytes are written by CPU in the eDMA interrupt. Then the
+ * callback is called with the checksum, read as CRC_Get32bitResult or CRC_Get16bitResult does for the
+ * configured CRC protocol. The CRC module must be configured by CRC_Init before.
+ *
+ * @param base CRC peripheral address.
+ * @param handle Pointer to crc_edma_handle_t structure.
+ * @param data Input data stream, MSByte in data[0].
+ * @param dataSize Size in bytes of the input data buffer.
+ * @retval kStatus_Success The write is started.
+ * @retval kStatus_EDMA_Busy The previous write is not done.
+ */
+status_t CRC_WriteDataEDMA(CRC_Type *base, crc_edma_handle_t *handle, const uint8_t *data, size_t dataSize);
+
+/*!
+ * @brief Aborts the data write using eDMA.
+ *
+ * The checksum is not valid after abort, the CRC module should be configured again by CRC_Init.
+ *
+ * @param base CRC peripheral address.
+ * @param handle Pointer to crc_edma_handle_t structure.
+ */
+void CRC_TransferAbortEDMA(CRC_Type *base, crc_edma_handle_t *handle);
+
+/*@}*/
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_CRC_EDMA_H_ */
@@ -86,6 +86,8 @@
 #ifndef ENET_1588TIME_DELAY_COUNT
 #define ENET_1588TIME_DELAY_COUNT 10U
 #endif
+/*! @brief Zero-copy frames released in one batch when the transmit descriptors are reclaimed in thread context. */
+#define ENET_TX_RECLAIM_BATCH_NUM 4U
 
 /*! @brief Defines the macro for converting constants from host byte order to network byte order. */
 #define ENET_HTONS(n) __REV16(n)
@@ -181,6 +183,97 @@ static void ENET_SetRxBufferDescriptors(enet_handle_t *handle,
  */
 static void ENET_UpdateReadBuffers(ENET_Type *base, enet_handle_t *handle, uint32_t ringId);
 
+/*!
+ * @brief Receives a frame by swapping the buffers of the receive buffer descriptors with new buffers.
+ *
+ * @param base ENET peripheral base address.
+ * @param handle The ENET handle pointer.
+ * @param rxFrame The received frame structure provided by application.
+ * @param ringId The descriptor ring index, range from 0 ~ FSL_FEATURE_ENET_QUEUE - 1.
+ *               0 ----- for single ring kinetis platform.
+ *               0 ~ 2 for mulit-ring supported IMX8qm.
+ */
+static status_t ENET_GetRxFrameCommon(ENET_Type *base,
+                                      enet_handle_t *handle,
+                                      enet_rx_frame_struct_t *rxFrame,
+                                      uint32_t ringId);
+
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+/*!
+ * @brief Gets the receive frame attribute from the last enhanced receive buffer descriptor of the frame.
+ *
+ * @param curBuffDescrip The last receive buffer descriptor of the frame.
+ * @param rxAttribute The receive frame attribute.
+ */
+static void ENET_GetRxFrameAttribute(volatile enet_rx_bd_struct_t *curBuffDescrip,
+                                     enet_rx_frame_attribute_t *rxAttribute);
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
+/*!
+ * @brief Discards the erroneous frame and updates the receive buffer descriptors.
+ *
+ * @param base ENET peripheral base address.
+ * @param handle The ENET handle pointer.
+ * @param ringId The descriptor ring index, range from 0 ~ FSL_FEATURE_ENET_QUEUE - 1.
+ *               0 ----- for single ring kinetis platform.
+ *               0 ~ 2 for mulit-ring supported IMX8qm.
+ * @return The error flags of the frame, a logical OR of "_enet_rx_frame_error_flags".
+ */
+static uint16_t ENET_DiscardRxFrame(ENET_Type *base, enet_handle_t *handle, uint32_t ringId);
+
+/*!
+ * @brief Receives the received frames in one pass without copy.
+ *
+ * @param base ENET peripheral base address.
+ * @param handle The ENET handle pointer.
+ * @param rxFrames The received frame structure array provided by application.
+ * @param frameNum The number of structures in rxFrames.
+ * @param drainedNum The number of frames drained.
+ * @param ringId The descriptor ring index, range from 0 ~ FSL_FEATURE_ENET_QUEUE - 1.
+ *               0 ----- for single ring kinetis platform.
+ *               0 ~ 2 for mulit-ring supported IMX8qm.
+ */
+static status_t ENET_GetRxFrameBatchCommon(ENET_Type *base,
+                                           enet_handle_t *handle,
+                                           enet_rx_frame_struct_t *rxFrames,
+                                           uint32_t frameNum,
+                                           uint32_t *drainedNum,
+                                           uint32_t ringId);
+
+/*!
+ * @brief Sends a frame by pointing the transmit buffer descriptors to the frame fragments.
+ *
+ * @param base ENET peripheral base address.
+ * @param handle The ENET handle pointer.
+ * @param txFrame The transmit frame structure provided by application.
+ * @param ringId The descriptor ring index, range from 0 ~ FSL_FEATURE_ENET_QUEUE - 1.
+ *               0 ----- for single ring kinetis platform.
+ *               0 ~ 2 for mulit-ring supported IMX8qm.
+ */
+static status_t ENET_StartTxFrameCommon(ENET_Type *base,
+                                        enet_handle_t *handle,
+                                        const enet_tx_frame_struct_t *txFrame,
+                                        uint32_t ringId);
+
+/*!
+ * @brief Reclaims the transmit buffer descriptors which are transmitted and releases the zero-copy frames.
+ *
+ * When frameContexts is NULL, the reclaim callback is called for each released zero-copy frame.
+ * Otherwise the contexts of the released frames are stored to frameContexts for the caller to call
+ * the callback later, and the walk stops when contextNum contexts are stored.
+ *
+ * @param base ENET peripheral base address.
+ * @param handle The ENET handle pointer.
+ * @param ringId The descriptor ring index, range from 0 ~ FSL_FEATURE_ENET_QUEUE - 1.
+ *               0 ----- for single ring kinetis platform.
+ *               0 ~ 2 for mulit-ring supported IMX8qm.
+ * @param frameContexts The array for the contexts of the released frames, or NULL.
+ * @param contextNum The size of the frameContexts array.
+ * @return The number of the contexts stored to frameContexts.
+ */
+static uint32_t ENET_ReclaimTxDescriptors(
+    ENET_Type *base, enet_handle_t *handle, uint32_t ringId, void **frameContexts, uint32_t contextNum);
+
 /*!
  * @brief Activates ENET send for multiple tx rings.
  *
@@ -242,19 +335,36 @@ static status_t ENET_StoreTxFrameTime(ENET_Type *base, enet_handle_t *handle, ui
  */
 static status_t ENET_StoreRxFrameTime(ENET_Type *base, enet_handle_t *handle, enet_ptp_time_data_t *ptpTimeData);
 
-#if defined(FSL_FEATURE_ENET_HAS_AVB) && FSL_FEATURE_ENET_AVB
+#if defined(FSL_FEATURE_ENET_HAS_AVB) && FSL_FEATURE_ENET_HAS_AVB
 /*!
- * @brief Gets the ring index for transmission.
+ * @brief Gets the used transmit buffer descriptors of a ring.
  *
- * @param base  ENET peripheral base address.
- * @param data The ENET transmit data.
  * @param handle The ENET handle pointer.
+ * @param ringId The ring index.
+ * @return The number of the buffer descriptors owned by the uDMA or not reclaimed.
+ */
+static uint16_t ENET_AVBGetTxRingUsage(enet_handle_t *handle, uint32_t ringId);
+
+/*!
+ * @brief Checks whether a frame can be enqueued to a ring for the AVB transmit scheduler.
  *
- * @note This must be called after the MAC configuration and
- * state are ready. It must be called after the ENET_Init() and
- * this should be called when the ENET receive required.
+ * @param base ENET peripheral base address.
+ * @param handle The ENET handle pointer.
+ * @param ringId The ring index.
+ * @retval kStatus_Success The frame can be enqueued.
+ * @retval kStatus_ENET_TxFrameBusy The used buffer descriptors reach the threshold.
+ */
+static status_t ENET_AVBCheckTxRing(ENET_Type *base, enet_handle_t *handle, uint32_t ringId);
+
+/*!
+ * @brief Updates the AVB transmit statistics of a ring after enqueue.
+ *
+ * @param handle The ENET handle pointer.
+ * @param ringId The ring index.
+ * @param status The enqueue status.
+ * @param length The frame length.
  */
-static uint8_t ENET_GetTxRingId(ENET_Type *base, uint8_t *data, enet_handle_t *handle);
+static void ENET_AVBUpdateTxStatistics(enet_handle_t *handle, uint32_t ringId, status_t status, uint32_t length);
 #endif /* FSL_FEATURE_ENET_HAS_AVB */
 #endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
 
@@ -455,6 +565,53 @@ void ENET_SetCallback(enet_handle_t *handle, enet_callback_t callback, void *use
     handle->userData = userData;
 }
 
+/*!
+ * brief Sets the receive buffer allocate and free callbacks for the zero-copy receive interface.
+ *
+ * This API should be called after calling ENET_Init and before calling ENET_GetRxFrame.
+ *
+ * param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * param rxBuffAlloc The callback to allocate a new receive buffer for the buffer descriptor.
+ * param rxBuffFree The callback to free a buffer got from rxBuffAlloc.
+ * param userData The callback function parameter.
+ */
+void ENET_SetRxBufferAllocCallback(enet_handle_t *handle,
+                                   enet_rx_alloc_callback_t rxBuffAlloc,
+                                   enet_rx_free_callback_t rxBuffFree,
+                                   void *userData)
+{
+    assert(handle);
+
+    handle->rxBuffAlloc    = rxBuffAlloc;
+    handle->rxBuffFree     = rxBuffFree;
+    handle->rxBuffUserData = userData;
+}
+
+/*!
+ * brief Sets the transmit reclaim callback for the zero-copy transmit interface.
+ *
+ * This API should be called after calling ENET_Init and before calling ENET_StartTxFrame.
+ * The callback is called from ENET_TransmitIRQHandler once all buffer descriptors of a frame
+ * are released by the uDMA, so the transmit interrupt should be enabled.
+ *
+ * param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * param config The transmit reclaim configuration structure.
+ */
+void ENET_SetTxReclaimCallback(enet_handle_t *handle, const enet_tx_reclaim_config_t *config)
+{
+    assert(handle);
+    assert(config);
+
+    uint8_t count;
+
+    for (count = 0; count < handle->ringNum; count++)
+    {
+        handle->txFrameContext[count] = config->txFrameContext[count];
+    }
+    handle->txReclaimUserData = config->userData;
+    handle->txReclaimCallback = config->callback;
+}
+
 static void ENET_SetHandler(ENET_Type *base,
                             enet_handle_t *handle,
                             const enet_config_t *config,
@@ -478,6 +635,14 @@ static void ENET_SetHandler(ENET_Type *base,
         handle->txBdBase[count]        = buffCfg->txBdStartAddrAlign;
         handle->txBdCurrent[count]     = buffCfg->txBdStartAddrAlign;
         handle->txBuffSizeAlign[count] = buffCfg->txBuffSizeAlign;
+        handle->txBdDirty[count]       = buffCfg->txBdStartAddrAlign;
+        handle->txBdNumber[count]      = buffCfg->txBdNumber;
+#if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+        handle->txBuffBase[count] =
+            (uint8_t *)MEMORY_ConvertMemoryMapAddress((uint32_t)buffCfg->txBufferAlign, kMEMORY_Local2DMA);
+#else
+        handle->txBuffBase[count] = buffCfg->txBufferAlign;
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
         buffCfg++;
     }
 
@@ -707,30 +872,14 @@ static void ENET_SetMacController(ENET_Type *base,
         uint32_t intMask = (ENET_EIMR_TXB_MASK | ENET_EIMR_RXB_MASK);
 
 #if FSL_FEATURE_ENET_QUEUE > 1
-        uint8_t queue = 0;
         intMask |= ENET_EIMR_TXB2_MASK | ENET_EIMR_RXB2_MASK | ENET_EIMR_TXB1_MASK | ENET_EIMR_RXB1_MASK;
 #endif /* FSL_FEATURE_ENET_QUEUE > 1 */
 
         /* Clear all buffer interrupts. */
         base->EIMR &= ~intMask;
 
-/* Set the interrupt coalescence. */
-#if FSL_FEATURE_ENET_QUEUE > 1
-        for (queue = 0; queue < FSL_FEATURE_ENET_QUEUE; queue++)
-        {
-            base->TXIC[queue] = ENET_TXIC_ICFT(config->intCoalesceCfg->txCoalesceFrameCount[queue]) |
-                                config->intCoalesceCfg->txCoalesceTimeCount[queue] | ENET_TXIC_ICCS_MASK |
-                                ENET_TXIC_ICEN_MASK;
-            base->RXIC[queue] = ENET_RXIC_ICFT(config->intCoalesceCfg->rxCoalesceFrameCount[queue]) |
-                                config->intCoalesceCfg->rxCoalesceTimeCount[queue] | ENET_RXIC_ICCS_MASK |
-                                ENET_RXIC_ICEN_MASK;
-        }
-#else
-        base->TXIC  = ENET_TXIC_ICFT(config->intCoalesceCfg->txCoalesceFrameCount[0]) |
-                     config->intCoalesceCfg->txCoalesceTimeCount[0] | ENET_TXIC_ICCS_MASK | ENET_TXIC_ICEN_MASK;
-        base->RXIC = ENET_RXIC_ICFT(config->intCoalesceCfg->rxCoalesceFrameCount[0]) |
-                     config->intCoalesceCfg->rxCoalesceTimeCount[0] | ENET_RXIC_ICCS_MASK | ENET_RXIC_ICEN_MASK;
-#endif /* FSL_FEATURE_ENET_QUEUE > 1 */
+        /* Set the interrupt coalescence. */
+        ENET_SetInterruptCoalesce(base, config->intCoalesceCfg);
     }
 #endif /* FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE */
     ENET_EnableInterrupts(base, config->interrupt);
@@ -744,6 +893,54 @@ static void ENET_SetMacController(ENET_Type *base,
     base->ECR = ecr;
 }
 
+#if defined(FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE) && FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE
+/*!
+ * brief Sets the ENET transmit and receive interrupt coalescing.
+ *
+ * With the interrupt coalescing, one transmit or receive buffer interrupt is generated after
+ * the frame count threshold is reached or the timer count threshold expires, so one interrupt
+ * covers many frames. This API can be called at run time to change the configuration set by ENET_Init.
+ *
+ * param base  ENET peripheral base address.
+ * param config The interrupt coalescing configuration, set to NULL to disable the interrupt coalescing.
+ */
+void ENET_SetInterruptCoalesce(ENET_Type *base, const enet_intcoalesce_config_t *config)
+{
+#if FSL_FEATURE_ENET_QUEUE > 1
+    uint8_t queue = 0;
+
+    for (queue = 0; queue < FSL_FEATURE_ENET_QUEUE; queue++)
+    {
+        if (config)
+        {
+            base->TXIC[queue] = ENET_TXIC_ICFT(config->txCoalesceFrameCount[queue]) |
+                                config->txCoalesceTimeCount[queue] | ENET_TXIC_ICCS_MASK | ENET_TXIC_ICEN_MASK;
+            base->RXIC[queue] = ENET_RXIC_ICFT(config->rxCoalesceFrameCount[queue]) |
+                                config->rxCoalesceTimeCount[queue] | ENET_RXIC_ICCS_MASK | ENET_RXIC_ICEN_MASK;
+        }
+        else
+        {
+            base->TXIC[queue] = 0;
+            base->RXIC[queue] = 0;
+        }
+    }
+#else
+    if (config)
+    {
+        base->TXIC = ENET_TXIC_ICFT(config->txCoalesceFrameCount[0]) | config->txCoalesceTimeCount[0] |
+                     ENET_TXIC_ICCS_MASK | ENET_TXIC_ICEN_MASK;
+        base->RXIC = ENET_RXIC_ICFT(config->rxCoalesceFrameCount[0]) | config->rxCoalesceTimeCount[0] |
+                     ENET_RXIC_ICCS_MASK | ENET_RXIC_ICEN_MASK;
+    }
+    else
+    {
+        base->TXIC = 0;
+        base->RXIC = 0;
+    }
+#endif /* FSL_FEATURE_ENET_QUEUE > 1 */
+}
+#endif /* FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE */
+
 static void ENET_SetTxBufferDescriptors(enet_handle_t *handle,
                                         const enet_config_t *config,
                                         const enet_buffer_config_t *bufferConfig)
@@ -1502,6 +1699,356 @@ static void ENET_UpdateReadBuffers(ENET_Type *base, enet_handle_t *handle, uint3
     }
 }
 
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+static void ENET_GetRxFrameAttribute(volatile enet_rx_bd_struct_t *curBuffDescrip,
+                                     enet_rx_frame_attribute_t *rxAttribute)
+{
+    uint16_t control    = curBuffDescrip->control;
+    uint16_t controlExt = curBuffDescrip->controlExtend0;
+    uint16_t flags      = 0;
+
+    flags |= (controlExt & ENET_BUFFDESCRIPTOR_RX_IPV4_MASK) ? kENET_RxFrameIpv4Flag : 0U;
+    flags |= (controlExt & ENET_BUFFDESCRIPTOR_RX_IPV6_MASK) ? kENET_RxFrameIpv6Flag : 0U;
+    flags |= (controlExt & ENET_BUFFDESCRIPTOR_RX_VLAN_MASK) ? kENET_RxFrameVlanFlag : 0U;
+    flags |= (controlExt & ENET_BUFFDESCRIPTOR_RX_IPHEADCHECKSUM_MASK) ? kENET_RxFrameIpHeadChecksumErrFlag : 0U;
+    flags |= (controlExt & ENET_BUFFDESCRIPTOR_RX_PROTOCOLCHECKSUM_MASK) ? kENET_RxFrameProtocolChecksumErrFlag : 0U;
+    flags |= (curBuffDescrip->controlExtend1 & ENET_BUFFDESCRIPTOR_RX_UNICAST_MASK) ? kENET_RxFrameUnicastFlag : 0U;
+    flags |= (control & ENET_BUFFDESCRIPTOR_RX_MULTICAST_MASK) ? kENET_RxFrameMulticastFlag : 0U;
+    flags |= (control & ENET_BUFFDESCRIPTOR_RX_BROADCAST_MASK) ? kENET_RxFrameBroadcastFlag : 0U;
+
+    rxAttribute->flags           = flags;
+    rxAttribute->payloadChecksum = curBuffDescrip->payloadCheckSum;
+    rxAttribute->headerLength    = curBuffDescrip->headerLength;
+    rxAttribute->protocol        = curBuffDescrip->protocolTyte;
+}
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
+static status_t ENET_GetRxFrameCommon(ENET_Type *base,
+                                      enet_handle_t *handle,
+                                      enet_rx_frame_struct_t *rxFrame,
+                                      uint32_t ringId)
+{
+    assert(handle);
+    assert(rxFrame);
+    assert(rxFrame->rxBuffArray);
+    assert(ringId < FSL_FEATURE_ENET_QUEUE);
+    assert(handle->rxBuffAlloc);
+    assert(handle->rxBuffFree);
+
+    volatile enet_rx_bd_struct_t *curBuffDescrip = handle->rxBdCurrent[ringId];
+    uint32_t buffNum                             = 0;
+    uint32_t offset                              = 0;
+    uint32_t index;
+    uint32_t length;
+    uint32_t address;
+    uint16_t control;
+    void *newBuff;
+    status_t result = kStatus_Success;
+
+    rxFrame->usedBuffNum = 0;
+    rxFrame->totLen      = 0;
+    rxFrame->errFlags    = 0;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+    memset(&rxFrame->rxAttribute, 0, sizeof(enet_rx_frame_attribute_t));
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
+    /* Count the buffer descriptors of the frame and check the status of the frame. */
+    while (true)
+    {
+        control = curBuffDescrip->control;
+        /* No frame received or the frame is still on processing. */
+        if (control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK)
+        {
+            return kStatus_ENET_RxFrameEmpty;
+        }
+        /* Add check for abnormal case. */
+        if (!curBuffDescrip->length)
+        {
+            return kStatus_ENET_RxFrameError;
+        }
+
+        buffNum++;
+
+        /* The last buffer descriptor in the frame check the status of the received frame. */
+        if (control & ENET_BUFFDESCRIPTOR_RX_LAST_MASK)
+        {
+            if ((control & ENET_BUFFDESCRIPTOR_RX_ERR_MASK)
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+                || (curBuffDescrip->controlExtend1 & ENET_BUFFDESCRIPTOR_RX_EXT_ERR_MASK)
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+            )
+            {
+                return kStatus_ENET_RxFrameError;
+            }
+            break;
+        }
+
+        /* Increase the buffer descriptor, if it is the last one, increase to first one of the ring buffer. */
+        if (control & ENET_BUFFDESCRIPTOR_RX_WRAP_MASK)
+        {
+            curBuffDescrip = handle->rxBdBase[ringId];
+        }
+        else
+        {
+            curBuffDescrip++;
+        }
+
+        if (curBuffDescrip == handle->rxBdCurrent[ringId])
+        {
+            return kStatus_ENET_RxFrameEmpty;
+        }
+    }
+
+    /* Get the new buffers for all buffer descriptors of the frame before giving any buffer out. */
+    if (buffNum <= rxFrame->rxBuffNum)
+    {
+        for (index = 0; index < buffNum; index++)
+        {
+            newBuff = handle->rxBuffAlloc(base, handle->rxBuffUserData, ringId);
+            if (!newBuff)
+            {
+                break;
+            }
+            rxFrame->rxBuffArray[index].buffer = newBuff;
+        }
+    }
+    else
+    {
+        index = 0;
+    }
+
+    if (index < buffNum)
+    {
+        /* Give back the allocated buffers and drop the frame with the original buffers reused. */
+        while (index > 0)
+        {
+            index--;
+            handle->rxBuffFree(base, rxFrame->rxBuffArray[index].buffer, handle->rxBuffUserData, ringId);
+        }
+        for (index = 0; index < buffNum; index++)
+        {
+            ENET_UpdateReadBuffers(base, handle, ringId);
+        }
+
+        return kStatus_ENET_RxFrameDrop;
+    }
+
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+    enet_ptp_time_data_t ptpTimestamp;
+    bool isPtpEventMessage = false;
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
+    /* Swap the frame buffers out of the buffer descriptors. */
+    for (index = 0; index < buffNum; index++)
+    {
+        curBuffDescrip = handle->rxBdCurrent[ringId];
+#if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+        address = MEMORY_ConvertMemoryMapAddress((uint32_t)curBuffDescrip->buffer, kMEMORY_DMA2Local);
+#else
+        address = (uint32_t)curBuffDescrip->buffer;
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+#if defined(FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL) && FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL
+        /* Add the cache invalidate maintain. */
+        DCACHE_InvalidateByRange(address, handle->rxBuffSizeAlign[ringId]);
+#endif /* FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL */
+
+        if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_RX_LAST_MASK)
+        {
+            /* The length of the last buffer descriptor is the whole frame length, as ENET_GetRxFrameSize gets. */
+            length          = curBuffDescrip->length - offset;
+            rxFrame->totLen = curBuffDescrip->length;
+        }
+        else
+        {
+            length = handle->rxBuffSizeAlign[ringId];
+        }
+        offset += length;
+
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+        if (index == 0)
+        {
+            /* Parse the PTP message according to the header message. */
+            isPtpEventMessage = ENET_Ptp1588ParseFrame((uint8_t *)address, &ptpTimestamp, false);
+        }
+        /* Store the PTP 1588 timestamp for received PTP event frame. */
+        if (isPtpEventMessage && (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_RX_LAST_MASK))
+        {
+            ptpTimestamp.timeStamp.nanosecond = curBuffDescrip->timestamp;
+            result                            = ENET_StoreRxFrameTime(base, handle, &ptpTimestamp);
+        }
+        /* The accelerator result is only valid in the last buffer descriptor of the frame. */
+        if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_RX_LAST_MASK)
+        {
+            ENET_GetRxFrameAttribute(curBuffDescrip, &rxFrame->rxAttribute);
+        }
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
+        newBuff                            = rxFrame->rxBuffArray[index].buffer;
+        rxFrame->rxBuffArray[index].buffer = (void *)address;
+        rxFrame->rxBuffArray[index].length = length;
+
+#if defined(FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL) && FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL
+        /* Invalidate the new buffer before DMA transfer data into it. */
+        DCACHE_InvalidateByRange((uint32_t)newBuff, handle->rxBuffSizeAlign[ringId]);
+#endif /* FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL */
+#if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+        curBuffDescrip->buffer = (uint8_t *)MEMORY_ConvertMemoryMapAddress((uint32_t)newBuff, kMEMORY_Local2DMA);
+#else
+        curBuffDescrip->buffer = (uint8_t *)newBuff;
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+
+        /* Updates the receive buffer descriptors. */
+        ENET_UpdateReadBuffers(base, handle, ringId);
+    }
+
+    rxFrame->usedBuffNum = buffNum;
+
+    return result;
+}
+
+static uint16_t ENET_DiscardRxFrame(ENET_Type *base, enet_handle_t *handle, uint32_t ringId)
+{
+    volatile enet_rx_bd_struct_t *startBuffDescrip = handle->rxBdCurrent[ringId];
+    volatile enet_rx_bd_struct_t *curBuffDescrip;
+    uint16_t errFlags = 0;
+    uint16_t control;
+
+    do
+    {
+        curBuffDescrip = handle->rxBdCurrent[ringId];
+        control        = curBuffDescrip->control;
+        /* Stop at the buffer descriptor still owned by the uDMA. */
+        if (control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK)
+        {
+            break;
+        }
+
+        if (!curBuffDescrip->length)
+        {
+            errFlags |= kENET_RxFrameAbnormalErrFlag;
+        }
+        if (control & ENET_BUFFDESCRIPTOR_RX_LAST_MASK)
+        {
+            errFlags |= ((control & ENET_BUFFDESCRIPTOR_RX_TRUNC_MASK) ? kENET_RxFrameTruncErrFlag : 0U) |
+                        ((control & ENET_BUFFDESCRIPTOR_RX_OVERRUN_MASK) ? kENET_RxFrameOverrunErrFlag : 0U) |
+                        ((control & ENET_BUFFDESCRIPTOR_RX_LENVLIOLATE_MASK) ? kENET_RxFrameLenViolateErrFlag : 0U) |
+                        ((control & ENET_BUFFDESCRIPTOR_RX_NOOCTET_MASK) ? kENET_RxFrameNoOctetErrFlag : 0U) |
+                        ((control & ENET_BUFFDESCRIPTOR_RX_CRC_MASK) ? kENET_RxFrameCrcErrFlag : 0U);
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+            uint16_t controlExt = curBuffDescrip->controlExtend1;
+            errFlags |= ((controlExt & ENET_BUFFDESCRIPTOR_RX_MACERR_MASK) ? kENET_RxFrameMacErrFlag : 0U) |
+                        ((controlExt & ENET_BUFFDESCRIPTOR_RX_PHYERR_MASK) ? kENET_RxFramePhyErrFlag : 0U) |
+                        ((controlExt & ENET_BUFFDESCRIPTOR_RX_COLLISION_MASK) ? kENET_RxFrameCollisionErrFlag : 0U);
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+        }
+
+        /* Updates the receive buffer descriptors with the original buffers. */
+        ENET_UpdateReadBuffers(base, handle, ringId);
+    } while (!(control & ENET_BUFFDESCRIPTOR_RX_LAST_MASK) && (handle->rxBdCurrent[ringId] != startBuffDescrip));
+
+    return errFlags;
+}
+
+static status_t ENET_GetRxFrameBatchCommon(ENET_Type *base,
+                                           enet_handle_t *handle,
+                                           enet_rx_frame_struct_t *rxFrames,
+                                           uint32_t frameNum,
+                                           uint32_t *drainedNum,
+                                           uint32_t ringId)
+{
+    assert(rxFrames);
+    assert(drainedNum);
+
+    uint32_t count  = 0;
+    status_t result = kStatus_ENET_RxFrameEmpty;
+
+    while (count < frameNum)
+    {
+        result = ENET_GetRxFrameCommon(base, handle, &rxFrames[count], ringId);
+        if (result == kStatus_ENET_RxFrameError)
+        {
+            /* Drop the erroneous frame and report it with the error flags. */
+            rxFrames[count].errFlags = ENET_DiscardRxFrame(base, handle, ringId);
+        }
+        else if (result == kStatus_ENET_RxFrameDrop)
+        {
+            /* The buffer descriptors of the dropped frame are consumed, report it with the error flags. */
+            rxFrames[count].errFlags = kENET_RxFrameDropErrFlag;
+            /* No new buffer now, keep the next frames in the ring till the application frees buffers. */
+            count++;
+            break;
+        }
+        else if ((result != kStatus_Success)
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+                 /* The frame is received, only the PTP timestamp is not stored. */
+                 && (result != kStatus_ENET_PtpTsRingFull)
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+        )
+        {
+            break;
+        }
+        count++;
+    }
+
+    *drainedNum = count;
+
+    return (count != 0U) ? kStatus_Success : result;
+}
+
+/*!
+ * brief Receives an ENET frame without copy for single ring.
+ *
+ * This function hands the receive buffers holding the frame to the application and refills the
+ * receive buffer descriptors with new buffers got from the callback set by ENET_SetRxBufferAllocCallback.
+ * The frame data is not copied, the application owns the buffers in rxFrame->rxBuffArray after
+ * this function returns kStatus_Success and should free them after the frame is processed.
+ * In enhanced buffer descriptor mode, the classification and checksum result of the frame is
+ * stored in rxFrame->rxAttribute.
+ *
+ * param base  ENET peripheral base address.
+ * param handle The ENET handler structure. This is the same handler pointer used in the ENET_Init.
+ * param rxFrame The received frame structure provided by application.
+ * retval kStatus_Success Receive a frame successfully.
+ * retval kStatus_ENET_RxFrameEmpty No frame received.
+ * retval kStatus_ENET_RxFrameError Data error happens. ENET_ReadFrame should be called with NULL data
+ *         and NULL length to update the receive buffers.
+ * retval kStatus_ENET_RxFrameDrop The frame is dropped because no new buffer is available or the
+ *         rxBuffArray is too small, the receive buffer descriptors are updated with the original buffers.
+ */
+status_t ENET_GetRxFrame(ENET_Type *base, enet_handle_t *handle, enet_rx_frame_struct_t *rxFrame)
+{
+    return ENET_GetRxFrameCommon(base, handle, rxFrame, 0);
+}
+
+/*!
+ * brief Receives the received ENET frames in one pass without copy for single ring.
+ *
+ * This function drains up to frameNum completed frames from the receive buffer descriptor ring
+ * in one pass, each frame is received the same way as ENET_GetRxFrame. The erroneous frames
+ * are discarded and reported with the error flags, so that the application needs one call
+ * per receive interrupt instead of one call per frame. It is recommended to use this function
+ * together with the interrupt coalescing, see ENET_SetInterruptCoalesce.
+ *
+ * param base  ENET peripheral base address.
+ * param handle The ENET handler structure. This is the same handler pointer used in the ENET_Init.
+ * param rxFrames The received frame structure array provided by application, rxBuffArray and
+ *        rxBuffNum of each structure should be set before calling this function.
+ * param frameNum The number of structures in rxFrames.
+ * param drainedNum The number of frames drained, include the erroneous and the dropped frames. The dropped
+ *        frame is reported with kENET_RxFrameDropErrFlag, its buffer descriptors are updated with the original
+ *        buffers, the same as kStatus_ENET_RxFrameDrop of ENET_GetRxFrame.
+ * retval kStatus_Success At least one frame is drained.
+ * retval kStatus_ENET_RxFrameEmpty No frame received.
+ */
+status_t ENET_GetRxFrameBatch(ENET_Type *base,
+                              enet_handle_t *handle,
+                              enet_rx_frame_struct_t *rxFrames,
+                              uint32_t frameNum,
+                              uint32_t *drainedNum)
+{
+    return ENET_GetRxFrameBatchCommon(base, handle, rxFrames, frameNum, drainedNum, 0);
+}
+
 /*!
  * brief Transmits an ENET frame for single ring.
  * note The CRC is automatically appended to the data. Input the data
@@ -1536,7 +2083,7 @@ status_t ENET_SendFrame(ENET_Type *base, enet_handle_t *handle, const uint8_t *d
 
     /* Check if the transmit buffer is ready. */
     curBuffDescrip = handle->txBdCurrent[0];
-    if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_READY_MASK)
+    if (curBuffDescrip->control & (ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK))
     {
         return kStatus_ENET_TxFrameBusy;
     }
@@ -1573,94 +2120,307 @@ status_t ENET_SendFrame(ENET_Type *base, enet_handle_t *handle, const uint8_t *d
 
 #endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
         curBuffDescrip->control |= (ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_LAST_MASK);
+        handle->txBdSubmitted[0]++;
+
+        /* Increase the buffer descriptor address. */
+        if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK)
+        {
+            handle->txBdCurrent[0] = handle->txBdBase[0];
+        }
+        else
+        {
+            handle->txBdCurrent[0]++;
+        }
+        /* Active the transmit buffer descriptor. */
+        ENET_ActiveSend(base, 0);
+
+        return kStatus_Success;
+    }
+    else
+    {
+        /* One frame requires more than one transmit buffers. */
+        do
+        {
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+            /* For enable the timestamp. */
+            if (isPtpEventMessage)
+            {
+                curBuffDescrip->controlExtend1 |= ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK;
+            }
+            else
+            {
+                curBuffDescrip->controlExtend1 &= ~ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK;
+            }
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
+            /* Increase the buffer descriptor address. */
+            if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK)
+            {
+                handle->txBdCurrent[0] = handle->txBdBase[0];
+            }
+            else
+            {
+                handle->txBdCurrent[0]++;
+            }
+            /* update the size left to be transmit. */
+            sizeleft = length - len;
+#if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+            address = MEMORY_ConvertMemoryMapAddress((uint32_t)curBuffDescrip->buffer, kMEMORY_DMA2Local);
+#else
+            address = (uint32_t)curBuffDescrip->buffer;
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+            if (sizeleft > handle->txBuffSizeAlign[0])
+            {
+                /* Data copy. */
+                memcpy((void *)address, data + len, handle->txBuffSizeAlign[0]);
+#if defined(FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL) && FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL
+                /* Add the cache clean maintain. */
+                DCACHE_CleanByRange(address, handle->txBuffSizeAlign[0]);
+#endif /* FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL */
+                /* Data length update. */
+                curBuffDescrip->length = handle->txBuffSizeAlign[0];
+                len += handle->txBuffSizeAlign[0];
+                /* Sets the control flag. */
+                curBuffDescrip->control &= ~ENET_BUFFDESCRIPTOR_TX_LAST_MASK;
+                curBuffDescrip->control |= ENET_BUFFDESCRIPTOR_TX_READY_MASK;
+                handle->txBdSubmitted[0]++;
+                /* Active the transmit buffer descriptor*/
+                ENET_ActiveSend(base, 0);
+            }
+            else
+            {
+                memcpy((void *)address, data + len, sizeleft);
+#if defined(FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL) && FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL
+                /* Add the cache clean maintain. */
+                DCACHE_CleanByRange(address, sizeleft);
+#endif /* FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL */
+                curBuffDescrip->length = sizeleft;
+                /* Set Last buffer wrap flag. */
+                curBuffDescrip->control |= ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_LAST_MASK;
+                handle->txBdSubmitted[0]++;
+                /* Active the transmit buffer descriptor. */
+                ENET_ActiveSend(base, 0);
+
+                return kStatus_Success;
+            }
+
+            /* Get the current buffer descriptor address. */
+            curBuffDescrip = handle->txBdCurrent[0];
+
+        } while (!(curBuffDescrip->control &
+                   (ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK)));
+
+        return kStatus_ENET_TxFrameBusy;
+    }
+}
+
+static status_t ENET_StartTxFrameCommon(ENET_Type *base,
+                                        enet_handle_t *handle,
+                                        const enet_tx_frame_struct_t *txFrame,
+                                        uint32_t ringId)
+{
+    assert(handle);
+    assert(txFrame);
+    assert(txFrame->txBuffArray);
+    assert(txFrame->txBuffNum);
+    assert(ringId < FSL_FEATURE_ENET_QUEUE);
+    assert(handle->txFrameContext[ringId]);
+
+    volatile enet_tx_bd_struct_t *firstBuffDescrip = handle->txBdCurrent[ringId];
+    volatile enet_tx_bd_struct_t *curBuffDescrip;
+    uint32_t totLen = 0;
+    uint32_t index;
+    uint32_t address;
+    uint16_t control;
+
+    /* Check the frame length. */
+    for (index = 0; index < txFrame->txBuffNum; index++)
+    {
+        totLen += txFrame->txBuffArray[index].length;
+    }
+    if (totLen > ENET_FRAME_MAX_FRAMELEN)
+    {
+        return kStatus_ENET_TxFrameOverLen;
+    }
+
+    /* Check if there are enough free transmit buffer descriptors for the fragments. */
+    curBuffDescrip = firstBuffDescrip;
+    for (index = 0; index < txFrame->txBuffNum; index++)
+    {
+        if (curBuffDescrip->control & (ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK))
+        {
+            return kStatus_ENET_TxFrameBusy;
+        }
+        if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK)
+        {
+            curBuffDescrip = handle->txBdBase[ringId];
+        }
+        else
+        {
+            curBuffDescrip++;
+        }
+        /* The frame has more fragments than the ring size. */
+        if ((curBuffDescrip == firstBuffDescrip) && (index < txFrame->txBuffNum - 1U))
+        {
+            return kStatus_ENET_TxFrameBusy;
+        }
+    }
+
+    /* Point the buffer descriptors to the fragments. The first one is given to uDMA at the end
+     * so that the uDMA never sees a partial frame. */
+    curBuffDescrip = firstBuffDescrip;
+    for (index = 0; index < txFrame->txBuffNum; index++)
+    {
+        address = (uint32_t)txFrame->txBuffArray[index].buffer;
+#if defined(FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL) && FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL
+        /* Add the cache clean maintain. */
+        DCACHE_CleanByRange(address, txFrame->txBuffArray[index].length);
+#endif /* FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL */
+#if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+        curBuffDescrip->buffer = (uint8_t *)MEMORY_ConvertMemoryMapAddress(address, kMEMORY_Local2DMA);
+#else
+        curBuffDescrip->buffer = (uint8_t *)address;
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+        curBuffDescrip->length = txFrame->txBuffArray[index].length;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+        /* Request the checksum insertion for every buffer descriptor of the frame. */
+        curBuffDescrip->controlExtend1 =
+            (curBuffDescrip->controlExtend1 &
+             ~(ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK | ENET_BUFFDESCRIPTOR_TX_PROTOCOLCHECKSUM_MASK |
+               ENET_BUFFDESCRIPTOR_TX_IPCHECKSUM_MASK)) |
+            (txFrame->offloadFlags & (kENET_TxFrameIpChecksumInsert | kENET_TxFrameProtocolChecksumInsert));
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
+        control = curBuffDescrip->control & ~ENET_BUFFDESCRIPTOR_TX_LAST_MASK;
+        if (index == txFrame->txBuffNum - 1U)
+        {
+            /* Store the frame context to the last buffer descriptor of the frame. */
+            handle->txFrameContext[ringId][curBuffDescrip - handle->txBdBase[ringId]] = txFrame->context;
+            control |= ENET_BUFFDESCRIPTOR_TX_LAST_MASK;
+        }
+        if (index != 0)
+        {
+            control |= ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK;
+        }
+        curBuffDescrip->control = control;
+
+        /* Increase the buffer descriptor address. */
+        if (control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK)
+        {
+            curBuffDescrip = handle->txBdBase[ringId];
+        }
+        else
+        {
+            curBuffDescrip++;
+        }
+    }
+
+    /* Ensure the other buffer descriptors are updated before the first one is ready. */
+    __DSB();
+    firstBuffDescrip->control |= ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK;
+    /* Count the BDs only after they are ready, the reclaim walk takes a BD that is not ready as sent. */
+    handle->txBdSubmitted[ringId] += txFrame->txBuffNum;
+    handle->txBdCurrent[ringId] = curBuffDescrip;
+
+    /* Active the transmit buffer descriptor. */
+    ENET_ActiveSend(base, ringId);
+
+    return kStatus_Success;
+}
+
+static uint32_t ENET_ReclaimTxDescriptors(
+    ENET_Type *base, enet_handle_t *handle, uint32_t ringId, void **frameContexts, uint32_t contextNum)
+{
+    assert(ringId < FSL_FEATURE_ENET_QUEUE);
+
+    volatile enet_tx_bd_struct_t *curBuffDescrip = handle->txBdDirty[ringId];
+    uint32_t storedNum                           = 0U;
+    uint32_t index;
+    uint16_t control;
+    bool release;
+
+    /* Walk the buffer descriptors released by uDMA. The zero-copy ones are marked with the software owner one. */
+    while (handle->txBdReclaimed[ringId] != handle->txBdSubmitted[ringId])
+    {
+        control = curBuffDescrip->control;
+        if (control & ENET_BUFFDESCRIPTOR_TX_READY_MASK)
+        {
+            break;
+        }
+
+        release = ((control & ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK) != 0U) &&
+                  ((control & ENET_BUFFDESCRIPTOR_TX_LAST_MASK) != 0U) && (handle->txReclaimCallback != NULL);
+        if (release && (frameContexts != NULL) && (storedNum == contextNum))
+        {
+            break;
+        }
+
+        if (control & ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK)
+        {
+            index = curBuffDescrip - handle->txBdBase[ringId];
+            /* Restore the driver transmit buffer for the copy transmit APIs. */
+            curBuffDescrip->buffer  = handle->txBuffBase[ringId] + index * handle->txBuffSizeAlign[ringId];
+            curBuffDescrip->control = control & ~ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK;
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+            /* The copy transmit APIs do not request the checksum insertion. */
+            curBuffDescrip->controlExtend1 &=
+                ~(ENET_BUFFDESCRIPTOR_TX_PROTOCOLCHECKSUM_MASK | ENET_BUFFDESCRIPTOR_TX_IPCHECKSUM_MASK);
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
+            if (release)
+            {
+                if (frameContexts != NULL)
+                {
+                    frameContexts[storedNum++] = handle->txFrameContext[ringId][index];
+                }
+                else
+                {
+                    handle->txReclaimCallback(base, handle, ringId, handle->txFrameContext[ringId][index],
+                                              handle->txReclaimUserData);
+                }
+            }
+        }
+        handle->txBdReclaimed[ringId]++;
 
         /* Increase the buffer descriptor address. */
-        if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK)
+        if (control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK)
         {
-            handle->txBdCurrent[0] = handle->txBdBase[0];
+            curBuffDescrip = handle->txBdBase[ringId];
         }
         else
         {
-            handle->txBdCurrent[0]++;
+            curBuffDescrip++;
         }
-        /* Active the transmit buffer descriptor. */
-        ENET_ActiveSend(base, 0);
-
-        return kStatus_Success;
     }
-    else
-    {
-        /* One frame requires more than one transmit buffers. */
-        do
-        {
-#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
-            /* For enable the timestamp. */
-            if (isPtpEventMessage)
-            {
-                curBuffDescrip->controlExtend1 |= ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK;
-            }
-            else
-            {
-                curBuffDescrip->controlExtend1 &= ~ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK;
-            }
-#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
-
-            /* Increase the buffer descriptor address. */
-            if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK)
-            {
-                handle->txBdCurrent[0] = handle->txBdBase[0];
-            }
-            else
-            {
-                handle->txBdCurrent[0]++;
-            }
-            /* update the size left to be transmit. */
-            sizeleft = length - len;
-#if defined(FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET) && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
-            address = MEMORY_ConvertMemoryMapAddress((uint32_t)curBuffDescrip->buffer, kMEMORY_DMA2Local);
-#else
-            address = (uint32_t)curBuffDescrip->buffer;
-#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
-            if (sizeleft > handle->txBuffSizeAlign[0])
-            {
-                /* Data copy. */
-                memcpy((void *)address, data + len, handle->txBuffSizeAlign[0]);
-#if defined(FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL) && FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL
-                /* Add the cache clean maintain. */
-                DCACHE_CleanByRange(address, handle->txBuffSizeAlign[0]);
-#endif /* FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL */
-                /* Data length update. */
-                curBuffDescrip->length = handle->txBuffSizeAlign[0];
-                len += handle->txBuffSizeAlign[0];
-                /* Sets the control flag. */
-                curBuffDescrip->control &= ~ENET_BUFFDESCRIPTOR_TX_LAST_MASK;
-                curBuffDescrip->control |= ENET_BUFFDESCRIPTOR_TX_READY_MASK;
-                /* Active the transmit buffer descriptor*/
-                ENET_ActiveSend(base, 0);
-            }
-            else
-            {
-                memcpy((void *)address, data + len, sizeleft);
-#if defined(FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL) && FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL
-                /* Add the cache clean maintain. */
-                DCACHE_CleanByRange(address, sizeleft);
-#endif /* FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL */
-                curBuffDescrip->length = sizeleft;
-                /* Set Last buffer wrap flag. */
-                curBuffDescrip->control |= ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_LAST_MASK;
-                /* Active the transmit buffer descriptor. */
-                ENET_ActiveSend(base, 0);
-
-                return kStatus_Success;
-            }
 
-            /* Get the current buffer descriptor address. */
-            curBuffDescrip = handle->txBdCurrent[0];
+    handle->txBdDirty[ringId] = curBuffDescrip;
 
-        } while (!(curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_READY_MASK));
+    return storedNum;
+}
 
-        return kStatus_ENET_TxFrameBusy;
-    }
+/*!
+ * brief Transmits an ENET frame without copy for single ring.
+ *
+ * The transmit buffer descriptors are pointed to the fragments of the frame directly, so neither the
+ * flattening of the fragments nor the copy to the transmit buffers is needed. When the frame
+ * is sent, the reclaim callback set by ENET_SetTxReclaimCallback is called with txFrame->context.
+ * note The CRC is automatically appended to the data. The transmit timestamp is not captured for
+ * the frame sent by this API, use ENET_SendFrame for the PTP event frames.
+ * In enhanced buffer descriptor mode, the IP header and protocol checksums are inserted per frame
+ * according to txFrame->offloadFlags, the checksum fields in the frame should be cleared. The
+ * checksum insertion requires the transmit store and forward, so kENET_ControlStoreAndFwdDisable
+ * should not be set.
+ *
+ * param base  ENET peripheral base address.
+ * param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * param txFrame The transmit frame structure provided by application.
+ * retval kStatus_Success  Send frame succeed.
+ * retval kStatus_ENET_TxFrameOverLen  The total length of the fragments is over the maximum frame length.
+ * retval kStatus_ENET_TxFrameBusy  Not enough transmit buffer descriptors for the fragments.
+ */
+status_t ENET_StartTxFrame(ENET_Type *base, enet_handle_t *handle, const enet_tx_frame_struct_t *txFrame)
+{
+    return ENET_StartTxFrameCommon(base, handle, txFrame, 0);
 }
 
 #if FSL_FEATURE_ENET_QUEUE > 1
@@ -1959,6 +2719,48 @@ status_t ENET_ReadFrameMultiRing(
     return kStatus_ENET_RxFrameFail;
 }
 
+/*!
+ * brief Receives an ENET frame without copy for extended multi-ring.
+ *
+ * This usage is the same as the single ring, refer to ENET_GetRxFrame.
+ *
+ * param base  ENET peripheral base address.
+ * param handle The ENET handler structure. This is the same handler pointer used in the ENET_Init.
+ * param rxFrame The received frame structure provided by application.
+ * param ringId The ring index or ring number.
+ * return The execute status, refer to ENET_GetRxFrame.
+ */
+status_t ENET_GetRxFrameMultiRing(ENET_Type *base,
+                                  enet_handle_t *handle,
+                                  enet_rx_frame_struct_t *rxFrame,
+                                  uint32_t ringId)
+{
+    return ENET_GetRxFrameCommon(base, handle, rxFrame, ringId);
+}
+
+/*!
+ * brief Receives the received ENET frames in one pass without copy for extended multi-ring.
+ *
+ * This usage is the same as the single ring, refer to ENET_GetRxFrameBatch.
+ *
+ * param base  ENET peripheral base address.
+ * param handle The ENET handler structure. This is the same handler pointer used in the ENET_Init.
+ * param rxFrames The received frame structure array provided by application.
+ * param frameNum The number of structures in rxFrames.
+ * param drainedNum The number of frames drained, include the erroneous and the dropped frames.
+ * param ringId The ring index or ring number.
+ * return The execute status, refer to ENET_GetRxFrameBatch.
+ */
+status_t ENET_GetRxFrameBatchMultiRing(ENET_Type *base,
+                                       enet_handle_t *handle,
+                                       enet_rx_frame_struct_t *rxFrames,
+                                       uint32_t frameNum,
+                                       uint32_t *drainedNum,
+                                       uint32_t ringId)
+{
+    return ENET_GetRxFrameBatchCommon(base, handle, rxFrames, frameNum, drainedNum, ringId);
+}
+
 /*!
  * brief Transmits an ENET frame for extended multi-ring.
  * note The CRC is automatically appended to the data. Input the data
@@ -2000,7 +2802,7 @@ status_t ENET_SendFrameMultiRing(
 
     /* Check if the transmit buffer is ready. */
     curBuffDescrip = handle->txBdCurrent[ringId];
-    if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_READY_MASK)
+    if (curBuffDescrip->control & (ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK))
     {
         return kStatus_ENET_TxFrameBusy;
     }
@@ -2040,6 +2842,7 @@ status_t ENET_SendFrameMultiRing(
 
 #endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
         curBuffDescrip->control |= (ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_LAST_MASK);
+        handle->txBdSubmitted[ringId]++;
 
         /* Increase the buffer descriptor address. */
         if (curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK)
@@ -2103,6 +2906,7 @@ status_t ENET_SendFrameMultiRing(
                 /* Sets the control flag. */
                 curBuffDescrip->control &= ~ENET_BUFFDESCRIPTOR_TX_LAST_MASK;
                 curBuffDescrip->control |= ENET_BUFFDESCRIPTOR_TX_READY_MASK;
+                handle->txBdSubmitted[ringId]++;
 
                 /* Active the transmit buffer descriptor*/
                 ENET_ActiveSend(base, ringId);
@@ -2117,6 +2921,7 @@ status_t ENET_SendFrameMultiRing(
                 curBuffDescrip->length = sizeleft;
                 /* Set Last buffer wrap flag. */
                 curBuffDescrip->control |= ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_LAST_MASK;
+                handle->txBdSubmitted[ringId]++;
 
                 /* Active the transmit buffer descriptor. */
                 ENET_ActiveSend(base, ringId);
@@ -2126,11 +2931,31 @@ status_t ENET_SendFrameMultiRing(
 
             /* Get the current buffer descriptor address. */
             curBuffDescrip = handle->txBdCurrent[ringId];
-        } while (!(curBuffDescrip->control & ENET_BUFFDESCRIPTOR_TX_READY_MASK));
+        } while (!(curBuffDescrip->control &
+                   (ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_SOFTOWENER1_MASK)));
 
         return kStatus_ENET_TxFrameBusy;
     }
 }
+
+/*!
+ * brief Transmits an ENET frame without copy for extended multi-ring.
+ *
+ * This usage is the same as the single ring, refer to ENET_StartTxFrame.
+ *
+ * param base  ENET peripheral base address.
+ * param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * param txFrame The transmit frame structure provided by application.
+ * param ringId The ring index for transmission.
+ * return The execute status, refer to ENET_StartTxFrame.
+ */
+status_t ENET_StartTxFrameMultiRing(ENET_Type *base,
+                                    enet_handle_t *handle,
+                                    const enet_tx_frame_struct_t *txFrame,
+                                    uint32_t ringId)
+{
+    return ENET_StartTxFrameCommon(base, handle, txFrame, ringId);
+}
 #endif /*  FSL_FEATURE_ENET_QUEUE > 1 */
 
 /*!
@@ -2961,6 +3786,9 @@ status_t ENET_GetRxFrameTime(enet_handle_t *handle, enet_ptp_time_data_t *ptpTim
  * Enhanced buffer descriptor. so when the AVB feature is required, please make sure the
  * the "ENET_ENHANCEDBUFFERDESCRIPTOR_MODE" is defined.
  *
+ * The default AVB transmit scheduler of ENET_AVBGetDefaultTxSchedConfig is installed only when
+ * ENET_AVBSetTxScheduler has not been called, so the scheduler can be set before or after this API.
+ *
  * param base ENET peripheral base address.
  * param handle ENET handler pointer.
  * param config The ENET AVB feature configuration structure.
@@ -2985,6 +3813,273 @@ void ENET_AVBConfigure(ENET_Type *base, enet_handle_t *handle, const enet_avb_co
     /* Shall use the credit-based scheme for avb. */
     base->QOS &= ~ENET_QOS_TX_SCHEME_MASK;
     base->QOS |= ENET_QOS_RX_FLUSH0_MASK;
+
+    /* Map the SR classes to the shaped rings, unless the application has set its own scheduler. */
+    if (!handle->txSchedConfigured)
+    {
+        enet_avb_tx_sched_config_t schedConfig;
+        ENET_AVBGetDefaultTxSchedConfig(&schedConfig);
+        ENET_AVBSetTxScheduler(handle, &schedConfig);
+    }
+}
+
+static uint16_t ENET_AVBGetTxRingUsage(enet_handle_t *handle, uint32_t ringId)
+{
+    /* Each counter is only increased by one side, the difference wraps around with them. */
+    return (uint16_t)(handle->txBdSubmitted[ringId] - handle->txBdReclaimed[ringId]);
+}
+
+static status_t ENET_AVBCheckTxRing(ENET_Type *base, enet_handle_t *handle, uint32_t ringId)
+{
+    enet_avb_tx_ring_statistics_t *statistics = &handle->txRingStatistics[ringId];
+    uint16_t threshold                        = handle->txRingThreshold[ringId];
+    void *frameContexts[ENET_TX_RECLAIM_BATCH_NUM];
+    uint16_t usedBdNum;
+    uint32_t primask;
+    uint32_t contextNum;
+    uint32_t i;
+
+    usedBdNum = ENET_AVBGetTxRingUsage(handle, ringId);
+    if (usedBdNum > statistics->maxUsedBdNum)
+    {
+        statistics->maxUsedBdNum = usedBdNum;
+    }
+
+    if ((threshold != 0U) && (usedBdNum >= threshold))
+    {
+        /*
+         * The transmit interrupt may be disabled, reclaim the sent buffer descriptors before the refusal.
+         * The descriptors are reclaimed with the interrupts disabled, the reclaim callback is called
+         * for the released frames after the interrupts are enabled again.
+         */
+        do
+        {
+            primask    = DisableGlobalIRQ();
+            contextNum = ENET_ReclaimTxDescriptors(base, handle, ringId, frameContexts, ENET_TX_RECLAIM_BATCH_NUM);
+            EnableGlobalIRQ(primask);
+
+            for (i = 0U; i < contextNum; i++)
+            {
+                handle->txReclaimCallback(base, handle, ringId, frameContexts[i], handle->txReclaimUserData);
+            }
+        } while (contextNum == ENET_TX_RECLAIM_BATCH_NUM);
+
+        if (ENET_AVBGetTxRingUsage(handle, ringId) >= threshold)
+        {
+            return kStatus_ENET_TxFrameBusy;
+        }
+    }
+
+    return kStatus_Success;
+}
+
+static void ENET_AVBUpdateTxStatistics(enet_handle_t *handle, uint32_t ringId, status_t status, uint32_t length)
+{
+    enet_avb_tx_ring_statistics_t *statistics = &handle->txRingStatistics[ringId];
+
+    if (status == kStatus_Success)
+    {
+        statistics->txFrames++;
+        statistics->txBytes += length;
+    }
+    else if (status == kStatus_ENET_TxFrameBusy)
+    {
+        statistics->txBusy++;
+    }
+    else
+    {
+        /* Other errors are not counted. */
+    }
+}
+
+/*!
+ * brief Gets the default AVB transmit scheduler configuration.
+ *
+ * The default configuration maps the traffic class 3 (SR class A) to ring 1, the traffic class 2
+ * (SR class B) to ring 2 and the others to ring 0, without the ring threshold.
+ *
+ * param config The AVB transmit scheduler configuration structure pointer.
+ */
+void ENET_AVBGetDefaultTxSchedConfig(enet_avb_tx_sched_config_t *config)
+{
+    assert(config);
+
+    /* Initializes the configure structure to zero. */
+    memset(config, 0, sizeof(*config));
+
+    config->classToRing[3] = kENET_Ring1;
+    config->classToRing[2] = kENET_Ring2;
+}
+
+/*!
+ * brief Sets the AVB transmit scheduler.
+ *
+ * This sets the traffic class to ring map and the ring thresholds used by ENET_AVBSendFrame()
+ * and ENET_AVBStartTxFrame(), and clears the transmit statistics of all rings.
+ *
+ * param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * param config The AVB transmit scheduler configuration structure pointer.
+ */
+void ENET_AVBSetTxScheduler(enet_handle_t *handle, const enet_avb_tx_sched_config_t *config)
+{
+    assert(handle);
+    assert(config);
+
+    uint32_t count;
+
+    for (count = 0; count < ENET_AVB_TRAFFIC_CLASS_NUM; count++)
+    {
+        /* The classes mapped to a ring not in use fall back to ring 0. */
+        handle->txClassToRing[count] = (config->classToRing[count] < handle->ringNum) ? config->classToRing[count] : 0U;
+    }
+    for (count = 0; count < FSL_FEATURE_ENET_QUEUE; count++)
+    {
+        handle->txRingThreshold[count] = config->ringThreshold[count];
+    }
+    memset(handle->txRingStatistics, 0, sizeof(handle->txRingStatistics));
+    handle->txSchedConfigured = true;
+}
+
+/*!
+ * brief Gets the AVB traffic class of a frame.
+ *
+ * param data The frame data, starting with the destination MAC address.
+ * return The VLAN priority of the frame, 0 for the untagged frame.
+ */
+uint32_t ENET_AVBGetTrafficClass(const uint8_t *data)
+{
+    assert(data);
+
+    uint16_t type = ((uint16_t)data[ENET_PTP1588_ETHL2_PACKETTYPE_OFFSET] << 8U) |
+                    data[ENET_PTP1588_ETHL2_PACKETTYPE_OFFSET + 1U];
+
+    if (type != ENET_8021QVLAN)
+    {
+        return 0;
+    }
+
+    /* The priority is the top 3 bits of the tag control information. */
+    return (uint32_t)data[ENET_PTP1588_ETHL2_PACKETTYPE_OFFSET + 2U] >> 5U;
+}
+
+/*!
+ * brief Transmits an ENET frame on the ring of the traffic class.
+ *
+ * This is a non-blocking enqueue, it returns kStatus_ENET_TxFrameBusy at once when the ring is
+ * full or its used buffer descriptors reach the threshold, and the refusal is counted in the ring
+ * statistics. The usage is the same as ENET_SendFrameMultiRing().
+ *
+ * param base  ENET peripheral base address.
+ * param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * param data The data buffer provided by user to be send.
+ * param length The length of the data to be send.
+ * param trafficClass The traffic class of the frame, range from 0 ~ ENET_AVB_TRAFFIC_CLASS_NUM - 1.
+ * retval kStatus_Success  Send frame succeed.
+ * retval kStatus_ENET_TxFrameBusy  The ring is full or over the threshold.
+ * retval kStatus_ENET_TxFrameOverLen  The frame is too long.
+ */
+status_t ENET_AVBSendFrame(
+    ENET_Type *base, enet_handle_t *handle, uint8_t *data, uint32_t length, uint32_t trafficClass)
+{
+    assert(handle);
+    assert(trafficClass < ENET_AVB_TRAFFIC_CLASS_NUM);
+
+    uint32_t ringId = handle->txClassToRing[trafficClass];
+    status_t result;
+
+    result = ENET_AVBCheckTxRing(base, handle, ringId);
+    if (result == kStatus_Success)
+    {
+        result = ENET_SendFrameMultiRing(base, handle, data, length, ringId);
+    }
+    ENET_AVBUpdateTxStatistics(handle, ringId, result, length);
+
+    return result;
+}
+
+/*!
+ * brief Transmits an ENET frame without copy on the ring of the traffic class.
+ *
+ * This is the same as ENET_AVBSendFrame() for the zero-copy transmit, refer to ENET_StartTxFrame.
+ *
+ * param base  ENET peripheral base address.
+ * param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * param txFrame The transmit frame structure provided by application.
+ * param trafficClass The traffic class of the frame, range from 0 ~ ENET_AVB_TRAFFIC_CLASS_NUM - 1.
+ * return The execute status, refer to ENET_StartTxFrame.
+ */
+status_t ENET_AVBStartTxFrame(ENET_Type *base,
+                              enet_handle_t *handle,
+                              const enet_tx_frame_struct_t *txFrame,
+                              uint32_t trafficClass)
+{
+    assert(handle);
+    assert(txFrame);
+    assert(trafficClass < ENET_AVB_TRAFFIC_CLASS_NUM);
+
+    uint32_t ringId = handle->txClassToRing[trafficClass];
+    uint32_t length = 0;
+    uint32_t count;
+    status_t result;
+
+    for (count = 0; count < txFrame->txBuffNum; count++)
+    {
+        length += txFrame->txBuffArray[count].length;
+    }
+
+    result = ENET_AVBCheckTxRing(base, handle, ringId);
+    if (result == kStatus_Success)
+    {
+        result = ENET_StartTxFrameMultiRing(base, handle, txFrame, ringId);
+    }
+    ENET_AVBUpdateTxStatistics(handle, ringId, result, length);
+
+    return result;
+}
+
+/*!
+ * brief Gets the AVB transmit state of a ring.
+ *
+ * The used buffer descriptors are the ones given to the uDMA and not reclaimed yet, they are
+ * reclaimed in the transmit interrupt. The credit of the shaper is kept by the hardware and can't
+ * be read, the idle slope of the ring is given instead.
+ *
+ * param base  ENET peripheral base address.
+ * param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * param ringId The ring index, range from 0 ~ FSL_FEATURE_ENET_QUEUE - 1.
+ * param state The ring state structure pointer.
+ */
+void ENET_AVBGetTxRingState(ENET_Type *base, enet_handle_t *handle, uint32_t ringId, enet_avb_tx_ring_state_t *state)
+{
+    assert(handle);
+    assert(state);
+    assert(ringId < handle->ringNum);
+
+    state->usedBdNum  = ENET_AVBGetTxRingUsage(handle, ringId);
+    state->totalBdNum = handle->txBdNumber[ringId];
+    state->idleSlope  = 0;
+    state->statistics = handle->txRingStatistics[ringId];
+
+    /* Ring 0 is not shaped. */
+    if (ringId != kENET_Ring0)
+    {
+        state->idleSlope =
+            (uint16_t)((base->DMACFG[ringId - 1U] & ENET_DMACFG_IDLE_SLOPE_MASK) >> ENET_DMACFG_IDLE_SLOPE_SHIFT);
+    }
+}
+
+/*!
+ * brief Clears the AVB transmit statistics of a ring.
+ *
+ * param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * param ringId The ring index, range from 0 ~ FSL_FEATURE_ENET_QUEUE - 1.
+ */
+void ENET_AVBClearTxRingStatistics(enet_handle_t *handle, uint32_t ringId)
+{
+    assert(handle);
+    assert(ringId < handle->ringNum);
+
+    memset(&handle->txRingStatistics[ringId], 0, sizeof(enet_avb_tx_ring_statistics_t));
 }
 #endif /* FSL_FETAURE_ENET_HAS_AVB */
 #endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
@@ -3008,10 +4103,8 @@ void ENET_TransmitIRQHandler(ENET_Type *base, enet_handle_t *handle)
 #endif /* FSL_FEATURE_ENET_QUEUE > 1 */
 {
     assert(handle);
-    uint32_t mask = kENET_TxBufferInterrupt | kENET_TxFrameInterrupt;
-#if defined(ENET_ENHANCEDBUFFERDESCRIPTOR_MODE) || (FSL_FEATURE_ENET_QUEUE > 1)
+    uint32_t mask  = kENET_TxBufferInterrupt | kENET_TxFrameInterrupt;
     uint32_t index = 0;
-#endif /* ENET_ENHANCEDBUFFERDESCRIPTORMODE  || (FSL_FEATURE_ENET_QUEUE > 1) */
 
 /* Check if the transmit interrupt happen. */
 #if FSL_FEATURE_ENET_QUEUE > 1
@@ -3042,6 +4135,9 @@ void ENET_TransmitIRQHandler(ENET_Type *base, enet_handle_t *handle)
         /* Clear the transmit interrupt event. */
         base->EIR = mask;
 
+        /* Reclaim the transmitted buffer descriptors and release the fragments of the zero-copy frames. */
+        ENET_ReclaimTxDescriptors(base, handle, index, NULL, 0U);
+
         /* Callback function. */
         if (handle->callback)
         {
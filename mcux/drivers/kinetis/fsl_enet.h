@@ -24,7 +24,7 @@
 /*! @name Driver version */
 /*@{*/
 /*! @brief Defines the driver version. */
-#define FSL_ENET_DRIVER_VERSION (MAKE_VERSION(2, 2, 4)) /*!< Version 2.2.4. */
+#define FSL_ENET_DRIVER_VERSION (MAKE_VERSION(2, 2, 9)) /*!< Version 2.2.9. */
 /*@}*/
 
 /*! @name ENET DESCRIPTOR QUEUE */
@@ -95,8 +95,10 @@
 
 /*! @name Second extended control region bit masks of the transmit buffer descriptor. */
 /*@{*/
-#define ENET_BUFFDESCRIPTOR_TX_INTERRUPT_MASK 0x4000U /*!< Interrupt mask. */
-#define ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK 0x2000U /*!< Timestamp flag mask. */
+#define ENET_BUFFDESCRIPTOR_TX_INTERRUPT_MASK 0x4000U        /*!< Interrupt mask. */
+#define ENET_BUFFDESCRIPTOR_TX_TIMESTAMP_MASK 0x2000U        /*!< Timestamp flag mask. */
+#define ENET_BUFFDESCRIPTOR_TX_PROTOCOLCHECKSUM_MASK 0x1000U /*!< Insert protocol specific checksum mask. */
+#define ENET_BUFFDESCRIPTOR_TX_IPCHECKSUM_MASK 0x0800U       /*!< Insert IP header checksum mask. */
 #if defined(FSL_FEATURE_ENET_HAS_AVB) && FSL_FEATURE_ENET_HAS_AVB
 #define ENET_BUFFDESCRIPTOR_TX_USETXLAUNCHTIME_MASK 0x0100U /*!< Use the transmit launch time. */
 #define ENET_BUFFDESCRIPTOR_TX_FRAMETYPE_MASK 0x00F0U       /*!< Frame type mask. */
@@ -156,6 +158,8 @@ enum _enet_status
     kStatus_ENET_PtpTsRingFull  = MAKE_STATUS(kStatusGroup_ENET, 6U), /*!< Timestamp ring full. */
     kStatus_ENET_PtpTsRingEmpty = MAKE_STATUS(kStatusGroup_ENET, 7U)  /*!< Timestamp ring empty. */
 #endif                                                                /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+    ,
+    kStatus_ENET_RxFrameDrop = MAKE_STATUS(kStatusGroup_ENET, 8U) /*!< Rx frame is dropped, no buffer available. */
 };
 
 /*! @brief Defines the MII/RMII/RGMII mode for data interface between the MAC and the PHY. */
@@ -538,6 +542,41 @@ typedef struct _enet_avb_config
     uint16_t rxClassifyMatch[FSL_FEATURE_ENET_QUEUE - 1];    /*!< The classification match value for the ring. */
     enet_idle_slope_t idleSlope[FSL_FEATURE_ENET_QUEUE - 1]; /*!< The idle slope for certian bandwidth fraction. */
 } enet_avb_config_t;
+
+/*! @brief Defines the number of the AVB traffic classes, one for each VLAN priority. */
+#define ENET_AVB_TRAFFIC_CLASS_NUM 8U
+
+/*! @brief Defines the ENET AVB transmit scheduler configuration structure.
+ *
+ * The traffic class is the VLAN priority of the frame, see ENET_AVBGetTrafficClass(). Ring 0 is
+ * not shaped, ring 1 and ring 2 are shaped by the credit-based scheme with the idle slope set by
+ * ENET_AVBConfigure(), so the streams on them are not starved by the bulk traffic on ring 0.
+ * The ringThreshold limits the used buffer descriptors of a ring, it is used to give the
+ * backpressure to the bulk traffic before the ring is full. 0 means no limit.
+ */
+typedef struct _enet_avb_tx_sched_config
+{
+    uint8_t classToRing[ENET_AVB_TRAFFIC_CLASS_NUM]; /*!< The transmit ring of each traffic class. */
+    uint16_t ringThreshold[FSL_FEATURE_ENET_QUEUE];  /*!< The used buffer descriptor limit of each ring. */
+} enet_avb_tx_sched_config_t;
+
+/*! @brief Defines the ENET AVB transmit statistics of a ring. */
+typedef struct _enet_avb_tx_ring_statistics
+{
+    uint32_t txFrames;     /*!< Frames enqueued to the ring. */
+    uint32_t txBytes;      /*!< Bytes enqueued to the ring. */
+    uint32_t txBusy;       /*!< Frames refused because the ring is full or over the threshold. */
+    uint16_t maxUsedBdNum; /*!< Maximum number of the used buffer descriptors seen by enqueue. */
+} enet_avb_tx_ring_statistics_t;
+
+/*! @brief Defines the ENET AVB transmit state of a ring. */
+typedef struct _enet_avb_tx_ring_state
+{
+    uint16_t usedBdNum;                       /*!< Buffer descriptors owned by the uDMA or not reclaimed. */
+    uint16_t totalBdNum;                      /*!< Buffer descriptors of the ring. */
+    uint16_t idleSlope;                       /*!< The idle slope of the credit-based scheme, 0 if not shaped. */
+    enet_avb_tx_ring_statistics_t statistics; /*!< The statistics of the ring. */
+} enet_avb_tx_ring_state_t;
 #endif /* FSL_FEATURE_ENET_HAS_AVB */
 
 /*! @brief Defines the basic configuration structure for the ENET device.
@@ -599,9 +638,125 @@ typedef struct _enet_config
     uint8_t ringNum;                           /*!< Number of used rings. default with 1 -- single ring. */
 } enet_config_t;
 
+/*! @brief Defines the receive frame error flags reported by the batched receive interface. */
+enum _enet_rx_frame_error_flags
+{
+    kENET_RxFrameTruncErrFlag      = 0x001U, /*!< Frame is truncated. */
+    kENET_RxFrameOverrunErrFlag    = 0x002U, /*!< FIFO overrun. */
+    kENET_RxFrameLenViolateErrFlag = 0x004U, /*!< Length violation. */
+    kENET_RxFrameNoOctetErrFlag    = 0x008U, /*!< Non-octet aligned frame. */
+    kENET_RxFrameCrcErrFlag        = 0x010U, /*!< CRC error. */
+    kENET_RxFrameMacErrFlag        = 0x020U, /*!< MAC error, enhanced buffer descriptor only. */
+    kENET_RxFramePhyErrFlag        = 0x040U, /*!< PHY error, enhanced buffer descriptor only. */
+    kENET_RxFrameCollisionErrFlag  = 0x080U, /*!< Collision, enhanced buffer descriptor only. */
+    kENET_RxFrameAbnormalErrFlag   = 0x100U, /*!< Buffer descriptor with zero length. */
+    kENET_RxFrameDropErrFlag       = 0x200U  /*!< Frame is dropped because no new buffer is available or the
+                                                  rxBuffArray is too small. */
+};
+
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+/*! @brief Defines the receive frame attribute flags got from the enhanced receive buffer descriptor. */
+enum _enet_rx_frame_attribute_flags
+{
+    kENET_RxFrameIpv4Flag                = 0x01U, /*!< IPv4 frame. */
+    kENET_RxFrameIpv6Flag                = 0x02U, /*!< IPv6 frame. */
+    kENET_RxFrameVlanFlag                = 0x04U, /*!< VLAN tagged frame. */
+    kENET_RxFrameIpHeadChecksumErrFlag   = 0x08U, /*!< Non-IP frame or wrong IP header checksum. */
+    kENET_RxFrameProtocolChecksumErrFlag = 0x10U, /*!< Unknown protocol or wrong protocol checksum. */
+    kENET_RxFrameUnicastFlag             = 0x20U, /*!< Unicast frame. */
+    kENET_RxFrameMulticastFlag           = 0x40U, /*!< Multicast frame. */
+    kENET_RxFrameBroadcastFlag           = 0x80U  /*!< Broadcast frame. */
+};
+
+/*! @brief Defines the per frame checksum offload flags for the zero-copy transmit interface. */
+enum _enet_tx_frame_offload_flags
+{
+    kENET_TxFrameIpChecksumInsert       = ENET_BUFFDESCRIPTOR_TX_IPCHECKSUM_MASK,      /*!< Insert IP checksum. */
+    kENET_TxFrameProtocolChecksumInsert = ENET_BUFFDESCRIPTOR_TX_PROTOCOLCHECKSUM_MASK /*!< Insert protocol checksum. */
+};
+
+/*! @brief Defines the receive frame attribute got from the enhanced receive buffer descriptor.
+ *
+ * The IP header checksum is valid when the kENET_RxFrameIpv4Flag is set and the
+ * kENET_RxFrameIpHeadChecksumErrFlag is not set. The protocol checksum is valid when the
+ * kENET_RxFrameProtocolChecksumErrFlag is not set, the software checksum can be skipped for these frames.
+ */
+typedef struct _enet_rx_frame_attribute
+{
+    uint16_t flags;           /*!< Attribute flags, a logical OR of "_enet_rx_frame_attribute_flags". */
+    uint16_t payloadChecksum; /*!< Internal payload checksum computed by the receive accelerator. */
+    uint8_t headerLength;     /*!< Header length of the IP and protocol headers. */
+    uint8_t protocol;         /*!< Protocol type of the IP frame. */
+} enet_rx_frame_attribute_t;
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
+/*! @brief Defines the ENET data buffer structure used by the zero-copy frame interface. */
+typedef struct _enet_buffer_struct
+{
+    void *buffer;    /*!< The buffer which stores the whole or a partial frame. */
+    uint16_t length; /*!< The valid data length in the buffer. */
+} enet_buffer_struct_t;
+
+/*! @brief Defines the ENET receive frame structure used by the zero-copy receive interface.
+ *
+ * The application provides the rxBuffArray with rxBuffNum entries. After a frame is received,
+ * usedBuffNum entries of rxBuffArray hold the buffers which were loaned from the receive
+ * buffer descriptor ring, the application owns these buffers from then on.
+ */
+typedef struct _enet_rx_frame_struct
+{
+    enet_buffer_struct_t *rxBuffArray; /*!< Buffer array provided by application to hold the frame buffers. */
+    uint16_t rxBuffNum;                /*!< Number of entries in rxBuffArray. */
+    uint16_t usedBuffNum;              /*!< Number of entries in rxBuffArray used by the received frame. */
+    uint16_t totLen;                   /*!< Total length of the received frame. */
+    uint16_t errFlags; /*!< Error flags of the frame, a logical OR of "_enet_rx_frame_error_flags",
+                            only set by ENET_GetRxFrameBatch. The erroneous frame has no buffer in rxBuffArray. */
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+    enet_rx_frame_attribute_t rxAttribute; /*!< Classification and checksum result of the received frame. */
+#endif                                     /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+} enet_rx_frame_struct_t;
+
+/*! @brief ENET receive buffer allocate callback, returns NULL when no buffer is available.
+ *
+ * The returned buffer should be at least rxBuffSizeAlign bytes and be evenly divisible by ENET_BUFF_ALIGNMENT.
+ */
+typedef void *(*enet_rx_alloc_callback_t)(ENET_Type *base, void *userData, uint32_t ringId);
+
+/*! @brief ENET receive buffer free callback, returns a buffer got from enet_rx_alloc_callback_t. */
+typedef void (*enet_rx_free_callback_t)(ENET_Type *base, void *buffer, void *userData, uint32_t ringId);
+
+/*! @brief Defines the ENET transmit frame structure used by the zero-copy transmit interface.
+ *
+ * Each entry of txBuffArray is one fragment of the frame and is sent by one transmit buffer descriptor
+ * directly from the application memory. The fragments must not be changed or freed until the
+ * reclaim callback is called with the context of the frame.
+ */
+typedef struct _enet_tx_frame_struct
+{
+    const enet_buffer_struct_t *txBuffArray; /*!< Fragments of the frame provided by application. */
+    uint16_t txBuffNum;                      /*!< Number of fragments in txBuffArray. */
+    void *context;                           /*!< Application context passed to the reclaim callback. */
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+    uint16_t offloadFlags; /*!< Checksum offload, a logical OR of "_enet_tx_frame_offload_flags". */
+#endif                     /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+} enet_tx_frame_struct_t;
+
 /* Forward declaration of the handle typedef. */
 typedef struct _enet_handle enet_handle_t;
 
+/*! @brief ENET transmit reclaim callback, called when a zero-copy frame is transmitted. */
+typedef void (*enet_tx_reclaim_callback_t)(
+    ENET_Type *base, enet_handle_t *handle, uint32_t ringId, void *context, void *userData);
+
+/*! @brief Defines the transmit reclaim configuration structure for the zero-copy transmit interface. */
+typedef struct _enet_tx_reclaim_config
+{
+    enet_tx_reclaim_callback_t callback; /*!< Callback to release the fragments of a transmitted frame. */
+    void *userData;                      /*!< Callback function parameter. */
+    void **txFrameContext[FSL_FEATURE_ENET_QUEUE]; /*!< Context array of each used ring, the size of the array
+                                                        should be the transmit buffer descriptor number of the ring. */
+} enet_tx_reclaim_config_t;
+
 /*! @brief ENET callback function. */
 #if FSL_FEATURE_ENET_QUEUE > 1
 typedef void (*enet_callback_t)(
@@ -626,6 +781,18 @@ struct _enet_handle
     uint8_t ringNum;                                  /*!< Number of used rings. */
     enet_callback_t callback;                         /*!< Callback function. */
     void *userData;                                   /*!< Callback function parameter.*/
+    enet_rx_alloc_callback_t rxBuffAlloc;             /*!< Callback to allocate receive buffers for zero-copy. */
+    enet_rx_free_callback_t rxBuffFree;               /*!< Callback to free receive buffers for zero-copy. */
+    void *rxBuffUserData;                             /*!< Receive buffer callback function parameter. */
+    uint8_t *txBuffBase[FSL_FEATURE_ENET_QUEUE];      /*!< Transmit data buffer start address of the ring. */
+    volatile enet_tx_bd_struct_t
+        *txBdDirty[FSL_FEATURE_ENET_QUEUE];           /*!< The first transmit buffer descriptor to be reclaimed. */
+    void **txFrameContext[FSL_FEATURE_ENET_QUEUE];    /*!< Zero-copy transmit frame context array of the ring. */
+    uint16_t txBdNumber[FSL_FEATURE_ENET_QUEUE];      /*!< Transmit buffer descriptor number of the ring. */
+    volatile uint16_t txBdSubmitted[FSL_FEATURE_ENET_QUEUE]; /*!< Transmit BDs given to uDMA by the send APIs. */
+    volatile uint16_t txBdReclaimed[FSL_FEATURE_ENET_QUEUE]; /*!< Transmit BDs reclaimed, the rest are in flight. */
+    enet_tx_reclaim_callback_t txReclaimCallback;     /*!< Zero-copy transmit reclaim callback. */
+    void *txReclaimUserData;                          /*!< Zero-copy transmit reclaim callback parameter. */
 #ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
     volatile enet_tx_bd_struct_t
         *txBdDirtyStatic[FSL_FEATURE_ENET_QUEUE]; /*!< The dirty transmit buffer descriptor for error static update. */
@@ -634,7 +801,13 @@ struct _enet_handle
     uint64_t msTimerSecond;                     /*!< The second for Master PTP timer .*/
     enet_ptp_time_data_ring_t rxPtpTsDataRing;  /*!< Receive PTP 1588 time stamp data ring buffer. */
     enet_ptp_time_data_ring_t txPtpTsDataRing;  /*!< Transmit PTP 1588 time stamp data ring buffer. */
-#endif                                          /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+#if defined(FSL_FEATURE_ENET_HAS_AVB) && FSL_FEATURE_ENET_HAS_AVB
+    uint8_t txClassToRing[ENET_AVB_TRAFFIC_CLASS_NUM];                      /*!< Ring of each AVB traffic class. */
+    uint16_t txRingThreshold[FSL_FEATURE_ENET_QUEUE];                       /*!< AVB transmit BD limit of each ring. */
+    enet_avb_tx_ring_statistics_t txRingStatistics[FSL_FEATURE_ENET_QUEUE]; /*!< AVB transmit statistics. */
+    bool txSchedConfigured;                                                 /*!< AVB transmit scheduler is set. */
+#endif /* FSL_FEATURE_ENET_HAS_AVB */
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
 };
 
 /*******************************************************************************
@@ -921,6 +1094,9 @@ void ENET_LeaveMulticastGroup(ENET_Type *base, uint8_t *address);
  * Enhanced buffer descriptor. so when the AVB feature is required, please make sure the
  * the "ENET_ENHANCEDBUFFERDESCRIPTOR_MODE" is defined.
  *
+ * The default AVB transmit scheduler of ENET_AVBGetDefaultTxSchedConfig is installed only when
+ * ENET_AVBSetTxScheduler has not been called, so the scheduler can be set before or after this API.
+ *
  * @param base ENET peripheral base address.
  * @param handle ENET handler pointer.
  * @param config The ENET AVB feature configuration structure.
@@ -1052,6 +1228,20 @@ static inline void ENET_DisableInterrupts(ENET_Type *base, uint32_t mask)
     base->EIMR &= ~mask;
 }
 
+#if defined(FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE) && FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE
+/*!
+ * @brief Sets the ENET transmit and receive interrupt coalescing.
+ *
+ * With the interrupt coalescing, one transmit or receive buffer interrupt is generated after
+ * the frame count threshold is reached or the timer count threshold expires, so one interrupt
+ * covers many frames. This API can be called at run time to change the configuration set by ENET_Init.
+ *
+ * @param base  ENET peripheral base address.
+ * @param config The interrupt coalescing configuration, set to NULL to disable the interrupt coalescing.
+ */
+void ENET_SetInterruptCoalesce(ENET_Type *base, const enet_intcoalesce_config_t *config);
+#endif /* FSL_FEATURE_ENET_HAS_INTERRUPT_COALESCE */
+
 /*!
  * @brief Gets the ENET interrupt status flag.
  *
@@ -1214,6 +1404,118 @@ status_t ENET_ReadFrame(ENET_Type *base, enet_handle_t *handle, uint8_t *data, u
  */
 status_t ENET_SendFrame(ENET_Type *base, enet_handle_t *handle, const uint8_t *data, uint32_t length);
 
+/*!
+ * @brief Sets the receive buffer allocate and free callbacks for the zero-copy receive interface.
+ *
+ * This API should be called after calling ENET_Init and before calling ENET_GetRxFrame.
+ *
+ * @param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * @param rxBuffAlloc The callback to allocate a new receive buffer for the buffer descriptor.
+ * @param rxBuffFree The callback to free a buffer got from rxBuffAlloc.
+ * @param userData The callback function parameter.
+ */
+void ENET_SetRxBufferAllocCallback(enet_handle_t *handle,
+                                   enet_rx_alloc_callback_t rxBuffAlloc,
+                                   enet_rx_free_callback_t rxBuffFree,
+                                   void *userData);
+
+/*!
+ * @brief Receives an ENET frame without copy for single ring.
+ *
+ * This function hands the receive buffers holding the frame to the application and refills the
+ * receive buffer descriptors with new buffers got from the callback set by ENET_SetRxBufferAllocCallback.
+ * The frame data is not copied, the application owns the buffers in rxFrame->rxBuffArray after
+ * this function returns kStatus_Success and should free them after the frame is processed.
+ * In enhanced buffer descriptor mode, the classification and checksum result of the frame is
+ * stored in rxFrame->rxAttribute.
+ * This is an example:
+ * @code
+ *       enet_buffer_struct_t buffers[4];
+ *       enet_rx_frame_struct_t rxFrame = {buffers, 4, 0, 0};
+ *       status = ENET_GetRxFrame(ENET, &g_handle, &rxFrame);
+ *       if (status == kStatus_Success)
+ *       {
+ *           //Deliver rxFrame.usedBuffNum buffers to stack, free them after processing.
+ *       }
+ *       else if (status == kStatus_ENET_RxFrameError)
+ *       {
+ *           //Update the received buffer when a error frame is received.
+ *           ENET_ReadFrame(ENET, &g_handle, NULL, 0);
+ *       }
+ * @endcode
+ *
+ * @param base  ENET peripheral base address.
+ * @param handle The ENET handler structure. This is the same handler pointer used in the ENET_Init.
+ * @param rxFrame The received frame structure provided by application.
+ * @retval kStatus_Success Receive a frame successfully.
+ * @retval kStatus_ENET_RxFrameEmpty No frame received.
+ * @retval kStatus_ENET_RxFrameError Data error happens. ENET_ReadFrame should be called with NULL data
+ *         and NULL length to update the receive buffers.
+ * @retval kStatus_ENET_RxFrameDrop The frame is dropped because no new buffer is available or the
+ *         rxBuffArray is too small, the receive buffer descriptors are updated with the original buffers.
+ */
+status_t ENET_GetRxFrame(ENET_Type *base, enet_handle_t *handle, enet_rx_frame_struct_t *rxFrame);
+
+/*!
+ * @brief Receives the received ENET frames in one pass without copy for single ring.
+ *
+ * This function drains up to frameNum completed frames from the receive buffer descriptor ring
+ * in one pass, each frame is received the same way as ENET_GetRxFrame. The erroneous frames
+ * are discarded and reported with the error flags, so that the application needs one call
+ * per receive interrupt instead of one call per frame. It is recommended to use this function
+ * together with the interrupt coalescing, see ENET_SetInterruptCoalesce.
+ *
+ * @param base  ENET peripheral base address.
+ * @param handle The ENET handler structure. This is the same handler pointer used in the ENET_Init.
+ * @param rxFrames The received frame structure array provided by application, rxBuffArray and
+ *        rxBuffNum of each structure should be set before calling this function.
+ * @param frameNum The number of structures in rxFrames.
+ * @param drainedNum The number of frames drained, include the erroneous and the dropped frames. The dropped
+ *        frame is reported with kENET_RxFrameDropErrFlag, its buffer descriptors are updated with the original
+ *        buffers, the same as kStatus_ENET_RxFrameDrop of ENET_GetRxFrame.
+ * @retval kStatus_Success At least one frame is drained.
+ * @retval kStatus_ENET_RxFrameEmpty No frame received.
+ */
+status_t ENET_GetRxFrameBatch(ENET_Type *base,
+                              enet_handle_t *handle,
+                              enet_rx_frame_struct_t *rxFrames,
+                              uint32_t frameNum,
+                              uint32_t *drainedNum);
+
+/*!
+ * @brief Sets the transmit reclaim callback for the zero-copy transmit interface.
+ *
+ * This API should be called after calling ENET_Init and before calling ENET_StartTxFrame.
+ * The callback is called from ENET_TransmitIRQHandler once all buffer descriptors of a frame
+ * are released by the uDMA, so the transmit interrupt should be enabled.
+ *
+ * @param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * @param config The transmit reclaim configuration structure.
+ */
+void ENET_SetTxReclaimCallback(enet_handle_t *handle, const enet_tx_reclaim_config_t *config);
+
+/*!
+ * @brief Transmits an ENET frame without copy for single ring.
+ *
+ * The transmit buffer descriptors are pointed to the fragments of the frame directly, so neither the
+ * flattening of the fragments nor the copy to the transmit buffers is needed. When the frame
+ * is sent, the reclaim callback set by ENET_SetTxReclaimCallback is called with txFrame->context.
+ * @note The CRC is automatically appended to the data. The transmit timestamp is not captured for
+ * the frame sent by this API, use ENET_SendFrame for the PTP event frames.
+ * In enhanced buffer descriptor mode, the IP header and protocol checksums are inserted per frame
+ * according to txFrame->offloadFlags, the checksum fields in the frame should be cleared. The
+ * checksum insertion requires the transmit store and forward, so kENET_ControlStoreAndFwdDisable
+ * should not be set.
+ *
+ * @param base  ENET peripheral base address.
+ * @param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * @param txFrame The transmit frame structure provided by application.
+ * @retval kStatus_Success  Send frame succeed.
+ * @retval kStatus_ENET_TxFrameOverLen  The total length of the fragments is over the maximum frame length.
+ * @retval kStatus_ENET_TxFrameBusy  Not enough transmit buffer descriptors for the fragments.
+ */
+status_t ENET_StartTxFrame(ENET_Type *base, enet_handle_t *handle, const enet_tx_frame_struct_t *txFrame);
+
 #if FSL_FEATURE_ENET_QUEUE > 1
 /*!
  * @brief Gets the error statistics of received frame for extended multi-ring.
@@ -1254,6 +1556,22 @@ void ENET_GetRxErrBeforeReadFrameMultiRing(enet_handle_t *handle,
 status_t ENET_SendFrameMultiRing(
     ENET_Type *base, enet_handle_t *handle, uint8_t *data, uint32_t length, uint32_t ringId);
 
+/*!
+ * @brief Transmits an ENET frame without copy for extended multi-ring.
+ *
+ * This usage is the same as the single ring, refer to ENET_StartTxFrame.
+ *
+ * @param base  ENET peripheral base address.
+ * @param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * @param txFrame The transmit frame structure provided by application.
+ * @param ringId The ring index for transmission.
+ * @return The execute status, refer to ENET_StartTxFrame.
+ */
+status_t ENET_StartTxFrameMultiRing(ENET_Type *base,
+                                    enet_handle_t *handle,
+                                    const enet_tx_frame_struct_t *txFrame,
+                                    uint32_t ringId);
+
 #ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
 /*!
  * @brief Gets the ENET transmit frame statistics after the data send for extended multi-ring.
@@ -1310,6 +1628,42 @@ status_t ENET_GetRxFrameSizeMultiRing(enet_handle_t *handle, uint32_t *length, u
 status_t ENET_ReadFrameMultiRing(
     ENET_Type *base, enet_handle_t *handle, uint8_t *data, uint32_t length, uint32_t ringId);
 
+/*!
+ * @brief Receives an ENET frame without copy for extended multi-ring.
+ *
+ * This usage is the same as the single ring, refer to ENET_GetRxFrame.
+ *
+ * @param base  ENET peripheral base address.
+ * @param handle The ENET handler structure. This is the same handler pointer used in the ENET_Init.
+ * @param rxFrame The received frame structure provided by application.
+ * @param ringId The ring index or ring number.
+ * @return The execute status, refer to ENET_GetRxFrame.
+ */
+status_t ENET_GetRxFrameMultiRing(ENET_Type *base,
+                                  enet_handle_t *handle,
+                                  enet_rx_frame_struct_t *rxFrame,
+                                  uint32_t ringId);
+
+/*!
+ * @brief Receives the received ENET frames in one pass without copy for extended multi-ring.
+ *
+ * This usage is the same as the single ring, refer to ENET_GetRxFrameBatch.
+ *
+ * @param base  ENET peripheral base address.
+ * @param handle The ENET handler structure. This is the same handler pointer used in the ENET_Init.
+ * @param rxFrames The received frame structure array provided by application.
+ * @param frameNum The number of structures in rxFrames.
+ * @param drainedNum The number of frames drained, include the erroneous and the dropped frames.
+ * @param ringId The ring index or ring number.
+ * @return The execute status, refer to ENET_GetRxFrameBatch.
+ */
+status_t ENET_GetRxFrameBatchMultiRing(ENET_Type *base,
+                                       enet_handle_t *handle,
+                                       enet_rx_frame_struct_t *rxFrames,
+                                       uint32_t frameNum,
+                                       uint32_t *drainedNum,
+                                       uint32_t ringId);
+
 /*!
  * @brief The transmit IRQ handler.
  *
@@ -1381,6 +1735,103 @@ void ENET_ErrorIRQHandler(ENET_Type *base, enet_handle_t *handle);
 void ENET_CommonFrame0IRQHandler(ENET_Type *base);
 /* @} */
 
+#ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+#if defined(FSL_FEATURE_ENET_HAS_AVB) && FSL_FEATURE_ENET_HAS_AVB
+/*!
+ * @name ENET AVB transmit scheduler
+ * @{
+ */
+
+/*!
+ * @brief Gets the default AVB transmit scheduler configuration.
+ *
+ * The default configuration maps the traffic class 3 (SR class A) to ring 1, the traffic class 2
+ * (SR class B) to ring 2 and the others to ring 0, without the ring threshold.
+ *
+ * @param config The AVB transmit scheduler configuration structure pointer.
+ */
+void ENET_AVBGetDefaultTxSchedConfig(enet_avb_tx_sched_config_t *config);
+
+/*!
+ * @brief Sets the AVB transmit scheduler.
+ *
+ * This sets the traffic class to ring map and the ring thresholds used by ENET_AVBSendFrame()
+ * and ENET_AVBStartTxFrame(), and clears the transmit statistics of all rings.
+ *
+ * @param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * @param config The AVB transmit scheduler configuration structure pointer.
+ */
+void ENET_AVBSetTxScheduler(enet_handle_t *handle, const enet_avb_tx_sched_config_t *config);
+
+/*!
+ * @brief Gets the AVB traffic class of a frame.
+ *
+ * @param data The frame data, starting with the destination MAC address.
+ * @return The VLAN priority of the frame, 0 for the untagged frame.
+ */
+uint32_t ENET_AVBGetTrafficClass(const uint8_t *data);
+
+/*!
+ * @brief Transmits an ENET frame on the ring of the traffic class.
+ *
+ * This is a non-blocking enqueue, it returns kStatus_ENET_TxFrameBusy at once when the ring is
+ * full or its used buffer descriptors reach the threshold, and the refusal is counted in the ring
+ * statistics. The usage is the same as ENET_SendFrameMultiRing().
+ *
+ * @param base  ENET peripheral base address.
+ * @param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * @param data The data buffer provided by user to be send.
+ * @param length The length of the data to be send.
+ * @param trafficClass The traffic class of the frame, range from 0 ~ ENET_AVB_TRAFFIC_CLASS_NUM - 1.
+ * @retval kStatus_Success  Send frame succeed.
+ * @retval kStatus_ENET_TxFrameBusy  The ring is full or over the threshold.
+ * @retval kStatus_ENET_TxFrameOverLen  The frame is too long.
+ */
+status_t ENET_AVBSendFrame(
+    ENET_Type *base, enet_handle_t *handle, uint8_t *data, uint32_t length, uint32_t trafficClass);
+
+/*!
+ * @brief Transmits an ENET frame without copy on the ring of the traffic class.
+ *
+ * This is the same as ENET_AVBSendFrame() for the zero-copy transmit, refer to ENET_StartTxFrame.
+ *
+ * @param base  ENET peripheral base address.
+ * @param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * @param txFrame The transmit frame structure provided by application.
+ * @param trafficClass The traffic class of the frame, range from 0 ~ ENET_AVB_TRAFFIC_CLASS_NUM - 1.
+ * @return The execute status, refer to ENET_StartTxFrame.
+ */
+status_t ENET_AVBStartTxFrame(ENET_Type *base,
+                              enet_handle_t *handle,
+                              const enet_tx_frame_struct_t *txFrame,
+                              uint32_t trafficClass);
+
+/*!
+ * @brief Gets the AVB transmit state of a ring.
+ *
+ * The used buffer descriptors are the ones given to the uDMA and not reclaimed yet, they are
+ * reclaimed in the transmit interrupt. The credit of the shaper is kept by the hardware and can't
+ * be read, the idle slope of the ring is given instead.
+ *
+ * @param base  ENET peripheral base address.
+ * @param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * @param ringId The ring index, range from 0 ~ FSL_FEATURE_ENET_QUEUE - 1.
+ * @param state The ring state structure pointer.
+ */
+void ENET_AVBGetTxRingState(ENET_Type *base, enet_handle_t *handle, uint32_t ringId, enet_avb_tx_ring_state_t *state);
+
+/*!
+ * @brief Clears the AVB transmit statistics of a ring.
+ *
+ * @param handle The ENET handler pointer. This is the same handler pointer used in the ENET_Init.
+ * @param ringId The ring index, range from 0 ~ FSL_FEATURE_ENET_QUEUE - 1.
+ */
+void ENET_AVBClearTxRingStatistics(enet_handle_t *handle, uint32_t ringId);
+
+/* @} */
+#endif /* FSL_FEATURE_ENET_HAS_AVB */
+#endif /* ENET_ENHANCEDBUFFERDESCRIPTOR_MODE */
+
 #ifdef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
 /*!
  * @name ENET PTP 1588 function operation
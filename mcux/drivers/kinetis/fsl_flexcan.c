@@ -38,6 +38,13 @@
 #define CTRL1_MAX_TIME_QUANTA (1U + MAX_PROPSEG + 1U + MAX_PSEG1 + 1U + MAX_PSEG2 + 1U)
 #define CTRL1_MIN_TIME_QUANTA (8U)
 
+/* Number of the Message Buffer interrupt flag registers. */
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+#define FLEXCAN_MB_FLAG_WORD_NUM (2U)
+#else
+#define FLEXCAN_MB_FLAG_WORD_NUM (1U)
+#endif
+
 #define MAX_EPROPSEG (CAN_CBT_EPROPSEG_MASK >> CAN_CBT_EPROPSEG_SHIFT)
 #define MAX_EPSEG1 (CAN_CBT_EPSEG1_MASK >> CAN_CBT_EPSEG1_SHIFT)
 #define MAX_EPSEG2 (CAN_CBT_EPSEG2_MASK >> CAN_CBT_EPSEG2_SHIFT)
@@ -64,12 +71,14 @@
 /*! @brief FlexCAN Internal State. */
 enum _flexcan_state
 {
-    kFLEXCAN_StateIdle     = 0x0, /*!< MB/RxFIFO idle.*/
-    kFLEXCAN_StateRxData   = 0x1, /*!< MB receiving.*/
-    kFLEXCAN_StateRxRemote = 0x2, /*!< MB receiving remote reply.*/
-    kFLEXCAN_StateTxData   = 0x3, /*!< MB transmitting.*/
-    kFLEXCAN_StateTxRemote = 0x4, /*!< MB transmitting remote request.*/
-    kFLEXCAN_StateRxFifo   = 0x5, /*!< RxFIFO receiving.*/
+    kFLEXCAN_StateIdle       = 0x0, /*!< MB/RxFIFO idle.*/
+    kFLEXCAN_StateRxData     = 0x1, /*!< MB receiving.*/
+    kFLEXCAN_StateRxRemote   = 0x2, /*!< MB receiving remote reply.*/
+    kFLEXCAN_StateTxData     = 0x3, /*!< MB transmitting.*/
+    kFLEXCAN_StateTxRemote   = 0x4, /*!< MB transmitting remote request.*/
+    kFLEXCAN_StateRxFifo     = 0x5, /*!< RxFIFO receiving.*/
+    kFLEXCAN_StateRxFifoRing = 0x6, /*!< RxFIFO streaming into the frame ring.*/
+    kFLEXCAN_StateTxQueue    = 0x7, /*!< MB transmitting a frame of the Tx queue.*/
 };
 
 /*! @brief FlexCAN message buffer CODE for Rx buffers. */
@@ -101,6 +110,21 @@ enum _flexcan_mb_code_tx
 /* Typedef for interrupt handler. */
 typedef void (*flexcan_isr_t)(CAN_Type *base, flexcan_handle_t *handle);
 
+/* Bits of the standard and extended ID. */
+#define FLEXCAN_STD_ID_BITS (11U)
+#define FLEXCAN_EXT_ID_BITS (29U)
+
+/*! @brief FlexCAN Rx FIFO filter element layout of a filter format. */
+typedef struct _flexcan_rx_fifo_filter_layout
+{
+    uint8_t fieldNum;   /*!< Filter fields in an element. */
+    uint8_t fieldBits;  /*!< Bits of a filter field. */
+    uint8_t idLow[2];   /*!< Lowest ID bit compared, indexed by the frame format. */
+    uint8_t idWidth[2]; /*!< ID bits compared, indexed by the frame format. */
+    uint8_t idShift[2]; /*!< Position of the compared ID bits in the field, indexed by the frame format. */
+    uint32_t ideMask;   /*!< IDE bit in the field, 0 if the frame format is not compared. */
+} flexcan_rx_fifo_filter_layout_t;
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -149,14 +173,198 @@ static uint32_t FLEXCAN_GetFirstValidMb(CAN_Type *base);
 #endif
 
 /*!
- * @brief Check if Message Buffer interrupt is enabled.
+ * @brief Solve the interrupt of a Message Buffer or the Rx FIFO.
+ *
+ * This function reads the received frame or releases the sent Message Buffer according to
+ * the Message Buffer state, and clears the interrupt flag.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ * @param result The Message Buffer index of the interrupt flag.
+ * @return The status passed to the callback.
+ */
+static status_t FLEXCAN_SubHandlerForMB(CAN_Type *base, flexcan_handle_t *handle, uint32_t result);
+
+/*!
+ * @brief Solve the Rx FIFO interrupt in the streaming mode.
+ *
+ * This function drains all the available Rx FIFO frames into the frame ring, or counts the
+ * Rx FIFO overflow, and clears the interrupt flag.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ * @param result The Message Buffer index of the Rx FIFO interrupt flag.
+ * @return The status passed to the callback.
+ */
+static status_t FLEXCAN_SubHandlerForRxFifoRing(CAN_Type *base, flexcan_handle_t *handle, uint32_t result);
+
+/*!
+ * @brief Writes a FlexCAN Message to the Transmit Message Buffer with the local priority.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param mbIdx The FlexCAN Message Buffer index.
+ * @param txFrame Pointer to CAN message frame to be sent.
+ * @param priority The local priority written to the PRIO field of the Message Buffer ID.
+ * @retval kStatus_Success - Write Tx Message Buffer Successfully.
+ * @retval kStatus_Fail    - Tx Message Buffer is currently in use.
+ */
+static status_t FLEXCAN_WriteTxMbWithPriority(CAN_Type *base,
+                                              uint8_t mbIdx,
+                                              const flexcan_frame_t *txFrame,
+                                              uint32_t priority);
+
+/*!
+ * @brief Gets the Tx queue order key of a frame.
+ *
+ * @param frame The frame.
+ * @param priority The local priority.
+ * @return The key in the order of the bus arbitration, the local priority first.
+ */
+static uint64_t FLEXCAN_TxQueueGetKey(const flexcan_frame_t *frame, uint32_t priority);
+
+/*!
+ * @brief Checks whether a Tx queue entry is sent before another one.
+ *
+ * @param entry The Tx queue entry.
+ * @param other The other Tx queue entry.
+ * @return True if the entry has a smaller key, or the same key and is queued earlier.
+ */
+static bool FLEXCAN_TxQueueIsBefore(const flexcan_tx_queue_entry_t *entry, const flexcan_tx_queue_entry_t *other);
+
+/*!
+ * @brief Pushes an entry to the Tx queue heap.
+ *
+ * @param queue The Tx queue, which must not be full.
+ * @param entry The Tx queue entry.
+ */
+static void FLEXCAN_TxQueuePush(flexcan_tx_queue_t *queue, const flexcan_tx_queue_entry_t *entry);
+
+/*!
+ * @brief Pops the head entry from the Tx queue heap.
  *
- * This function check if Message Buffer interrupt is enabled.
+ * @param queue The Tx queue, which must not be empty.
+ * @param entry Pointer to get the head entry.
+ */
+static void FLEXCAN_TxQueuePop(flexcan_tx_queue_t *queue, flexcan_tx_queue_entry_t *entry);
+
+/*!
+ * @brief Starts sending a Tx queue entry in a Message Buffer of the Tx queue.
  *
  * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
  * @param mbIdx The FlexCAN Message Buffer index.
+ * @param entry The Tx queue entry.
+ */
+static void FLEXCAN_TxQueueStartMb(CAN_Type *base,
+                                   flexcan_handle_t *handle,
+                                   uint8_t mbIdx,
+                                   const flexcan_tx_queue_entry_t *entry);
+
+/*!
+ * @brief Fills the idle Message Buffers of the Tx queue from the queue head.
+ *
+ * The queue head waits while a frame of the same key is in a Message Buffer, as the Message Buffers
+ * of the same arbitration value are sent in the lowest index first order, not in the queue order.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ */
+static void FLEXCAN_TxQueueFillMbs(CAN_Type *base, flexcan_handle_t *handle);
+
+/*!
+ * @brief Solve the interrupt of a Message Buffer of the Tx queue.
+ *
+ * This function updates the Tx queue statistics and fills the Message Buffers again from the queue head.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ * @param result The Message Buffer index.
+ * @return The status passed to the callback.
+ */
+static status_t FLEXCAN_SubHandlerForTxQueue(CAN_Type *base, flexcan_handle_t *handle, uint32_t result);
+
+/*!
+ * @brief Counts the bits set.
+ *
+ * @param value The value to count.
+ * @return The quantity of the bits set.
+ */
+static uint32_t FLEXCAN_CountBits(uint32_t value);
+
+/*!
+ * @brief Splits a Rx FIFO filter rule into the blocks of IDs which match on the mask bits.
+ *
+ * @param rule The filter rule.
+ * @param blocks The blocks array.
+ * @param blockNum The size of the blocks array.
+ * @param num The quantity of blocks already in the array.
+ * @return The quantity of blocks with the rule, which may be larger than blockNum.
+ */
+static uint32_t FLEXCAN_RxFifoFilterSplitRule(const flexcan_rx_fifo_filter_rule_t *rule,
+                                              flexcan_rx_fifo_filter_block_t *blocks,
+                                              uint32_t blockNum,
+                                              uint32_t num);
+
+/*!
+ * @brief Gets the mask of the compared ID bits in a filter field.
+ *
+ * @param layout The filter element layout.
+ * @param format The frame format.
+ * @return The mask of the compared ID bits.
  */
-static bool FLEXCAN_IsMbIntEnabled(CAN_Type *base, uint8_t mbIdx);
+static uint32_t FLEXCAN_RxFifoFilterGetIdMask(const flexcan_rx_fifo_filter_layout_t *layout, uint32_t format);
+
+/*!
+ * @brief Gets the quantity of IDs accepted by a filter field.
+ *
+ * @param layout The filter element layout.
+ * @param field The filter field.
+ * @return The quantity of accepted IDs.
+ */
+static uint64_t FLEXCAN_RxFifoFilterGetIdNum(const flexcan_rx_fifo_filter_layout_t *layout,
+                                             const flexcan_rx_fifo_filter_block_t *field);
+
+/*!
+ * @brief Removes the filter fields which are contained in other fields.
+ *
+ * @param fields The filter fields array.
+ * @param num The quantity of the filter fields.
+ * @return The quantity of the remaining filter fields.
+ */
+static uint32_t FLEXCAN_RxFifoFilterReduce(flexcan_rx_fifo_filter_block_t *fields, uint32_t num);
+
+/*!
+ * @brief Gets the maximum filter elements of which the Rx FIFO fits into the Message Buffers.
+ *
+ * @param config The filter compiler configuration.
+ * @return The maximum filter elements, multiple of 8.
+ */
+static uint32_t FLEXCAN_RxFifoFilterGetMaxFilterNum(const flexcan_rx_fifo_filter_compiler_config_t *config);
+
+/*!
+ * @brief Gets the quantity of the filter elements which have individual masks.
+ *
+ * @param config The filter compiler configuration.
+ * @param filterNum The filter elements of RFFN, multiple of 8.
+ * @return The quantity of the filter elements with individual masks.
+ */
+static uint32_t FLEXCAN_RxFifoFilterGetMaskedElementNum(const flexcan_rx_fifo_filter_compiler_config_t *config,
+                                                        uint32_t filterNum);
+
+/*!
+ * @brief Fits the ID blocks into the filter fields of a filter format.
+ *
+ * @param config The filter compiler configuration.
+ * @param layout The filter element layout.
+ * @param blockNum The quantity of ID blocks at the head of the work memory.
+ * @param fieldNum The quantity of filter fields fitted after the ID blocks.
+ * @retval kStatus_Success The fields fit into the filter elements.
+ * @retval kStatus_Fail The fields can't fit into the filter elements.
+ */
+static status_t FLEXCAN_RxFifoFilterFit(const flexcan_rx_fifo_filter_compiler_config_t *config,
+                                        const flexcan_rx_fifo_filter_layout_t *layout,
+                                        uint32_t blockNum,
+                                        uint32_t *fieldNum);
 
 /*!
  * @brief Reset the FlexCAN Instance.
@@ -214,7 +422,8 @@ static void FLEXCAN_SetFDBaudRate(CAN_Type *base,
  *
  * This function gets the offset number of the specified mailbox.
  * Mailbox is not consecutive between memory regions when payload is not 8 bytes
- * so need to calculate the specified mailbox address.
+ * so need to calculate the specified mailbox address, the offsets are looked up in
+ * the tables precomputed for each payload size.
  * For example, in the first memory region, MB[0].CS address is 0x4002_4080. For 32 bytes
  * payload frame, the second mailbox is ((1/12)*512 + 1%12*40)/4 = 10, meaning 10 dword
  * after the 0x4002_4080, which is actually the address of mailbox MB[1].CS.
@@ -275,6 +484,55 @@ static const clock_ip_name_t s_flexcanPeriphClock[] = FLEXCAN_PERIPH_CLOCKS;
 /* FlexCAN ISR for transactional APIs. */
 static flexcan_isr_t s_flexcanIsr;
 
+/* Rx FIFO filter element layouts, indexed by the filter format A, B and C. */
+static const flexcan_rx_fifo_filter_layout_t s_flexcanRxFifoFilterLayout[] = {
+    {1U, 32U, {0U, 0U}, {11U, 29U}, {19U, 1U}, 1UL << 30U},
+    {2U, 16U, {0U, 15U}, {11U, 14U}, {3U, 0U}, 1UL << 14U},
+    {4U, 8U, {3U, 21U}, {8U, 8U}, {0U, 0U}, 0U},
+};
+
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
+/*
+    Mailbox offsets by dword for each payload size. Mailbox is not consecutive between the 512 bytes memory
+    regions when payload is not 8 bytes, offset = ((mbIdx / mbNumPerRegion) * 512 + (mbIdx % mbNumPerRegion) *
+    mbSize) / 4, with mbNumPerRegion 32/21/12/7 and mbSize 16/24/40/72 for 8/16/32/64 bytes payload.
+*/
+static const uint8_t s_flexcanFDMbOffset8B[] = {
+    0U,   4U,   8U,   12U,  16U,  20U,  24U,  28U,  32U,  36U,  40U,  44U,  48U,  52U,  56U,  60U,
+    64U,  68U,  72U,  76U,  80U,  84U,  88U,  92U,  96U,  100U, 104U, 108U, 112U, 116U, 120U, 124U,
+    128U, 132U, 136U, 140U, 144U, 148U, 152U, 156U, 160U, 164U, 168U, 172U, 176U, 180U, 184U, 188U,
+    192U, 196U, 200U, 204U, 208U, 212U, 216U, 220U, 224U, 228U, 232U, 236U, 240U, 244U, 248U, 252U};
+static const uint8_t s_flexcanFDMbOffset16B[] = {
+    0U,   6U,   12U,  18U,  24U,  30U,  36U,  42U,  48U,  54U,  60U,  66U,  72U,  78U,  84U,  90U,  96U,  102U, 108U,
+    114U, 120U, 128U, 134U, 140U, 146U, 152U, 158U, 164U, 170U, 176U, 182U, 188U, 194U, 200U, 206U, 212U, 218U, 224U,
+    230U, 236U, 242U, 248U};
+static const uint8_t s_flexcanFDMbOffset32B[] = {0U,   10U,  20U,  30U,  40U,  50U,  60U,  70U,
+                                                 80U,  90U,  100U, 110U, 128U, 138U, 148U, 158U,
+                                                 168U, 178U, 188U, 198U, 208U, 218U, 228U, 238U};
+static const uint8_t s_flexcanFDMbOffset64B[] = {0U,   18U,  36U,  54U,  72U,  90U,  108U,
+                                                 128U, 146U, 164U, 182U, 200U, 218U, 236U};
+
+/* Array of mailbox offset tables, indexed by the FDCTRL[MBDSR0] payload size. */
+static const uint8_t *const s_flexcanFDMbOffset[] = {s_flexcanFDMbOffset8B, s_flexcanFDMbOffset16B,
+                                                     s_flexcanFDMbOffset32B, s_flexcanFDMbOffset64B};
+
+/* Array of mailbox number in the offset tables, indexed by the FDCTRL[MBDSR0] payload size. */
+static const uint8_t s_flexcanFDMbNum[] = {(uint8_t)ARRAY_SIZE(s_flexcanFDMbOffset8B),
+                                           (uint8_t)ARRAY_SIZE(s_flexcanFDMbOffset16B),
+                                           (uint8_t)ARRAY_SIZE(s_flexcanFDMbOffset32B),
+                                           (uint8_t)ARRAY_SIZE(s_flexcanFDMbOffset64B)};
+
+/* CAN FD DLC to payload length in bytes. */
+static const uint8_t s_flexcanFDDlcToLength[] = {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U};
+
+/* CAN FD DLC to payload length in dwords. */
+static const uint8_t s_flexcanFDDlcToWords[] = {0U, 1U, 1U, 1U, 1U, 2U, 2U, 2U, 2U, 3U, 4U, 5U, 6U, 8U, 12U, 16U};
+
+/* CAN FD DLC for the payload lengths 9 ~ 64 bytes, indexed by (length - 1) / 4. */
+static const uint8_t s_flexcanFDLengthToDlc[] = {8U, 8U, 9U, 10U, 11U, 12U, 13U, 13U,
+                                                 14U, 14U, 14U, 14U, 15U, 15U, 15U, 15U};
+#endif
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -469,39 +727,6 @@ static uint32_t FLEXCAN_GetFirstValidMb(CAN_Type *base)
 }
 #endif
 
-static bool FLEXCAN_IsMbIntEnabled(CAN_Type *base, uint8_t mbIdx)
-{
-    /* Assertion. */
-    assert(mbIdx < (uint8_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base));
-
-#if (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
-    if (mbIdx < 32U)
-    {
-#endif
-        if (0U != (base->IMASK1 & (((uint32_t)1U << mbIdx))))
-        {
-            return true;
-        }
-        else
-        {
-            return false;
-        }
-#if (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
-    }
-    else
-    {
-        if (base->IMASK2 & (1U << (mbIdx - 32U)))
-        {
-            return true;
-        }
-        else
-        {
-            return false;
-        }
-    }
-#endif
-}
-
 static void FLEXCAN_Reset(CAN_Type *base)
 {
     /* The module must should be first exit from low power
@@ -1230,31 +1455,11 @@ bool FLEXCAN_CalculateImprovedTimingValues(uint32_t baudRate, uint32_t sourceClo
 #if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
 static uint32_t FLEXCAN_GetFDMailboxOffset(CAN_Type *base, uint8_t mbIdx)
 {
-    uint32_t dataSize;
-    uint32_t offset = 0;
-    dataSize        = (base->FDCTRL & CAN_FDCTRL_MBDSR0_MASK) >> CAN_FDCTRL_MBDSR0_SHIFT;
-    switch (dataSize)
-    {
-        case (uint32_t)kFLEXCAN_8BperMB:
-            offset = (((uint32_t)mbIdx / 32U) * 512U + ((uint32_t)mbIdx % 32U) * 16U);
-            break;
-        case (uint32_t)kFLEXCAN_16BperMB:
-            offset = (((uint32_t)mbIdx / 21U) * 512U + ((uint32_t)mbIdx % 21U) * 24U);
-            break;
-        case (uint32_t)kFLEXCAN_32BperMB:
-            offset = (((uint32_t)mbIdx / 12U) * 512U + ((uint32_t)mbIdx % 12U) * 40U);
-            break;
-        case (uint32_t)kFLEXCAN_64BperMB:
-            offset = (((uint32_t)mbIdx / 7U) * 512U + ((uint32_t)mbIdx % 7U) * 72U);
-            break;
-        default:
-            /* All the cases have been listed above, the default clause should not be reached. */
-            assert(false);
-            break;
-    }
-    /* To get the dword aligned offset, need to divide by 4. */
-    offset = offset / 4U;
-    return offset;
+    uint32_t dataSize = (base->FDCTRL & CAN_FDCTRL_MBDSR0_MASK) >> CAN_FDCTRL_MBDSR0_SHIFT;
+
+    assert(mbIdx < s_flexcanFDMbNum[dataSize]);
+
+    return s_flexcanFDMbOffset[dataSize][mbIdx];
 }
 
 /*!
@@ -1473,10 +1678,7 @@ void FLEXCAN_SetFDTxMbConfig(CAN_Type *base, uint8_t mbIdx, bool enable)
 
     /* Calculate the DWORD number, dataSize 0/1/2/3 corresponds to 8/16/32/64
        Bytes payload. */
-    for (cnt = 0; cnt < (dataSize + 1U); cnt++)
-    {
-        payload_dword *= 2U;
-    }
+    payload_dword = (uint8_t)(2U << dataSize);
 
     /* Clean ID. */
     mbAddr[offset + 1U] = 0x0U;
@@ -1725,126 +1927,633 @@ void FLEXCAN_SetRxFifoConfig(CAN_Type *base, const flexcan_rx_fifo_config_t *con
     FLEXCAN_ExitFreezeMode(base);
 }
 
-#if (defined(FSL_FEATURE_FLEXCAN_HAS_RX_FIFO_DMA) && FSL_FEATURE_FLEXCAN_HAS_RX_FIFO_DMA)
-/*!
- * brief Enables or disables the FlexCAN Rx FIFO DMA request.
- *
- * This function enables or disables the DMA feature of FlexCAN build-in Rx FIFO.
- *
- * param base FlexCAN peripheral base address.
- * param enable true to enable, false to disable.
- */
-void FLEXCAN_EnableRxFifoDMA(CAN_Type *base, bool enable)
+static uint32_t FLEXCAN_CountBits(uint32_t value)
 {
-    if (enable)
+    uint32_t count = 0U;
+
+    while (0U != value)
     {
-        /* Enter Freeze Mode. */
-        FLEXCAN_EnterFreezeMode(base);
+        value &= value - 1U;
+        count++;
+    }
 
-        /* Enable FlexCAN DMA. */
-        base->MCR |= CAN_MCR_DMA_MASK;
+    return count;
+}
 
-        /* Exit Freeze Mode. */
-        FLEXCAN_ExitFreezeMode(base);
-    }
-    else
+static uint32_t FLEXCAN_RxFifoFilterSplitRule(const flexcan_rx_fifo_filter_rule_t *rule,
+                                              flexcan_rx_fifo_filter_block_t *blocks,
+                                              uint32_t blockNum,
+                                              uint32_t num)
+{
+    uint32_t idMask = (kFLEXCAN_FrameFormatExtend == rule->format) ? ((1UL << FLEXCAN_EXT_ID_BITS) - 1U) :
+                                                                      ((1UL << FLEXCAN_STD_ID_BITS) - 1U);
+    uint32_t low    = rule->idLow;
+    uint32_t size;
+
+    assert(rule->idLow <= rule->idHigh);
+    assert(rule->idHigh <= idMask);
+
+    do
     {
-        /* Enter Freeze Mode. */
-        FLEXCAN_EnterFreezeMode(base);
+        /* The largest block aligned to its size from low, within the range. */
+        size = (0U == low) ? (idMask + 1U) : (low & (0U - low));
+        while ((size - 1U) > (rule->idHigh - low))
+        {
+            size >>= 1U;
+        }
 
-        /* Disable FlexCAN DMA. */
-        base->MCR &= ~CAN_MCR_DMA_MASK;
+        if (num < blockNum)
+        {
+            blocks[num].value  = low;
+            blocks[num].mask   = idMask & ~(size - 1U);
+            blocks[num].format = rule->format;
+        }
+        num++;
+        low += size;
+    } while ((low - 1U) < rule->idHigh);
 
-        /* Exit Freeze Mode. */
-        FLEXCAN_ExitFreezeMode(base);
-    }
+    return num;
 }
-#endif /* FSL_FEATURE_FLEXCAN_HAS_RX_FIFO_DMA */
 
-#if (defined(FSL_FEATURE_FLEXCAN_HAS_ERRATA_6032) && FSL_FEATURE_FLEXCAN_HAS_ERRATA_6032)
-/*!
- * FlexCAN: A frame with wrong ID or payload is transmitted into
- * the CAN bus when the Message Buffer under transmission is
- * either aborted or deactivated while the CAN bus is in the Bus Idle state
- *
- * This function to do workaround for ERR006032
- *
- * param base FlexCAN peripheral base address.
- * param mbIdx The FlexCAN Message Buffer index.
- */
-static void FLEXCAN_ERRATA_6032(CAN_Type *base, volatile uint32_t *mbCSAddr)
+static uint32_t FLEXCAN_RxFifoFilterGetIdMask(const flexcan_rx_fifo_filter_layout_t *layout, uint32_t format)
 {
-    uint32_t dbg_temp      = 0U;
-    uint32_t u32TempCS     = 0U;
-    uint32_t u32Timeout    = DELAY_BUSIDLE;
-    uint32_t u32TempIMASK1 = base->IMASK1;
-/*after backup all interruption, disable ALL interruption*/
-#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
-    uint32_t u32TempIMASK2 = base->IMASK2;
-    base->IMASK2           = 0;
-#endif
-    base->IMASK1 = 0;
-    dbg_temp     = (uint32_t)(base->DBG1);
-    switch (dbg_temp & CAN_DBG1_CFSM_MASK)
+    return ((1UL << layout->idWidth[format]) - 1U) << layout->idShift[format];
+}
+
+static uint64_t FLEXCAN_RxFifoFilterGetIdNum(const flexcan_rx_fifo_filter_layout_t *layout,
+                                             const flexcan_rx_fifo_filter_block_t *field)
+{
+    uint64_t idNum;
+    uint32_t maskBits;
+
+    if (0U == layout->ideMask)
     {
-        case RXINTERMISSION:
-            if (CBN_VALUE3 == (dbg_temp & CAN_DBG1_CBN_MASK))
-            {
-                /*wait until CFSM is different from RXINTERMISSION */
-                while (RXINTERMISSION == (base->DBG1 & CAN_DBG1_CFSM_MASK))
-                {
-                    __NOP();
-                }
-            }
-            break;
-        case TXINTERMISSION:
-            if (CBN_VALUE3 == (dbg_temp & CAN_DBG1_CBN_MASK))
-            {
-                /*wait until CFSM is different from TXINTERMISSION*/
-                while (TXINTERMISSION == (base->DBG1 & CAN_DBG1_CFSM_MASK))
-                {
-                    __NOP();
-                }
-            }
-            break;
-        default:
-            break;
+        /* The same field bits are compared for standard and extended frames. */
+        maskBits = FLEXCAN_CountBits(field->mask &
+                                     FLEXCAN_RxFifoFilterGetIdMask(layout, (uint32_t)kFLEXCAN_FrameFormatStandard));
+        idNum    = (1ULL << (FLEXCAN_STD_ID_BITS - maskBits)) + (1ULL << (FLEXCAN_EXT_ID_BITS - maskBits));
     }
-    /*Anyway, BUSIDLE need to delay*/
-    if (BUSIDLE == (base->DBG1 & CAN_DBG1_CFSM_MASK))
+    else if (0U != (field->value & layout->ideMask))
     {
-        while (u32Timeout-- > 0)
+        maskBits = FLEXCAN_CountBits(field->mask &
+                                     FLEXCAN_RxFifoFilterGetIdMask(layout, (uint32_t)kFLEXCAN_FrameFormatExtend));
+        idNum    = 1ULL << (FLEXCAN_EXT_ID_BITS - maskBits);
+    }
+    else
+    {
+        maskBits = FLEXCAN_CountBits(field->mask &
+                                     FLEXCAN_RxFifoFilterGetIdMask(layout, (uint32_t)kFLEXCAN_FrameFormatStandard));
+        idNum    = 1ULL << (FLEXCAN_STD_ID_BITS - maskBits);
+    }
+
+    return idNum;
+}
+
+static uint32_t FLEXCAN_RxFifoFilterReduce(flexcan_rx_fifo_filter_block_t *fields, uint32_t num)
+{
+    uint32_t i = 0U;
+    uint32_t j;
+    bool contained;
+
+    while (i < num)
+    {
+        contained = false;
+        for (j = 0U; j < num; j++)
         {
-            __NOP();
+            /* Field j accepts all the IDs of field i. */
+            if ((j != i) && (fields[j].format == fields[i].format) && (0U == (fields[j].mask & ~fields[i].mask)) &&
+                (0U == ((fields[j].value ^ fields[i].value) & fields[j].mask)))
+            {
+                contained = true;
+                break;
+            }
         }
 
-        /*Write 0x0 into Code field of CS word.*/
-        u32TempCS = (uint32_t)(*mbCSAddr);
-        u32TempCS &= ~CAN_CS_CODE_MASK;
-        *mbCSAddr = u32TempCS;
+        if (contained)
+        {
+            fields[i] = fields[num - 1U];
+            num--;
+        }
+        else
+        {
+            i++;
+        }
     }
-    /*restore interruption*/
-    base->IMASK1 = u32TempIMASK1;
-#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
-    base->IMASK2 = u32TempIMASK2;
-#endif
+
+    return num;
 }
-#endif
 
-/*!
- * brief Writes a FlexCAN Message to the Transmit Message Buffer.
- *
- * This function writes a CAN Message to the specified Transmit Message Buffer
- * and changes the Message Buffer state to start CAN Message transmit. After
- * that the function returns immediately.
+static uint32_t FLEXCAN_RxFifoFilterGetMaxFilterNum(const flexcan_rx_fifo_filter_compiler_config_t *config)
+{
+    /* The Rx FIFO and the filter table occupy 8 + 2 * RFFN Message Buffers, RFFN is filterNum / 8 - 1. */
+    return MIN((uint32_t)config->maxFilterNum, (((uint32_t)config->mbNum - 6U) * 4U) & ~7U);
+}
+
+static uint32_t FLEXCAN_RxFifoFilterGetMaskedElementNum(const flexcan_rx_fifo_filter_compiler_config_t *config,
+                                                        uint32_t filterNum)
+{
+    uint32_t num = 0U;
+
+    if (config->enableIndividMask)
+    {
+        /* Only the elements in the occupied Message Buffers have individual masks, the others use RXFGMASK. */
+        num = MIN(6U + (filterNum / 4U), FLEXCAN_RX_FIFO_INDIVIDUAL_MASK_NUM);
+    }
+
+    return num;
+}
+
+static status_t FLEXCAN_RxFifoFilterFit(const flexcan_rx_fifo_filter_compiler_config_t *config,
+                                        const flexcan_rx_fifo_filter_layout_t *layout,
+                                        uint32_t blockNum,
+                                        uint32_t *fieldNum)
+{
+    const flexcan_rx_fifo_filter_block_t *blocks = config->blocks;
+    flexcan_rx_fifo_filter_block_t *fields       = &config->blocks[blockNum];
+    uint32_t fullMask = layout->ideMask | FLEXCAN_RxFifoFilterGetIdMask(layout, (uint32_t)kFLEXCAN_FrameFormatExtend);
+    uint32_t filterNum = FLEXCAN_RxFifoFilterGetMaxFilterNum(config);
+    uint32_t fieldCap  = filterNum * layout->fieldNum;
+    uint32_t maskCap   = FLEXCAN_RxFifoFilterGetMaskedElementNum(config, filterNum) * layout->fieldNum;
+    uint32_t bestI     = 0U;
+    uint32_t bestJ     = 0U;
+    int64_t bestCost   = 0;
+    flexcan_rx_fifo_filter_block_t merged;
+    flexcan_rx_fifo_filter_block_t best;
+    uint32_t commonMask;
+    uint32_t maskedNum;
+    uint32_t newMaskedNum;
+    uint32_t format;
+    uint32_t idMask;
+    uint32_t num;
+    uint32_t i, j;
+    int64_t cost;
+    bool found;
+    bool fit;
+
+    /* Project the ID blocks to the compared bits of the filter fields. */
+    for (i = 0U; i < blockNum; i++)
+    {
+        format          = (uint32_t)blocks[i].format;
+        idMask          = (1UL << layout->idWidth[format]) - 1U;
+        fields[i].value = ((blocks[i].value >> layout->idLow[format]) & idMask) << layout->idShift[format];
+        fields[i].mask  = (((blocks[i].mask >> layout->idLow[format]) & idMask) << layout->idShift[format]) |
+                          layout->ideMask;
+        if ((uint32_t)kFLEXCAN_FrameFormatExtend == format)
+        {
+            fields[i].value |= layout->ideMask;
+        }
+        else
+        {
+            /* The extended only ID bits are not compared for standard frames, regard them as matched. */
+            fields[i].mask |=
+                fullMask & ~(layout->ideMask |
+                             FLEXCAN_RxFifoFilterGetIdMask(layout, (uint32_t)kFLEXCAN_FrameFormatStandard));
+        }
+        fields[i].value &= fields[i].mask;
+        /* The format C compares the same bits for both frame formats. */
+        fields[i].format = (0U == layout->ideMask) ? kFLEXCAN_FrameFormatStandard : blocks[i].format;
+    }
+    num = FLEXCAN_RxFifoFilterReduce(fields, blockNum);
+
+    while (true)
+    {
+        if (!config->enableIndividMask)
+        {
+            /* Without individual masks, the global mask is used by all the filter elements. */
+            commonMask = fullMask;
+            for (i = 0U; i < num; i++)
+            {
+                commonMask &= fields[i].mask;
+            }
+            for (i = 0U; i < num; i++)
+            {
+                fields[i].mask = commonMask;
+                fields[i].value &= commonMask;
+            }
+            num = FLEXCAN_RxFifoFilterReduce(fields, num);
+        }
+
+        maskedNum = 0U;
+        for (i = 0U; i < num; i++)
+        {
+            if (fields[i].mask != fullMask)
+            {
+                maskedNum++;
+            }
+        }
+        fit = (num <= fieldCap) && ((!config->enableIndividMask) || (maskedNum <= maskCap));
+
+        /*
+            Merge the two fields which accept the least more IDs. When the fields fit, only the merges which
+            don't accept more IDs are done to reduce the filter elements.
+        */
+        found = false;
+        for (i = 0U; i < num; i++)
+        {
+            for (j = i + 1U; j < num; j++)
+            {
+                if (fields[i].format != fields[j].format)
+                {
+                    continue;
+                }
+
+                merged.mask   = fields[i].mask & fields[j].mask & ~(fields[i].value ^ fields[j].value);
+                merged.value  = fields[i].value & merged.mask;
+                merged.format = fields[i].format;
+
+                if (fit)
+                {
+                    newMaskedNum = maskedNum - ((fields[i].mask != fullMask) ? 1U : 0U) -
+                                   ((fields[j].mask != fullMask) ? 1U : 0U) + ((merged.mask != fullMask) ? 1U : 0U);
+                    if ((!config->enableIndividMask) || (newMaskedNum > maskCap))
+                    {
+                        continue;
+                    }
+                }
+                else if ((num <= fieldCap) && ((fields[i].mask == fullMask) || (fields[j].mask == fullMask)))
+                {
+                    /* Only merging two masked fields reduces the individual masks needed. */
+                    continue;
+                }
+                else
+                {
+                    /* Any two fields can be merged. */
+                }
+
+                cost = (int64_t)FLEXCAN_RxFifoFilterGetIdNum(layout, &merged) -
+                       (int64_t)FLEXCAN_RxFifoFilterGetIdNum(layout, &fields[i]) -
+                       (int64_t)FLEXCAN_RxFifoFilterGetIdNum(layout, &fields[j]);
+                if ((fit && (cost > 0)) || (found && (cost >= bestCost)))
+                {
+                    continue;
+                }
+
+                found    = true;
+                bestCost = cost;
+                bestI    = i;
+                bestJ    = j;
+                best     = merged;
+            }
+        }
+
+        if (!found)
+        {
+            break;
+        }
+
+        fields[bestI] = best;
+        fields[bestJ] = fields[num - 1U];
+        num           = FLEXCAN_RxFifoFilterReduce(fields, num - 1U);
+    }
+
+    *fieldNum = num;
+
+    return fit ? kStatus_Success : kStatus_Fail;
+}
+
+/*!
+ * brief Compiles the Rx FIFO filter for the accepted ID rules.
+ *
+ * This function packs the ID ranges of the rules into the Rx FIFO filter table and masks. The ranges
+ * are split into blocks of IDs which match on the mask bits, and the blocks are fitted into the filter
+ * elements of format A, B and C. When the blocks don't fit, the blocks which accept the least more IDs
+ * are merged. The format with the least false accepted IDs is used, then the one with the least filter
+ * elements. Data and remote frames are both accepted. Note that the format C filter compares 8 ID bits
+ * for both standard and extended frames.
+ *
+ * The Rx FIFO and its filter table occupy 8 + 2 * RFFN Message Buffers, so the filter elements are
+ * limited by the mbNum of the configuration. Only the filter elements within the occupied Message
+ * Buffers, and at most the first 32 ones, have individual masks. The masked fields are put into these
+ * elements, the other elements match exactly with the Rx FIFO global mask.
+ *
+ * This function is pure computation and doesn't access the FlexCAN.
+ *
+ * param config Pointer to the filter compiler configuration structure.
+ * param fifoConfig Pointer to the Rx FIFO configuration structure. The idFilterTable should have
+ *                   maxFilterNum elements, idFilterNum and idFilterType are set by this function.
+ * param program Pointer to the compiled filter masks.
+ * retval kStatus_Success The filter is compiled.
+ * retval kStatus_OutOfRange The work memory is not enough.
+ * retval kStatus_Fail The rules can't fit into the filter elements.
+ */
+status_t FLEXCAN_CompileRxFifoFilter(const flexcan_rx_fifo_filter_compiler_config_t *config,
+                                     flexcan_rx_fifo_config_t *fifoConfig,
+                                     flexcan_rx_fifo_filter_program_t *program)
+{
+    assert(NULL != config);
+    assert((NULL != config->rules) || (0U == config->ruleNum));
+    assert(NULL != config->blocks);
+    assert((0U != config->maxFilterNum) && (config->maxFilterNum <= 128U) && (0U == (config->maxFilterNum % 8U)));
+    /* The Rx FIFO with 8 filter elements occupies 8 Message Buffers. */
+    assert(config->mbNum >= 8U);
+    assert(NULL != fifoConfig);
+    assert(NULL != fifoConfig->idFilterTable);
+    assert(NULL != program);
+
+    uint32_t blockNum             = 0U;
+    uint32_t bestType             = 0U;
+    uint32_t bestElementNum       = 0U;
+    uint64_t bestFalseAcceptIdNum = 0U;
+    bool found                    = false;
+    const flexcan_rx_fifo_filter_layout_t *layout;
+    flexcan_rx_fifo_filter_block_t *fields;
+    flexcan_rx_fifo_filter_block_t field;
+    uint32_t fieldNum;
+    uint32_t elementNum;
+    uint32_t filterNum;
+    uint32_t maskedFieldNum;
+    uint64_t idNum;
+    uint32_t element;
+    uint32_t mask;
+    uint32_t shift;
+    uint32_t type;
+    uint32_t i, j;
+
+    (void)memset(program, 0, sizeof(*program));
+
+    for (i = 0U; i < config->ruleNum; i++)
+    {
+        blockNum = FLEXCAN_RxFifoFilterSplitRule(&config->rules[i], config->blocks, config->blockNum, blockNum);
+    }
+    /* The same amount of work memory is needed to fit the blocks. */
+    if ((blockNum * 2U) > config->blockNum)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    if (0U == blockNum)
+    {
+        /* No rules, all frames rejected. */
+        fifoConfig->idFilterNum  = 0U;
+        fifoConfig->idFilterType = kFLEXCAN_RxFifoFilterTypeD;
+        program->globalMask      = 0xFFFFFFFFU;
+        return kStatus_Success;
+    }
+
+    /* The blocks of the overlapped rules are contained in others, then the blocks are disjoint. */
+    blockNum = FLEXCAN_RxFifoFilterReduce(config->blocks, blockNum);
+    for (i = 0U; i < blockNum; i++)
+    {
+        program->wantedIdNum +=
+            1ULL << (((kFLEXCAN_FrameFormatExtend == config->blocks[i].format) ? FLEXCAN_EXT_ID_BITS :
+                                                                                 FLEXCAN_STD_ID_BITS) -
+                     FLEXCAN_CountBits(config->blocks[i].mask));
+    }
+
+    for (type = (uint32_t)kFLEXCAN_RxFifoFilterTypeA; type <= (uint32_t)kFLEXCAN_RxFifoFilterTypeC; type++)
+    {
+        layout = &s_flexcanRxFifoFilterLayout[type];
+        if (kStatus_Success == FLEXCAN_RxFifoFilterFit(config, layout, blockNum, &fieldNum))
+        {
+            idNum  = 0U;
+            fields = &config->blocks[blockNum];
+            for (i = 0U; i < fieldNum; i++)
+            {
+                idNum += FLEXCAN_RxFifoFilterGetIdNum(layout, &fields[i]);
+            }
+            idNum -= program->wantedIdNum;
+            elementNum = (fieldNum + layout->fieldNum - 1U) / layout->fieldNum;
+
+            if ((!found) || (idNum < bestFalseAcceptIdNum) ||
+                ((idNum == bestFalseAcceptIdNum) && (elementNum < bestElementNum)))
+            {
+                found                = true;
+                bestType             = type;
+                bestElementNum       = elementNum;
+                bestFalseAcceptIdNum = idNum;
+            }
+        }
+    }
+
+    if (!found)
+    {
+        return kStatus_Fail;
+    }
+
+    /* Fit again with the best format. */
+    layout = &s_flexcanRxFifoFilterLayout[bestType];
+    (void)FLEXCAN_RxFifoFilterFit(config, layout, blockNum, &fieldNum);
+    fields = &config->blocks[blockNum];
+
+    /* The masked fields first, they use the individual masks of the first elements. */
+    mask = layout->ideMask | FLEXCAN_RxFifoFilterGetIdMask(layout, (uint32_t)kFLEXCAN_FrameFormatExtend);
+    j    = 0U;
+    for (i = 0U; i < fieldNum; i++)
+    {
+        if (fields[i].mask != mask)
+        {
+            field     = fields[j];
+            fields[j] = fields[i];
+            fields[i] = field;
+            j++;
+        }
+    }
+    maskedFieldNum = j;
+
+    /* The global mask for the filter elements without individual mask. */
+    program->globalMask = 0U;
+    for (shift = 0U; shift < 32U; shift += layout->fieldBits)
+    {
+        program->globalMask |= (config->enableIndividMask ? mask : fields[0].mask) << shift;
+    }
+
+    for (i = 0U; i < bestElementNum; i++)
+    {
+        element = 0U;
+        mask    = 0U;
+        for (j = 0U; j < layout->fieldNum; j++)
+        {
+            /* The last field is repeated in the unused fields of the last element. */
+            shift = 32U - ((j + 1U) * layout->fieldBits);
+            element |= fields[MIN((i * layout->fieldNum) + j, fieldNum - 1U)].value << shift;
+            mask |= fields[MIN((i * layout->fieldNum) + j, fieldNum - 1U)].mask << shift;
+        }
+        fifoConfig->idFilterTable[i] = element;
+        if (i < FLEXCAN_RX_FIFO_INDIVIDUAL_MASK_NUM)
+        {
+            program->individualMask[i] = mask;
+        }
+    }
+
+    /*
+        The last element is repeated up to the filter elements of RFFN, instead of the unused elements. A
+        larger RFFN is used when the masked fields need more elements with individual masks.
+    */
+    filterNum = (bestElementNum + 7U) & ~7U;
+    while (config->enableIndividMask &&
+           ((FLEXCAN_RxFifoFilterGetMaskedElementNum(config, filterNum) * layout->fieldNum) < maskedFieldNum))
+    {
+        filterNum += 8U;
+    }
+    for (i = bestElementNum; i < filterNum; i++)
+    {
+        fifoConfig->idFilterTable[i] = fifoConfig->idFilterTable[bestElementNum - 1U];
+        if (i < FLEXCAN_RX_FIFO_INDIVIDUAL_MASK_NUM)
+        {
+            program->individualMask[i] = program->individualMask[bestElementNum - 1U];
+        }
+    }
+
+    program->individualMaskNum = (uint8_t)FLEXCAN_RxFifoFilterGetMaskedElementNum(config, filterNum);
+    program->falseAcceptIdNum = bestFalseAcceptIdNum;
+    fifoConfig->idFilterNum   = (uint8_t)filterNum;
+    fifoConfig->idFilterType  = (flexcan_rx_fifo_filter_type_t)bestType;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Configures the FlexCAN Rx FIFO with the compiled filter.
+ *
+ * This function sets the individual masks and the Rx FIFO global mask of the compiled filter, then
+ * configures and enables the Rx FIFO. The individual masks must not be more than the Message Buffers
+ * of the instance.
+ *
+ * param base FlexCAN peripheral base address.
+ * param fifoConfig Pointer to the Rx FIFO configuration structure compiled by FLEXCAN_CompileRxFifoFilter().
+ * param program Pointer to the compiled filter masks.
+ */
+void FLEXCAN_SetRxFifoFilterProgram(CAN_Type *base,
+                                    const flexcan_rx_fifo_config_t *fifoConfig,
+                                    const flexcan_rx_fifo_filter_program_t *program)
+{
+    assert(NULL != fifoConfig);
+    assert(NULL != program);
+    assert(program->individualMaskNum <= FLEXCAN_RX_FIFO_INDIVIDUAL_MASK_NUM);
+
+    /* RXIMR exists only for the Message Buffers of the instance. */
+    uint32_t maskNum = MIN((uint32_t)program->individualMaskNum,
+                           (uint32_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base));
+    uint32_t i;
+
+    assert(program->individualMaskNum == maskNum);
+
+    /* Enter Freeze Mode. */
+    FLEXCAN_EnterFreezeMode(base);
+
+    /* Set the masks before the Rx FIFO is enabled. */
+    for (i = 0U; i < maskNum; i++)
+    {
+        base->RXIMR[i] = program->individualMask[i];
+    }
+    base->RXFGMASK = program->globalMask;
+
+    /* Exit Freeze Mode. */
+    FLEXCAN_ExitFreezeMode(base);
+
+    FLEXCAN_SetRxFifoConfig(base, fifoConfig, true);
+}
+
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_RX_FIFO_DMA) && FSL_FEATURE_FLEXCAN_HAS_RX_FIFO_DMA)
+/*!
+ * brief Enables or disables the FlexCAN Rx FIFO DMA request.
+ *
+ * This function enables or disables the DMA feature of FlexCAN build-in Rx FIFO.
+ *
+ * param base FlexCAN peripheral base address.
+ * param enable true to enable, false to disable.
+ */
+void FLEXCAN_EnableRxFifoDMA(CAN_Type *base, bool enable)
+{
+    if (enable)
+    {
+        /* Enter Freeze Mode. */
+        FLEXCAN_EnterFreezeMode(base);
+
+        /* Enable FlexCAN DMA. */
+        base->MCR |= CAN_MCR_DMA_MASK;
+
+        /* Exit Freeze Mode. */
+        FLEXCAN_ExitFreezeMode(base);
+    }
+    else
+    {
+        /* Enter Freeze Mode. */
+        FLEXCAN_EnterFreezeMode(base);
+
+        /* Disable FlexCAN DMA. */
+        base->MCR &= ~CAN_MCR_DMA_MASK;
+
+        /* Exit Freeze Mode. */
+        FLEXCAN_ExitFreezeMode(base);
+    }
+}
+#endif /* FSL_FEATURE_FLEXCAN_HAS_RX_FIFO_DMA */
+
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_ERRATA_6032) && FSL_FEATURE_FLEXCAN_HAS_ERRATA_6032)
+/*!
+ * FlexCAN: A frame with wrong ID or payload is transmitted into
+ * the CAN bus when the Message Buffer under transmission is
+ * either aborted or deactivated while the CAN bus is in the Bus Idle state
+ *
+ * This function to do workaround for ERR006032
  *
  * param base FlexCAN peripheral base address.
  * param mbIdx The FlexCAN Message Buffer index.
- * param txFrame Pointer to CAN message frame to be sent.
- * retval kStatus_Success - Write Tx Message Buffer Successfully.
- * retval kStatus_Fail    - Tx Message Buffer is currently in use.
  */
-status_t FLEXCAN_WriteTxMb(CAN_Type *base, uint8_t mbIdx, const flexcan_frame_t *txFrame)
+static void FLEXCAN_ERRATA_6032(CAN_Type *base, volatile uint32_t *mbCSAddr)
+{
+    uint32_t dbg_temp      = 0U;
+    uint32_t u32TempCS     = 0U;
+    uint32_t u32Timeout    = DELAY_BUSIDLE;
+    uint32_t u32TempIMASK1 = base->IMASK1;
+/*after backup all interruption, disable ALL interruption*/
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+    uint32_t u32TempIMASK2 = base->IMASK2;
+    base->IMASK2           = 0;
+#endif
+    base->IMASK1 = 0;
+    dbg_temp     = (uint32_t)(base->DBG1);
+    switch (dbg_temp & CAN_DBG1_CFSM_MASK)
+    {
+        case RXINTERMISSION:
+            if (CBN_VALUE3 == (dbg_temp & CAN_DBG1_CBN_MASK))
+            {
+                /*wait until CFSM is different from RXINTERMISSION */
+                while (RXINTERMISSION == (base->DBG1 & CAN_DBG1_CFSM_MASK))
+                {
+                    __NOP();
+                }
+            }
+            break;
+        case TXINTERMISSION:
+            if (CBN_VALUE3 == (dbg_temp & CAN_DBG1_CBN_MASK))
+            {
+                /*wait until CFSM is different from TXINTERMISSION*/
+                while (TXINTERMISSION == (base->DBG1 & CAN_DBG1_CFSM_MASK))
+                {
+                    __NOP();
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    /*Anyway, BUSIDLE need to delay*/
+    if (BUSIDLE == (base->DBG1 & CAN_DBG1_CFSM_MASK))
+    {
+        while (u32Timeout-- > 0)
+        {
+            __NOP();
+        }
+
+        /*Write 0x0 into Code field of CS word.*/
+        u32TempCS = (uint32_t)(*mbCSAddr);
+        u32TempCS &= ~CAN_CS_CODE_MASK;
+        *mbCSAddr = u32TempCS;
+    }
+    /*restore interruption*/
+    base->IMASK1 = u32TempIMASK1;
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+    base->IMASK2 = u32TempIMASK2;
+#endif
+}
+#endif
+
+static status_t FLEXCAN_WriteTxMbWithPriority(CAN_Type *base,
+                                              uint8_t mbIdx,
+                                              const flexcan_frame_t *txFrame,
+                                              uint32_t priority)
 {
     /* Assertion. */
     assert(mbIdx <= (base->MCR & CAN_MCR_MAXMB_MASK));
@@ -1864,7 +2573,7 @@ status_t FLEXCAN_WriteTxMb(CAN_Type *base, uint8_t mbIdx, const flexcan_frame_t
         base->MB[mbIdx].CS = (base->MB[mbIdx].CS & ~CAN_CS_CODE_MASK) | CAN_CS_CODE(kFLEXCAN_TxMbInactive);
 
         /* Fill Message ID field. */
-        base->MB[mbIdx].ID = txFrame->id;
+        base->MB[mbIdx].ID = txFrame->id | CAN_ID_PRIO(priority);
 
         /* Fill Message Format field. */
         if ((uint32_t)kFLEXCAN_FrameFormatExtend == txFrame->format)
@@ -1902,6 +2611,24 @@ status_t FLEXCAN_WriteTxMb(CAN_Type *base, uint8_t mbIdx, const flexcan_frame_t
     }
 }
 
+/*!
+ * brief Writes a FlexCAN Message to the Transmit Message Buffer.
+ *
+ * This function writes a CAN Message to the specified Transmit Message Buffer
+ * and changes the Message Buffer state to start CAN Message transmit. After
+ * that the function returns immediately.
+ *
+ * param base FlexCAN peripheral base address.
+ * param mbIdx The FlexCAN Message Buffer index.
+ * param txFrame Pointer to CAN message frame to be sent.
+ * retval kStatus_Success - Write Tx Message Buffer Successfully.
+ * retval kStatus_Fail    - Tx Message Buffer is currently in use.
+ */
+status_t FLEXCAN_WriteTxMb(CAN_Type *base, uint8_t mbIdx, const flexcan_frame_t *txFrame)
+{
+    return FLEXCAN_WriteTxMbWithPriority(base, mbIdx, txFrame, 0U);
+}
+
 #if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
 /*!
  * brief Writes a FlexCAN FD Message to the Transmit Message Buffer.
@@ -1933,7 +2660,10 @@ status_t FLEXCAN_WriteFDTxMb(CAN_Type *base, uint8_t mbIdx, const flexcan_fd_fra
     uint32_t availoffset = FLEXCAN_GetFDMailboxOffset(base, FLEXCAN_GetFirstValidMb(base));
 #endif
     volatile uint32_t *mbAddr = &(base->MB[0].CS);
-    uint32_t offset           = FLEXCAN_GetFDMailboxOffset(base, mbIdx);
+    uint32_t offset;
+
+    assert(mbIdx < s_flexcanFDMbNum[dataSize]);
+    offset = s_flexcanFDMbOffset[dataSize][mbIdx];
 
 #if (defined(FSL_FEATURE_FLEXCAN_HAS_ERRATA_6032) && FSL_FEATURE_FLEXCAN_HAS_ERRATA_6032)
     FLEXCAN_ERRATA_6032(base, &(mbAddr[offset]));
@@ -1962,12 +2692,9 @@ status_t FLEXCAN_WriteFDTxMb(CAN_Type *base, uint8_t mbIdx, const flexcan_fd_fra
         cs_temp |= CAN_CS_CODE(kFLEXCAN_TxMbDataOrRemote) | CAN_CS_DLC(txFrame->length) | CAN_CS_EDL(1) |
                    CAN_CS_BRS(txFrame->brs);
 
-        /* Calculate the DWORD number, dataSize 0/1/2/3 corresponds to 8/16/32/64
-           Bytes payload. */
-        for (cnt = 0; cnt < (dataSize + 1U); cnt++)
-        {
-            payload_dword *= 2U;
-        }
+        /* Only the DWORDs covered by the DLC are loaded, limited by the Message Buffer payload size,
+           dataSize 0/1/2/3 corresponds to 8/16/32/64 Bytes payload. */
+        payload_dword = MIN(s_flexcanFDDlcToWords[txFrame->length], (uint8_t)(2U << dataSize));
 
         /* Load Message Payload and Activate Tx Message Buffer. */
         for (cnt = 0; cnt < payload_dword; cnt++)
@@ -2098,7 +2825,10 @@ status_t FLEXCAN_ReadFDRxMb(CAN_Type *base, uint8_t mbIdx, flexcan_fd_frame_t *r
     dataSize                  = (base->FDCTRL & CAN_FDCTRL_MBDSR0_MASK) >> CAN_FDCTRL_MBDSR0_SHIFT;
     uint8_t payload_dword     = 1;
     volatile uint32_t *mbAddr = &(base->MB[0].CS);
-    uint32_t offset           = FLEXCAN_GetFDMailboxOffset(base, mbIdx);
+    uint32_t offset;
+
+    assert(mbIdx < s_flexcanFDMbNum[dataSize]);
+    offset = s_flexcanFDMbOffset[dataSize][mbIdx];
 
     /* Read CS field of Rx Message Buffer to lock Message Buffer. */
     cs_temp = mbAddr[offset];
@@ -2124,41 +2854,164 @@ status_t FLEXCAN_ReadFDRxMb(CAN_Type *base, uint8_t mbIdx, flexcan_fd_frame_t *r
         /* Get the message length. */
         rxFrame->length = (uint8_t)((cs_temp & CAN_CS_DLC_MASK) >> CAN_CS_DLC_SHIFT);
 
-        /* Get the time stamp. */
-        rxFrame->timestamp = (uint16_t)((cs_temp & CAN_CS_TIME_STAMP_MASK) >> CAN_CS_TIME_STAMP_SHIFT);
+        /* Get the time stamp. */
+        rxFrame->timestamp = (uint16_t)((cs_temp & CAN_CS_TIME_STAMP_MASK) >> CAN_CS_TIME_STAMP_SHIFT);
+
+        /* Only the DWORDs covered by the DLC are stored, limited by the Message Buffer payload size,
+           dataSize 0/1/2/3 corresponds to 8/16/32/64 Bytes payload. */
+        payload_dword = MIN(s_flexcanFDDlcToWords[rxFrame->length], (uint8_t)(2U << dataSize));
+
+        /* Store Message Payload. */
+        for (cnt = 0; cnt < payload_dword; cnt++)
+        {
+            rxFrame->dataWord[cnt] = mbAddr[offset + 2U + cnt];
+        }
+
+        /* Read free-running timer to unlock Rx Message Buffer. */
+        (void)base->TIMER;
+
+        if ((uint32_t)kFLEXCAN_RxMbFull == rx_code)
+        {
+            return kStatus_Success;
+        }
+        else
+        {
+            return kStatus_FLEXCAN_RxOverflow;
+        }
+    }
+    else
+    {
+        /* Read free-running timer to unlock Rx Message Buffer. */
+        (void)base->TIMER;
+
+        return kStatus_Fail;
+    }
+}
+
+/*!
+ * brief Gets the CAN FD payload length in bytes of a DLC.
+ *
+ * param dlc The CAN FD Data Length Code, 0 ~ 15.
+ * return The payload length in bytes, 0 ~ 8, 12, 16, 20, 24, 32, 48 or 64.
+ */
+uint8_t FLEXCAN_FDDlcToLength(uint8_t dlc)
+{
+    assert(dlc < ARRAY_SIZE(s_flexcanFDDlcToLength));
+
+    return s_flexcanFDDlcToLength[dlc];
+}
+
+/*!
+ * brief Gets the CAN FD DLC of a payload length in bytes.
+ *
+ * The length which is not a valid CAN FD payload length is rounded up to the next one.
+ *
+ * param length The payload length in bytes, 0 ~ 64.
+ * return The CAN FD Data Length Code.
+ */
+uint8_t FLEXCAN_FDLengthToDlc(uint8_t length)
+{
+    assert(length <= 64U);
+
+    uint8_t dlc;
+
+    if (length <= 8U)
+    {
+        dlc = length;
+    }
+    else
+    {
+        dlc = s_flexcanFDLengthToDlc[((uint32_t)length - 1U) / 4U];
+    }
+
+    return dlc;
+}
 
-        /* Calculate the DWORD number, dataSize 0/1/2/3 corresponds to 8/16/32/64
-           Bytes payload. */
-        for (cnt = 0; cnt < (dataSize + 1U); cnt++)
-        {
-            payload_dword *= 2U;
-        }
+/*!
+ * brief Sets the payload of a CAN FD frame from a byte buffer.
+ *
+ * This function packs the bytes into the frame dataWord in the Message Buffer byte order, data[0] is the
+ * MSByte of dataWord[0], a word at a time. The frame length is set to the DLC of the payload length, and
+ * the padding bytes up to the DLC length are zero.
+ *
+ * param frame Pointer to CAN FD message frame.
+ * param data The payload bytes.
+ * param length The payload length in bytes, 0 ~ 64.
+ */
+void FLEXCAN_FDSetFramePayload(flexcan_fd_frame_t *frame, const uint8_t *data, uint8_t length)
+{
+    assert(NULL != frame);
+    assert((NULL != data) || (0U == length));
+    assert(length <= 64U);
 
-        /* Store Message Payload. */
-        for (cnt = 0; cnt < payload_dword; cnt++)
-        {
-            rxFrame->dataWord[cnt] = mbAddr[offset + 2U + cnt];
-        }
+    uint8_t dlc   = FLEXCAN_FDLengthToDlc(length);
+    uint32_t cnt  = 0U;
+    uint32_t word = 0U;
+    uint32_t i;
 
-        /* Read free-running timer to unlock Rx Message Buffer. */
-        (void)base->TIMER;
+    /* Full words, the Message Buffer payload is big endian in each word. */
+    for (; cnt < ((uint32_t)length / 4U); cnt++)
+    {
+        (void)memcpy(&word, &data[cnt * 4U], sizeof(word));
+        frame->dataWord[cnt] = __REV(word);
+    }
 
-        if ((uint32_t)kFLEXCAN_RxMbFull == rx_code)
-        {
-            return kStatus_Success;
-        }
-        else
+    /* Tail bytes of the payload shorter than a word. */
+    if (0U != ((uint32_t)length & 3U))
+    {
+        word = 0U;
+        for (i = cnt * 4U; i < length; i++)
         {
-            return kStatus_FLEXCAN_RxOverflow;
+            word |= (uint32_t)data[i] << (24U - (8U * (i & 3U)));
         }
+        frame->dataWord[cnt] = word;
+        cnt++;
     }
-    else
+
+    /* Padding up to the DLC length. */
+    for (; cnt < s_flexcanFDDlcToWords[dlc]; cnt++)
     {
-        /* Read free-running timer to unlock Rx Message Buffer. */
-        (void)base->TIMER;
+        frame->dataWord[cnt] = 0U;
+    }
 
-        return kStatus_Fail;
+    frame->length = dlc;
+}
+
+/*!
+ * brief Gets the payload of a CAN FD frame to a byte buffer.
+ *
+ * This function unpacks the frame dataWord in the Message Buffer byte order, dataWord[0] MSByte to data[0],
+ * a word at a time.
+ *
+ * param frame Pointer to CAN FD message frame.
+ * param data The buffer for the payload, which should hold the payload length of the frame DLC.
+ * return The payload length in bytes.
+ */
+uint8_t FLEXCAN_FDGetFramePayload(const flexcan_fd_frame_t *frame, uint8_t *data)
+{
+    assert(NULL != frame);
+
+    uint8_t length = s_flexcanFDDlcToLength[frame->length];
+    uint32_t cnt;
+    uint32_t word;
+    uint32_t i;
+
+    assert((NULL != data) || (0U == length));
+
+    /* Full words, the Message Buffer payload is big endian in each word. */
+    for (cnt = 0U; cnt < ((uint32_t)length / 4U); cnt++)
+    {
+        word = __REV(frame->dataWord[cnt]);
+        (void)memcpy(&data[cnt * 4U], &word, sizeof(word));
+    }
+
+    /* Tail bytes of the payload shorter than a word. */
+    for (i = cnt * 4U; i < length; i++)
+    {
+        data[i] = (uint8_t)(frame->dataWord[cnt] >> (24U - (8U * (i & 3U))));
     }
+
+    return length;
 }
 #endif
 
@@ -2673,63 +3526,453 @@ status_t FLEXCAN_TransferFDReceiveNonBlocking(CAN_Type *base, flexcan_handle_t *
     {
         handle->mbState[xfer->mbIdx] = (uint8_t)kFLEXCAN_StateRxData;
 
-        /* Register Message Buffer. */
-        handle->mbFDFrameBuf[xfer->mbIdx] = xfer->framefd;
+        /* Register Message Buffer. */
+        handle->mbFDFrameBuf[xfer->mbIdx] = xfer->framefd;
+
+/* Enable Message Buffer Interrupt. */
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+        uint64_t u64mask = 1;
+        FLEXCAN_EnableMbInterrupts(base, u64mask << xfer->mbIdx);
+#else
+        uint32_t u32mask = 1;
+        FLEXCAN_EnableMbInterrupts(base, u32mask << xfer->mbIdx);
+#endif
+
+        return kStatus_Success;
+    }
+    else
+    {
+        return kStatus_FLEXCAN_RxBusy;
+    }
+}
+#endif
+
+/*!
+ * brief Receives a message from Rx FIFO using IRQ.
+ *
+ * This function receives a message using IRQ. This is a non-blocking function, which returns
+ * right away. When all messages have been received, the receive callback function is called.
+ *
+ * param base FlexCAN peripheral base address.
+ * param handle FlexCAN handle pointer.
+ * param xfer FlexCAN Rx FIFO transfer structure. See the ref flexcan_fifo_transfer_t.
+ * retval kStatus_Success            - Start Rx FIFO receiving process successfully.
+ * retval kStatus_FLEXCAN_RxFifoBusy - Rx FIFO is currently in use.
+ */
+status_t FLEXCAN_TransferReceiveFifoNonBlocking(CAN_Type *base, flexcan_handle_t *handle, flexcan_fifo_transfer_t *xfer)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != xfer);
+
+    /* Check if Message Buffer is idle. */
+    if ((uint8_t)kFLEXCAN_StateIdle == handle->rxFifoState)
+    {
+        handle->rxFifoState = (uint8_t)kFLEXCAN_StateRxFifo;
+
+        /* Register Message Buffer. */
+        handle->rxFifoFrameBuf = xfer->frame;
+
+        /* Enable Message Buffer Interrupt. */
+        FLEXCAN_EnableMbInterrupts(base, (uint32_t)kFLEXCAN_RxFifoOverflowFlag | (uint32_t)kFLEXCAN_RxFifoWarningFlag |
+                                             (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag);
+
+        return kStatus_Success;
+    }
+    else
+    {
+        return kStatus_FLEXCAN_RxFifoBusy;
+    }
+}
+
+/*!
+ * brief Starts streaming the Rx FIFO into a frame ring using IRQ.
+ *
+ * This function keeps the Rx FIFO receiving until FLEXCAN_TransferAbortReceiveFifo() is called. Each
+ * Rx FIFO interrupt drains all the available frames into the frame ring, and the callback is called
+ * with kStatus_FLEXCAN_RxFifoIdle after that. The frames are got with
+ * FLEXCAN_TransferGetReceiveFifoRingData() and released with FLEXCAN_TransferReleaseReceiveFifoRing().
+ * The frame ring is a single-producer single-consumer ring, the IRQ handler is the only writer and the
+ * user is the only reader, so no lock is needed. One frame of the ring is kept empty to tell full
+ * from empty. When the ring is full, the new frame is dropped and counted, and the Rx FIFO overflow
+ * is counted too, see FLEXCAN_TransferGetReceiveFifoRingOverrun().
+ *
+ * param base FlexCAN peripheral base address.
+ * param handle FlexCAN handle pointer.
+ * param ring The frame ring.
+ * param ringSize Number of frames in the frame ring, at least 2.
+ * retval kStatus_Success            - Start Rx FIFO streaming successfully.
+ * retval kStatus_FLEXCAN_RxFifoBusy - Rx FIFO is currently in use.
+ */
+status_t FLEXCAN_TransferStartReceiveFifoRing(CAN_Type *base,
+                                              flexcan_handle_t *handle,
+                                              flexcan_frame_t *ring,
+                                              size_t ringSize)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != ring);
+    assert(ringSize >= 2U);
+
+    /* Check if Rx FIFO is idle. */
+    if ((uint8_t)kFLEXCAN_StateIdle == handle->rxFifoState)
+    {
+        handle->rxFifoState = (uint8_t)kFLEXCAN_StateRxFifoRing;
+
+        /* Register the frame ring. */
+        handle->rxFifoRing        = ring;
+        handle->rxFifoRingSize    = ringSize;
+        handle->rxFifoRingHead    = 0U;
+        handle->rxFifoRingTail    = 0U;
+        handle->rxFifoRingOverrun = 0U;
+        handle->rxFifoOverflowNum = 0U;
+
+        /* Enable Rx FIFO Interrupt. */
+        FLEXCAN_EnableMbInterrupts(base, (uint32_t)kFLEXCAN_RxFifoOverflowFlag | (uint32_t)kFLEXCAN_RxFifoWarningFlag |
+                                             (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag);
+
+        return kStatus_Success;
+    }
+    else
+    {
+        return kStatus_FLEXCAN_RxFifoBusy;
+    }
+}
+
+/*!
+ * brief Gets the received frames in the frame ring.
+ *
+ * This function returns the oldest frames not released yet. When the frames wrap around the end of
+ * the ring, only the part till the end of the ring is returned, the rest is returned after this part
+ * is released.
+ *
+ * param handle FlexCAN handle pointer.
+ * param frames Pointer to get the address of the frames in the ring.
+ * param count Pointer to get the number of frames at p frames.
+ * retval kStatus_Success Get successfully through the parameters.
+ * retval kStatus_NoTransferInProgress Rx FIFO streaming is not started.
+ */
+status_t FLEXCAN_TransferGetReceiveFifoRingData(flexcan_handle_t *handle, flexcan_frame_t **frames, size_t *count)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != frames);
+    assert(NULL != count);
+
+    size_t head;
+    size_t tail;
+
+    if (NULL == handle->rxFifoRing)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    head = handle->rxFifoRingHead;
+    tail = handle->rxFifoRingTail;
+    /* The frames before the head must be read after the head. */
+    __DMB();
+
+    *frames = &handle->rxFifoRing[tail];
+    *count  = (head >= tail) ? (head - tail) : (handle->rxFifoRingSize - tail);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Releases the frames in the frame ring.
+ *
+ * param handle FlexCAN handle pointer.
+ * param count Number of frames to release, must not exceed the number got by
+ *              FLEXCAN_TransferGetReceiveFifoRingData().
+ */
+void FLEXCAN_TransferReleaseReceiveFifoRing(flexcan_handle_t *handle, size_t count)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != handle->rxFifoRing);
+    assert(count < handle->rxFifoRingSize);
+
+    size_t tail = handle->rxFifoRingTail + count;
+
+    if (tail >= handle->rxFifoRingSize)
+    {
+        tail -= handle->rxFifoRingSize;
+    }
+
+    /* The frames must be read before they are given back to the IRQ handler. */
+    __DMB();
+    handle->rxFifoRingTail = tail;
+}
+
+/*!
+ * brief Gets the overrun counters of the Rx FIFO streaming.
+ *
+ * param handle FlexCAN handle pointer.
+ * param ringOverrun Pointer to get the number of frames dropped as the frame ring is full.
+ * param fifoOverflow Pointer to get the number of Rx FIFO overflow events, the frames lost in the
+ *                     Rx FIFO are not counted by hardware.
+ */
+void FLEXCAN_TransferGetReceiveFifoRingOverrun(flexcan_handle_t *handle,
+                                               uint32_t *ringOverrun,
+                                               uint32_t *fifoOverflow)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != ringOverrun);
+    assert(NULL != fifoOverflow);
+
+    *ringOverrun  = handle->rxFifoRingOverrun;
+    *fifoOverflow = handle->rxFifoOverflowNum;
+}
+
+/*!
+ * brief Creates the Tx queue on the FlexCAN handle.
+ *
+ * The Tx queue keeps the frames in the order of the CAN ID, or of the local priority then the CAN ID,
+ * and keeps the Tx Message Buffers of the queue filled. When a frame is sent, the Message Buffer is
+ * filled again from the queue head in the IRQ handler, so the bus keeps busy without the application.
+ * The arbitration among the Message Buffers is configured to the lowest CAN ID first, or to the local
+ * priority first when kFLEXCAN_TxQueueLocalPriority is used. As the frames already in the Message
+ * Buffers are not taken back, a new frame may wait for at most mbNum frames of lower priority. The
+ * Message Buffers of the same arbitration value are sent in the lowest index first order, so a frame
+ * waits in the queue while a frame of the same key is in a Message Buffer, to keep the queue order.
+ *
+ * note The FlexCAN module is put in the Freeze Mode to configure the arbitration. The Tx queue
+ *       supports the classic CAN frames only, the CAN FD must not be enabled.
+ *
+ * param base FlexCAN peripheral base address.
+ * param handle FlexCAN handle pointer.
+ * param queue The Tx queue, which must be kept until the Tx queue is aborted.
+ * param config Pointer to the Tx queue configuration structure.
+ */
+void FLEXCAN_TransferTxQueueCreate(CAN_Type *base,
+                                   flexcan_handle_t *handle,
+                                   flexcan_tx_queue_t *queue,
+                                   const flexcan_tx_queue_config_t *config)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != queue);
+    assert(NULL != config);
+    assert(NULL != config->entries);
+    assert(0U != config->entryNum);
+    assert(0U != config->mbNum);
+    assert(((uint32_t)config->firstMbIdx + config->mbNum - 1U) <= (base->MCR & CAN_MCR_MAXMB_MASK));
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
+    assert(0U == (base->MCR & CAN_MCR_FDEN_MASK));
+#endif
+
+    uint8_t mbIdx;
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+    uint64_t u64mask = 0;
+#else
+    uint32_t u32mask = 0;
+#endif
+
+    (void)memset(queue, 0, sizeof(*queue));
+
+    queue->entries     = config->entries;
+    queue->entryNum    = config->entryNum;
+    queue->firstMbIdx  = config->firstMbIdx;
+    queue->mbNum       = config->mbNum;
+    queue->arbitration = (uint8_t)config->arbitration;
+
+    /* Enter Freeze Mode. */
+    FLEXCAN_EnterFreezeMode(base);
+
+    /* The lowest ID, or the local priority then the lowest ID, is sent first among the Tx Message Buffers. */
+    if (kFLEXCAN_TxQueueLocalPriority == config->arbitration)
+    {
+        base->MCR |= CAN_MCR_LPRIOEN_MASK;
+    }
+    else
+    {
+        base->MCR &= ~CAN_MCR_LPRIOEN_MASK;
+    }
+    base->CTRL1 &= ~CAN_CTRL1_LBUF_MASK;
+
+    /* Exit Freeze Mode. */
+    FLEXCAN_ExitFreezeMode(base);
+
+    for (mbIdx = config->firstMbIdx; mbIdx < (config->firstMbIdx + config->mbNum); mbIdx++)
+    {
+        assert(false == FLEXCAN_IsMbOccupied(base, mbIdx));
+
+        FLEXCAN_SetTxMbConfig(base, mbIdx, true);
+        handle->mbState[mbIdx] = (uint8_t)kFLEXCAN_StateIdle;
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+        u64mask |= (uint64_t)1U << mbIdx;
+#else
+        u32mask |= (uint32_t)1U << mbIdx;
+#endif
+    }
+
+    handle->txQueue = queue;
+
+/* Enable Message Buffer Interrupt. */
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+    FLEXCAN_EnableMbInterrupts(base, u64mask);
+#else
+    FLEXCAN_EnableMbInterrupts(base, u32mask);
+#endif
+}
+
+/*!
+ * brief Sends a frame through the Tx queue.
+ *
+ * The frame is written to a free Message Buffer of the queue at once, or copied to the queue. The
+ * callback is called with kStatus_FLEXCAN_TxIdle and the Message Buffer index when each frame is sent.
+ *
+ * note The FlexCAN timer is read for the latency statistics, which unlocks the Rx Message Buffer
+ *       locked by the application.
+ *
+ * param base FlexCAN peripheral base address.
+ * param handle FlexCAN handle pointer.
+ * param frame Pointer to CAN message frame to be sent.
+ * param priority The local priority, 0 ~ 7, lower value is sent first. Only used with
+ *                 kFLEXCAN_TxQueueLocalPriority.
+ * retval kStatus_Success        - The frame is queued.
+ * retval kStatus_FLEXCAN_TxBusy - The queue is full.
+ */
+status_t FLEXCAN_TransferTxQueueSend(CAN_Type *base,
+                                     flexcan_handle_t *handle,
+                                     const flexcan_frame_t *frame,
+                                     uint8_t priority)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != handle->txQueue);
+    assert(NULL != frame);
+    assert(frame->length <= 8U);
+    assert(priority <= (CAN_ID_PRIO_MASK >> CAN_ID_PRIO_SHIFT));
+
+    flexcan_tx_queue_t *queue = handle->txQueue;
+    flexcan_tx_queue_entry_t entry;
+    status_t status = kStatus_Success;
+    uint32_t primask;
+
+    entry.frame = *frame;
+    entry.key   = FLEXCAN_TxQueueGetKey(
+        frame, ((uint8_t)kFLEXCAN_TxQueueLocalPriority == queue->arbitration) ? (uint32_t)priority : 0U);
+
+    /* The queue and the Message Buffer states are shared with the IRQ handler. */
+    primask = DisableGlobalIRQ();
+
+    entry.queueTime = (uint16_t)(base->TIMER & CAN_TIMER_TIMER_MASK);
+    entry.sequence  = queue->sequence;
+    queue->sequence++;
+
+    /* The frame goes through the heap, it is sent at once when a Message Buffer is idle and it is the head. */
+    if (queue->count < queue->entryNum)
+    {
+        FLEXCAN_TxQueuePush(queue, &entry);
+        FLEXCAN_TxQueueFillMbs(base, handle);
+        if (queue->count > queue->statistics.maxDepth)
+        {
+            queue->statistics.maxDepth = queue->count;
+        }
+    }
+    else
+    {
+        queue->statistics.rejectedFrames++;
+        status = kStatus_FLEXCAN_TxBusy;
+    }
+
+    EnableGlobalIRQ(primask);
+
+    return status;
+}
+
+/*!
+ * brief Gets the Tx queue statistics.
+ *
+ * param handle FlexCAN handle pointer.
+ * param statistics Pointer to get the Tx queue statistics.
+ */
+void FLEXCAN_TransferTxQueueGetStatistics(flexcan_handle_t *handle, flexcan_tx_queue_statistics_t *statistics)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != handle->txQueue);
+    assert(NULL != statistics);
+
+    uint32_t primask;
+
+    primask           = DisableGlobalIRQ();
+    *statistics       = handle->txQueue->statistics;
+    statistics->depth = handle->txQueue->count;
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief Clears the Tx queue statistics.
+ *
+ * param handle FlexCAN handle pointer.
+ */
+void FLEXCAN_TransferTxQueueClearStatistics(flexcan_handle_t *handle)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != handle->txQueue);
 
-/* Enable Message Buffer Interrupt. */
-#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
-        uint64_t u64mask = 1;
-        FLEXCAN_EnableMbInterrupts(base, u64mask << xfer->mbIdx);
-#else
-        uint32_t u32mask = 1;
-        FLEXCAN_EnableMbInterrupts(base, u32mask << xfer->mbIdx);
-#endif
+    uint32_t primask;
 
-        return kStatus_Success;
-    }
-    else
-    {
-        return kStatus_FLEXCAN_RxBusy;
-    }
+    primask = DisableGlobalIRQ();
+    (void)memset(&handle->txQueue->statistics, 0, sizeof(flexcan_tx_queue_statistics_t));
+    EnableGlobalIRQ(primask);
 }
-#endif
 
 /*!
- * brief Receives a message from Rx FIFO using IRQ.
+ * brief Aborts the Tx queue.
  *
- * This function receives a message using IRQ. This is a non-blocking function, which returns
- * right away. When all messages have been received, the receive callback function is called.
+ * This function aborts the frames in the Message Buffers of the queue, drops the queued frames, and
+ * removes the Tx queue from the handle.
  *
  * param base FlexCAN peripheral base address.
  * param handle FlexCAN handle pointer.
- * param xfer FlexCAN Rx FIFO transfer structure. See the ref flexcan_fifo_transfer_t.
- * retval kStatus_Success            - Start Rx FIFO receiving process successfully.
- * retval kStatus_FLEXCAN_RxFifoBusy - Rx FIFO is currently in use.
  */
-status_t FLEXCAN_TransferReceiveFifoNonBlocking(CAN_Type *base, flexcan_handle_t *handle, flexcan_fifo_transfer_t *xfer)
+void FLEXCAN_TransferTxQueueAbort(CAN_Type *base, flexcan_handle_t *handle)
 {
     /* Assertion. */
     assert(NULL != handle);
-    assert(NULL != xfer);
+    assert(NULL != handle->txQueue);
 
-    /* Check if Message Buffer is idle. */
-    if ((uint8_t)kFLEXCAN_StateIdle == handle->rxFifoState)
-    {
-        handle->rxFifoState = (uint8_t)kFLEXCAN_StateRxFifo;
-
-        /* Register Message Buffer. */
-        handle->rxFifoFrameBuf = xfer->frame;
+    flexcan_tx_queue_t *queue = handle->txQueue;
+    uint32_t primask;
+    uint8_t mbIdx;
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+    uint64_t u64mask = 0;
+#else
+    uint32_t u32mask = 0;
+#endif
 
-        /* Enable Message Buffer Interrupt. */
-        FLEXCAN_EnableMbInterrupts(base, (uint32_t)kFLEXCAN_RxFifoOverflowFlag | (uint32_t)kFLEXCAN_RxFifoWarningFlag |
-                                             (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag);
+    primask = DisableGlobalIRQ();
 
-        return kStatus_Success;
-    }
-    else
+    for (mbIdx = queue->firstMbIdx; mbIdx < (queue->firstMbIdx + queue->mbNum); mbIdx++)
     {
-        return kStatus_FLEXCAN_RxFifoBusy;
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+        u64mask |= (uint64_t)1U << mbIdx;
+#else
+        u32mask |= (uint32_t)1U << mbIdx;
+#endif
+        /* Clean Message Buffer. */
+        FLEXCAN_SetTxMbConfig(base, mbIdx, true);
+        handle->mbState[mbIdx] = (uint8_t)kFLEXCAN_StateIdle;
     }
+
+/* Disable Message Buffer Interrupt and clear the flags of the aborted frames. */
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+    FLEXCAN_DisableMbInterrupts(base, u64mask);
+    FLEXCAN_ClearMbStatusFlags(base, u64mask);
+#else
+    FLEXCAN_DisableMbInterrupts(base, u32mask);
+    FLEXCAN_ClearMbStatusFlags(base, u32mask);
+#endif
+
+    queue->count    = 0U;
+    handle->txQueue = NULL;
+
+    EnableGlobalIRQ(primask);
 }
 
 /*!
@@ -2877,7 +4120,8 @@ void FLEXCAN_TransferAbortReceive(CAN_Type *base, flexcan_handle_t *handle, uint
 /*!
  * brief Aborts the interrupt driven message receive from Rx FIFO process.
  *
- * This function aborts the interrupt driven message receive from Rx FIFO process.
+ * This function aborts the interrupt driven message receive from Rx FIFO process, and stops the Rx FIFO
+ * streaming started by FLEXCAN_TransferStartReceiveFifoRing().
  *
  * param base FlexCAN peripheral base address.
  * param handle FlexCAN handle pointer.
@@ -2896,11 +4140,352 @@ void FLEXCAN_TransferAbortReceiveFifo(CAN_Type *base, flexcan_handle_t *handle)
 
         /* Un-register handle. */
         handle->rxFifoFrameBuf = NULL;
+        handle->rxFifoRing     = NULL;
     }
 
     handle->rxFifoState = (uint8_t)kFLEXCAN_StateIdle;
 }
 
+static status_t FLEXCAN_SubHandlerForRxFifoRing(CAN_Type *base, flexcan_handle_t *handle, uint32_t result)
+{
+    flexcan_frame_t dropFrame;
+    status_t status;
+    size_t head = handle->rxFifoRingHead;
+    size_t next;
+    uint32_t u32mask = 1;
+
+    switch (u32mask << result)
+    {
+        case (int32_t)kFLEXCAN_RxFifoOverflowFlag:
+            handle->rxFifoOverflowNum++;
+            FLEXCAN_ClearMbStatusFlags(base, (uint32_t)kFLEXCAN_RxFifoOverflowFlag);
+            status = kStatus_FLEXCAN_RxFifoOverflow;
+            break;
+
+        case (int32_t)kFLEXCAN_RxFifoWarningFlag:
+            FLEXCAN_ClearMbStatusFlags(base, (uint32_t)kFLEXCAN_RxFifoWarningFlag);
+            status = kStatus_FLEXCAN_RxFifoWarning;
+            break;
+
+        case (int32_t)kFLEXCAN_RxFifoFrameAvlFlag:
+            /* The flag is set again after clear while the Rx FIFO is not empty, drain all of the frames. */
+            while (0U != (base->IFLAG1 & (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag))
+            {
+                next = head + 1U;
+                if (next == handle->rxFifoRingSize)
+                {
+                    next = 0U;
+                }
+
+                if (next == handle->rxFifoRingTail)
+                {
+                    /* The frame ring is full, the frame must still be read out to free the Rx FIFO. */
+                    (void)FLEXCAN_ReadRxFifo(base, &dropFrame);
+                    handle->rxFifoRingOverrun++;
+                }
+                else
+                {
+                    (void)FLEXCAN_ReadRxFifo(base, &handle->rxFifoRing[head]);
+                    /* The frame must be written before it is published to the reader. */
+                    __DMB();
+                    head                   = next;
+                    handle->rxFifoRingHead = head;
+                }
+
+                /* Clear the flag to move to the next frame of the Rx FIFO. */
+                FLEXCAN_ClearMbStatusFlags(base, (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag);
+            }
+            status = kStatus_FLEXCAN_RxFifoIdle;
+            break;
+
+        default:
+            FLEXCAN_ClearMbStatusFlags(base, u32mask << result);
+            status = kStatus_FLEXCAN_UnHandled;
+            break;
+    }
+
+    return status;
+}
+
+static uint64_t FLEXCAN_TxQueueGetKey(const flexcan_frame_t *frame, uint32_t priority)
+{
+    /*
+        The base ID, IDE, the extended ID bits, then RTR, the same order as the bus arbitration. The standard
+        frame wins the extended frame of the same base ID.
+    */
+    return ((uint64_t)priority << 32U) | ((uint64_t)(frame->id & CAN_ID_STD_MASK) << 3U) |
+           ((uint64_t)frame->format << 20U) | ((uint64_t)(frame->id & CAN_ID_EXT_MASK) << 2U) |
+           ((uint64_t)frame->type << 1U);
+}
+
+static bool FLEXCAN_TxQueueIsBefore(const flexcan_tx_queue_entry_t *entry, const flexcan_tx_queue_entry_t *other)
+{
+    /* The sequence number may wrap around. */
+    return (entry->key < other->key) ||
+           ((entry->key == other->key) && ((int32_t)(entry->sequence - other->sequence) < 0));
+}
+
+static void FLEXCAN_TxQueuePush(flexcan_tx_queue_t *queue, const flexcan_tx_queue_entry_t *entry)
+{
+    uint32_t index = queue->count;
+    uint32_t parent;
+
+    /* Move the parents down till the place of the new entry is found. */
+    while (index > 0U)
+    {
+        parent = (index - 1U) / 2U;
+        if (!FLEXCAN_TxQueueIsBefore(entry, &queue->entries[parent]))
+        {
+            break;
+        }
+        queue->entries[index] = queue->entries[parent];
+        index                 = parent;
+    }
+
+    queue->entries[index] = *entry;
+    queue->count++;
+}
+
+static void FLEXCAN_TxQueuePop(flexcan_tx_queue_t *queue, flexcan_tx_queue_entry_t *entry)
+{
+    flexcan_tx_queue_entry_t *last;
+    uint32_t count;
+    uint32_t index = 0U;
+    uint32_t child;
+
+    *entry = queue->entries[0];
+    count  = (uint32_t)queue->count - 1U;
+    last   = &queue->entries[count];
+
+    /* Move the children up till the place of the last entry is found. */
+    while (true)
+    {
+        child = (2U * index) + 1U;
+        if (child >= count)
+        {
+            break;
+        }
+        if (((child + 1U) < count) && FLEXCAN_TxQueueIsBefore(&queue->entries[child + 1U], &queue->entries[child]))
+        {
+            child++;
+        }
+        if (!FLEXCAN_TxQueueIsBefore(&queue->entries[child], last))
+        {
+            break;
+        }
+        queue->entries[index] = queue->entries[child];
+        index                 = child;
+    }
+
+    queue->entries[index] = *last;
+    queue->count          = (uint16_t)count;
+}
+
+static void FLEXCAN_TxQueueStartMb(CAN_Type *base,
+                                   flexcan_handle_t *handle,
+                                   uint8_t mbIdx,
+                                   const flexcan_tx_queue_entry_t *entry)
+{
+    handle->mbState[mbIdx]              = (uint8_t)kFLEXCAN_StateTxQueue;
+    handle->txQueue->mbQueueTime[mbIdx] = entry->queueTime;
+    handle->txQueue->mbKey[mbIdx]       = entry->key;
+
+    (void)FLEXCAN_WriteTxMbWithPriority(base, mbIdx, &entry->frame, (uint32_t)(entry->key >> 32U));
+}
+
+static void FLEXCAN_TxQueueFillMbs(CAN_Type *base, flexcan_handle_t *handle)
+{
+    flexcan_tx_queue_t *queue = handle->txQueue;
+    flexcan_tx_queue_entry_t entry;
+    uint8_t idleMbIdx;
+    uint8_t mbIdx;
+
+    while (0U != queue->count)
+    {
+        idleMbIdx = queue->firstMbIdx + queue->mbNum;
+        for (mbIdx = queue->firstMbIdx; mbIdx < (queue->firstMbIdx + queue->mbNum); mbIdx++)
+        {
+            if ((uint8_t)kFLEXCAN_StateIdle == handle->mbState[mbIdx])
+            {
+                idleMbIdx = MIN(idleMbIdx, mbIdx);
+            }
+            else if (queue->mbKey[mbIdx] == queue->entries[0].key)
+            {
+                /* The queue head waits for the frame of the same key. */
+                return;
+            }
+            else
+            {
+                /* The Message Buffer is sending a frame of another key. */
+            }
+        }
+
+        if (idleMbIdx == (queue->firstMbIdx + queue->mbNum))
+        {
+            break;
+        }
+
+        FLEXCAN_TxQueuePop(queue, &entry);
+        FLEXCAN_TxQueueStartMb(base, handle, idleMbIdx, &entry);
+    }
+}
+
+static status_t FLEXCAN_SubHandlerForTxQueue(CAN_Type *base, flexcan_handle_t *handle, uint32_t result)
+{
+    flexcan_tx_queue_t *queue                 = handle->txQueue;
+    flexcan_tx_queue_statistics_t *statistics = &queue->statistics;
+    uint16_t latency;
+
+/* Clear resolved Message Buffer IRQ before the next frame may be sent in it. */
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+    uint64_t u64flag = 1;
+    FLEXCAN_ClearMbStatusFlags(base, u64flag << result);
+#else
+    uint32_t u32flag = 1;
+    FLEXCAN_ClearMbStatusFlags(base, u32flag << result);
+#endif
+
+    /* The time stamp is captured when the frame starts on the bus, the timer wraps around at 16 bits. */
+    latency = (uint16_t)(((base->MB[result].CS & CAN_CS_TIME_STAMP_MASK) >> CAN_CS_TIME_STAMP_SHIFT) -
+                         queue->mbQueueTime[result]);
+    statistics->sentFrames++;
+    statistics->totalLatency += latency;
+    statistics->lastLatency = latency;
+    if (latency > statistics->maxLatency)
+    {
+        statistics->maxLatency = latency;
+    }
+
+    /* Fill the Message Buffers again from the queue head, which may wait for the frame just sent. */
+    handle->mbState[result] = (uint8_t)kFLEXCAN_StateIdle;
+    FLEXCAN_TxQueueFillMbs(base, handle);
+
+    return kStatus_FLEXCAN_TxIdle;
+}
+
+static status_t FLEXCAN_SubHandlerForMB(CAN_Type *base, flexcan_handle_t *handle, uint32_t result)
+{
+    status_t status = kStatus_FLEXCAN_UnHandled;
+
+    /* Solve Rx FIFO streaming interrupt, the flags are cleared while the frames are drained. */
+    if (((uint8_t)kFLEXCAN_StateRxFifoRing == handle->rxFifoState) && (result <= (uint32_t)CAN_IFLAG1_BUF7I_SHIFT))
+    {
+        return FLEXCAN_SubHandlerForRxFifoRing(base, handle, result);
+    }
+
+    /* Solve Tx queue interrupt, the flag is cleared before the Message Buffer is filled again. */
+    if ((uint8_t)kFLEXCAN_StateTxQueue == handle->mbState[result])
+    {
+        return FLEXCAN_SubHandlerForTxQueue(base, handle, result);
+    }
+
+    /* Solve Rx FIFO interrupt. */
+    if (((uint8_t)kFLEXCAN_StateIdle != handle->rxFifoState) && (result <= (uint32_t)CAN_IFLAG1_BUF7I_SHIFT))
+    {
+        uint32_t u32mask = 1;
+        switch (u32mask << result)
+        {
+            case (int32_t)kFLEXCAN_RxFifoOverflowFlag:
+                status = kStatus_FLEXCAN_RxFifoOverflow;
+                break;
+
+            case (int32_t)kFLEXCAN_RxFifoWarningFlag:
+                status = kStatus_FLEXCAN_RxFifoWarning;
+                break;
+
+            case (int32_t)kFLEXCAN_RxFifoFrameAvlFlag:
+                status = FLEXCAN_ReadRxFifo(base, handle->rxFifoFrameBuf);
+                if (kStatus_Success == status)
+                {
+                    status = kStatus_FLEXCAN_RxFifoIdle;
+                }
+                FLEXCAN_TransferAbortReceiveFifo(base, handle);
+                break;
+
+            default:
+                status = kStatus_FLEXCAN_UnHandled;
+                break;
+        }
+    }
+    else
+    {
+        /* Get current State of Message Buffer. */
+        switch (handle->mbState[result])
+        {
+            /* Solve Rx Data Frame or Rx Remote Frame. */
+            case (uint8_t)kFLEXCAN_StateRxData:
+            case (uint8_t)kFLEXCAN_StateRxRemote:
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
+                if (0U != (base->MCR & CAN_MCR_FDEN_MASK))
+                {
+                    status = FLEXCAN_ReadFDRxMb(base, (uint8_t)result, handle->mbFDFrameBuf[result]);
+                }
+                else
+                {
+                    status = FLEXCAN_ReadRxMb(base, (uint8_t)result, handle->mbFrameBuf[result]);
+                }
+#else
+                status = FLEXCAN_ReadRxMb(base, result, handle->mbFrameBuf[result]);
+#endif
+                if (kStatus_Success == status)
+                {
+                    status = kStatus_FLEXCAN_RxIdle;
+                }
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
+                if (0U != (base->MCR & CAN_MCR_FDEN_MASK))
+                {
+                    FLEXCAN_TransferFDAbortReceive(base, handle, (uint8_t)result);
+                }
+                else
+                {
+                    FLEXCAN_TransferAbortReceive(base, handle, (uint8_t)result);
+                }
+#else
+                FLEXCAN_TransferAbortReceive(base, handle, result);
+#endif
+                break;
+
+            /* Solve Tx Data Frame. */
+            case (uint8_t)kFLEXCAN_StateTxData:
+                status = kStatus_FLEXCAN_TxIdle;
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
+                if (0U != (base->MCR & CAN_MCR_FDEN_MASK))
+                {
+                    FLEXCAN_TransferFDAbortSend(base, handle, (uint8_t)result);
+                }
+                else
+                {
+                    FLEXCAN_TransferAbortSend(base, handle, (uint8_t)result);
+                }
+#else
+                FLEXCAN_TransferAbortSend(base, handle, result);
+#endif
+                break;
+
+            /* Solve Tx Remote Frame. */
+            case (uint8_t)kFLEXCAN_StateTxRemote:
+                handle->mbState[result] = (uint8_t)kFLEXCAN_StateRxRemote;
+                status                  = kStatus_FLEXCAN_TxSwitchToRx;
+                break;
+
+            default:
+                status = kStatus_FLEXCAN_UnHandled;
+                break;
+        }
+    }
+
+/* Clear resolved Message Buffer IRQ. */
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+    uint64_t u64flag = 1;
+    FLEXCAN_ClearMbStatusFlags(base, u64flag << result);
+#else
+    uint32_t u32flag = 1;
+    FLEXCAN_ClearMbStatusFlags(base, u32flag << result);
+#endif
+
+    return status;
+}
+
 /*!
  * brief FlexCAN IRQ handle function.
  *
@@ -2916,6 +4501,10 @@ void FLEXCAN_TransferHandleIRQ(CAN_Type *base, flexcan_handle_t *handle)
 
     status_t status = kStatus_FLEXCAN_UnHandled;
     uint32_t result = 0U;
+    uint32_t mbPending[FLEXCAN_MB_FLAG_WORD_NUM];
+    uint32_t word;
+    uint32_t mbFlag;
+    bool rxFifoBusy;
     /* Store Current FlexCAN Module Error and Status. */
     uint32_t EsrStatus = base->ESR1;
 
@@ -2939,140 +4528,53 @@ void FLEXCAN_TransferHandleIRQ(CAN_Type *base, flexcan_handle_t *handle)
         /* Solve FlexCAN Rx FIFO & Message Buffer Interrupt. */
         else
         {
-            /* For this implementation, we solve the Message with lowest MB index first. */
-            for (result = 0U; result < (uint32_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base); result++)
-            {
-/* Get the lowest unhandled Message Buffer */
+            /* Read the flag and mask registers once, every enabled pending Message Buffer is solved in this pass. */
+            mbPending[0] = base->IFLAG1 & base->IMASK1;
 #if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
-                uint64_t u64flag = 1;
-                if (0U != FLEXCAN_GetMbStatusFlags(base, (u64flag << result)))
-                {
-                    if (true == FLEXCAN_IsMbIntEnabled(base, result))
+            mbPending[1] = base->IFLAG2 & base->IMASK2;
+            if ((0U == mbPending[0]) && (0U == mbPending[1]))
 #else
-                uint32_t u32flag = 1;
-                if (0U != FLEXCAN_GetMbStatusFlags(base, (u32flag << result)))
-                {
-                    if (true == FLEXCAN_IsMbIntEnabled(base, (uint8_t)result))
+            if (0U == mbPending[0])
 #endif
-                    {
-                        break;
-                    }
-                }
-            }
-
-            /* Does not find Message to deal with. */
-            if (result == (uint32_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base))
             {
+                /* Does not find Message to deal with. */
                 break;
             }
 
-            /* Solve Rx FIFO interrupt. */
-            if (((uint8_t)kFLEXCAN_StateIdle != handle->rxFifoState) && (result <= (uint32_t)CAN_IFLAG1_BUF7I_SHIFT))
-            {
-                uint32_t u32mask = 1;
-                switch (u32mask << result)
-                {
-                    case (int32_t)kFLEXCAN_RxFifoOverflowFlag:
-                        status = kStatus_FLEXCAN_RxFifoOverflow;
-                        break;
-
-                    case (int32_t)kFLEXCAN_RxFifoWarningFlag:
-                        status = kStatus_FLEXCAN_RxFifoWarning;
-                        break;
-
-                    case (int32_t)kFLEXCAN_RxFifoFrameAvlFlag:
-                        status = FLEXCAN_ReadRxFifo(base, handle->rxFifoFrameBuf);
-                        if (kStatus_Success == status)
-                        {
-                            status = kStatus_FLEXCAN_RxFifoIdle;
-                        }
-                        FLEXCAN_TransferAbortReceiveFifo(base, handle);
-                        break;
-
-                    default:
-                        status = kStatus_FLEXCAN_UnHandled;
-                        break;
-                }
-            }
-            else
+            /* For this implementation, we solve the Message with lowest MB index first. */
+            for (word = 0U; word < FLEXCAN_MB_FLAG_WORD_NUM; word++)
             {
-                /* Get current State of Message Buffer. */
-                switch (handle->mbState[result])
+                while (0U != mbPending[word])
                 {
-                    /* Solve Rx Data Frame or Rx Remote Frame. */
-                    case (uint8_t)kFLEXCAN_StateRxData:
-                    case (uint8_t)kFLEXCAN_StateRxRemote:
-#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
-                        if (0U != (base->MCR & CAN_MCR_FDEN_MASK))
-                        {
-                            status = FLEXCAN_ReadFDRxMb(base, (uint8_t)result, handle->mbFDFrameBuf[result]);
-                        }
-                        else
-                        {
-                            status = FLEXCAN_ReadRxMb(base, (uint8_t)result, handle->mbFrameBuf[result]);
-                        }
-#else
-                        status = FLEXCAN_ReadRxMb(base, result, handle->mbFrameBuf[result]);
-#endif
-                        if (kStatus_Success == status)
-                        {
-                            status = kStatus_FLEXCAN_RxIdle;
-                        }
-#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
-                        if (0U != (base->MCR & CAN_MCR_FDEN_MASK))
-                        {
-                            FLEXCAN_TransferFDAbortReceive(base, handle, (uint8_t)result);
-                        }
-                        else
-                        {
-                            FLEXCAN_TransferAbortReceive(base, handle, (uint8_t)result);
-                        }
-#else
-                        FLEXCAN_TransferAbortReceive(base, handle, result);
-#endif
-                        break;
+                    /* Isolate the lowest set flag and get its index from the leading zeros. */
+                    mbFlag = mbPending[word] & (0U - mbPending[word]);
+                    mbPending[word] &= ~mbFlag;
+                    result = (word * 32U) + (31U - (uint32_t)__CLZ(mbFlag));
 
-                    /* Solve Tx Data Frame. */
-                    case (uint8_t)kFLEXCAN_StateTxData:
-                        status = kStatus_FLEXCAN_TxIdle;
-#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
-                        if (0U != (base->MCR & CAN_MCR_FDEN_MASK))
-                        {
-                            FLEXCAN_TransferFDAbortSend(base, handle, (uint8_t)result);
-                        }
-                        else
-                        {
-                            FLEXCAN_TransferAbortSend(base, handle, (uint8_t)result);
-                        }
-#else
-                        FLEXCAN_TransferAbortSend(base, handle, result);
-#endif
-                        break;
+                    rxFifoBusy = ((uint8_t)kFLEXCAN_StateIdle != handle->rxFifoState);
+                    status     = FLEXCAN_SubHandlerForMB(base, handle, result);
 
-                    /* Solve Tx Remote Frame. */
-                    case (uint8_t)kFLEXCAN_StateTxRemote:
-                        handle->mbState[result] = (uint8_t)kFLEXCAN_StateRxRemote;
-                        status                  = kStatus_FLEXCAN_TxSwitchToRx;
-                        break;
+                    /* The Rx FIFO interrupts are disabled when the FIFO transfer is done, skip the rest of them. */
+                    if (rxFifoBusy && ((uint8_t)kFLEXCAN_StateIdle == handle->rxFifoState))
+                    {
+                        mbPending[0] &= ~((uint32_t)kFLEXCAN_RxFifoOverflowFlag | (uint32_t)kFLEXCAN_RxFifoWarningFlag |
+                                          (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag);
+                    }
 
-                    default:
-                        status = kStatus_FLEXCAN_UnHandled;
-                        break;
+                    /* Calling Callback Function if has one. */
+                    if (handle->callback != NULL)
+                    {
+                        handle->callback(base, handle, status, result, handle->userData);
+                    }
                 }
             }
 
-/* Clear resolved Message Buffer IRQ. */
-#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
-            uint64_t u64flag = 1;
-            FLEXCAN_ClearMbStatusFlags(base, u64flag << result);
-#else
-            uint32_t u32flag = 1;
-            FLEXCAN_ClearMbStatusFlags(base, u32flag << result);
-#endif
+            /* The callback has been called for each Message Buffer. */
+            status = kStatus_FLEXCAN_UnHandled;
         }
 
         /* Calling Callback Function if has one. */
-        if (handle->callback != NULL)
+        if ((handle->callback != NULL) && (kStatus_FLEXCAN_UnHandled != status))
         {
             handle->callback(base, handle, status, result, handle->userData);
         }
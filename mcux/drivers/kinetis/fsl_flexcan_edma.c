@@ -54,6 +54,29 @@ static flexcan_edma_private_handle_t s_flexcanEdmaPrivateHandle[FSL_FEATURE_SOC_
  */
 static void FLEXCAN_ReceiveFifoEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
 
+/*!
+ * @brief Updates the eDMA frame ring state.
+ *
+ * This function gets the current eDMA write position in the frame ring and adds the frames received
+ * since the last update to the unreleased frames.
+ *
+ * @param handle Pointer to flexcan_edma_handle_t structure.
+ * @param overrun Pointer to get whether the unreleased frames are overwritten and dropped.
+ * @return Number of new frames, 0 if the unreleased frames are dropped.
+ */
+static size_t FLEXCAN_UpdateReceiveFifoRingEDMA(flexcan_edma_handle_t *handle, bool *overrun);
+
+/*!
+ * @brief FlexCAN EDMA frame ring callback function.
+ *
+ * This function is called on the half and major loop interrupts of the Rx FIFO eDMA channel in frame
+ * ring mode. It updates the frame ring so the new frames are counted before the eDMA wraps twice.
+ *
+ * @param handle The EDMA handle.
+ * @param param Callback function parameter.
+ */
+static void FLEXCAN_ReceiveFifoRingEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -78,6 +101,86 @@ static void FLEXCAN_ReceiveFifoEDMACallback(edma_handle_t *handle, void *param,
     }
 }
 
+static size_t FLEXCAN_UpdateReceiveFifoRingEDMA(flexcan_edma_handle_t *handle, bool *overrun)
+{
+    size_t head;
+    size_t newFrames;
+    uint32_t remaining;
+    uint32_t primask;
+
+    /* The update is called both in the eDMA interrupt and by the user. */
+    primask = DisableGlobalIRQ();
+
+    /*
+     * Read CITER directly, EDMA_GetRemainingMajorLoopCount returns 0 while DONE is set. After the wrap
+     * DONE stays set till the eDMA interrupt clears it, but CITER is already reloaded and counting.
+     */
+    remaining = ((uint32_t)handle->rxFifoEdmaHandle->base->TCD[handle->rxFifoEdmaHandle->channel].CITER_ELINKNO &
+                 DMA_CITER_ELINKNO_CITER_MASK) >>
+                DMA_CITER_ELINKNO_CITER_SHIFT;
+    head = handle->rxFifoRingSize - remaining;
+    if (head == handle->rxFifoRingSize)
+    {
+        head = 0U;
+    }
+    newFrames = (head + handle->rxFifoRingSize - handle->rxFifoRingHead) % handle->rxFifoRingSize;
+
+    handle->rxFifoRingHead = head;
+    handle->rxFifoRingUnread += newFrames;
+    *overrun = (handle->rxFifoRingUnread > handle->rxFifoRingSize);
+    if (*overrun)
+    {
+        /* The unreleased frames have been overwritten, drop all of them. */
+        handle->rxFifoRingOverrun += handle->rxFifoRingUnread;
+        handle->rxFifoRingTail   = head;
+        handle->rxFifoRingUnread = 0U;
+        newFrames                = 0U;
+    }
+
+    EnableGlobalIRQ(primask);
+
+    return newFrames;
+}
+
+static void FLEXCAN_ReceiveFifoRingEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    assert(NULL != param);
+
+    flexcan_edma_private_handle_t *flexcanPrivateHandle = (flexcan_edma_private_handle_t *)param;
+    bool overrun;
+    size_t newFrames;
+
+    /* Avoid warning for unused parameters. */
+    tcds = tcds;
+
+    if (transferDone)
+    {
+        /* The channel keeps running, clear DONE so that the remaining major loop count is valid. */
+        EDMA_ClearChannelStatusFlags(handle->base, handle->channel, (uint32_t)kEDMA_DoneFlag);
+    }
+
+    newFrames = FLEXCAN_UpdateReceiveFifoRingEDMA(flexcanPrivateHandle->handle, &overrun);
+
+    if (NULL != flexcanPrivateHandle->handle->callback)
+    {
+        if (overrun)
+        {
+            flexcanPrivateHandle->handle->callback(flexcanPrivateHandle->base, flexcanPrivateHandle->handle,
+                                                   kStatus_FLEXCAN_RxFifoOverflow,
+                                                   flexcanPrivateHandle->handle->userData);
+        }
+        else if (0U != newFrames)
+        {
+            flexcanPrivateHandle->handle->callback(flexcanPrivateHandle->base, flexcanPrivateHandle->handle,
+                                                   kStatus_FLEXCAN_RxFifoIdle, flexcanPrivateHandle->handle->userData);
+        }
+        else
+        {
+            /* No new frames. */
+        }
+    }
+}
+
 /*!
  * brief Initializes the FlexCAN handle, which is used in transactional functions.
  *
@@ -177,3 +280,166 @@ void FLEXCAN_TransferAbortReceiveFifoEDMA(CAN_Type *base, flexcan_edma_handle_t
 
     handle->rxFifoState = (uint8_t)KFLEXCAN_RxFifoIdle;
 }
+
+/*!
+ * brief Starts streaming the Rx FIFO into a frame ring using eDMA.
+ *
+ * This function configures the Rx FIFO eDMA channel to loop over the frame ring continuously, the
+ * destination address is rewound after each major loop so the channel never stops and no re-arm is
+ * needed between the frames. The half and major loop interrupts of the eDMA channel track the ring,
+ * the callback is called with ref kStatus_FLEXCAN_RxFifoIdle when new frames are counted there. The
+ * frames are got with ref FLEXCAN_TransferGetReceiveFifoRingDataEDMA and released with
+ * ref FLEXCAN_TransferReleaseReceiveFifoRingEDMA. If the unreleased frames are overwritten, the
+ * callback is called with ref kStatus_FLEXCAN_RxFifoOverflow, the unreleased frames are dropped and
+ * counted in the rxFifoRingOverrun of the handle.
+ *
+ * note The Rx FIFO eDMA handle must not use a TCD pool in this mode. The ring size must not exceed
+ *       the eDMA major loop count limit.
+ *
+ * param base FlexCAN peripheral base address.
+ * param handle Pointer to flexcan_edma_handle_t structure.
+ * param ring The frame ring.
+ * param ringSize Number of frames in the frame ring.
+ * retval kStatus_Success Rx FIFO streaming is started.
+ * retval kStatus_FLEXCAN_RxFifoBusy Previous transfer ongoing.
+ */
+status_t FLEXCAN_TransferStartReceiveFifoRingEDMA(CAN_Type *base,
+                                                  flexcan_edma_handle_t *handle,
+                                                  flexcan_frame_t *ring,
+                                                  size_t ringSize)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxFifoEdmaHandle);
+    assert(NULL == handle->rxFifoEdmaHandle->tcdPool);
+    assert(NULL != ring);
+    assert(0U != ringSize);
+    assert(ringSize <= (DMA_CITER_ELINKNO_CITER_MASK >> DMA_CITER_ELINKNO_CITER_SHIFT));
+
+    edma_transfer_config_t dmaXferConfig;
+    DMA_Type *edmaBase = handle->rxFifoEdmaHandle->base;
+    uint32_t channel   = handle->rxFifoEdmaHandle->channel;
+
+    /* If previous Rx FIFO receive not finished. */
+    if ((uint8_t)KFLEXCAN_RxFifoBusy == handle->rxFifoState)
+    {
+        return kStatus_FLEXCAN_RxFifoBusy;
+    }
+
+    handle->rxFifoState       = (uint8_t)KFLEXCAN_RxFifoBusy;
+    handle->rxFifoRing        = ring;
+    handle->rxFifoRingSize    = ringSize;
+    handle->rxFifoRingHead    = 0U;
+    handle->rxFifoRingTail    = 0U;
+    handle->rxFifoRingUnread  = 0U;
+    handle->rxFifoRingOverrun = 0U;
+
+    /* Each Rx FIFO eDMA request moves one frame. */
+    EDMA_PrepareTransfer(&dmaXferConfig, (void *)(uint32_t *)FLEXCAN_GetRxFifoHeadAddr(base), sizeof(flexcan_frame_t),
+                         (void *)ring, sizeof(uint32_t), sizeof(flexcan_frame_t), ringSize * sizeof(flexcan_frame_t),
+                         kEDMA_PeripheralToMemory);
+    EDMA_ResetChannel(edmaBase, channel);
+    EDMA_SetTransferConfig(edmaBase, channel, &dmaXferConfig, NULL);
+    /* Rewind the destination after each major loop and keep the request enabled, so the channel loops forever. */
+    edmaBase->TCD[channel].DLAST_SGA = (uint32_t)(-(int32_t)(ringSize * sizeof(flexcan_frame_t)));
+    EDMA_EnableAutoStopRequest(edmaBase, channel, false);
+    EDMA_EnableChannelInterrupts(edmaBase, channel,
+                                 (uint32_t)kEDMA_HalfInterruptEnable | (uint32_t)kEDMA_MajorInterruptEnable);
+    EDMA_SetCallback(handle->rxFifoEdmaHandle, FLEXCAN_ReceiveFifoRingEDMACallback,
+                     &s_flexcanEdmaPrivateHandle[FLEXCAN_GetInstance(base)]);
+
+    EDMA_StartTransfer(handle->rxFifoEdmaHandle);
+
+    /* Enable FlexCAN Rx FIFO EDMA. */
+    FLEXCAN_EnableRxFifoDMA(base, true);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops streaming the Rx FIFO into the frame ring using eDMA.
+ *
+ * param base FlexCAN peripheral base address.
+ * param handle Pointer to flexcan_edma_handle_t structure.
+ */
+void FLEXCAN_TransferStopReceiveFifoRingEDMA(CAN_Type *base, flexcan_edma_handle_t *handle)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxFifoEdmaHandle);
+
+    FLEXCAN_TransferAbortReceiveFifoEDMA(base, handle);
+
+    /* Restore the callback for the single frame receive. */
+    EDMA_SetCallback(handle->rxFifoEdmaHandle, FLEXCAN_ReceiveFifoEDMACallback,
+                     &s_flexcanEdmaPrivateHandle[FLEXCAN_GetInstance(base)]);
+
+    handle->rxFifoRing       = NULL;
+    handle->rxFifoRingSize   = 0U;
+    handle->rxFifoRingUnread = 0U;
+}
+
+/*!
+ * brief Gets the received frames in the frame ring.
+ *
+ * This function returns the oldest frames not released yet. When the frames wrap around the end of
+ * the ring, only the part till the end of the ring is returned, the rest is returned after this part
+ * is released.
+ *
+ * param handle Pointer to flexcan_edma_handle_t structure.
+ * param frames Pointer to get the address of the frames in the ring.
+ * param count Pointer to get the number of frames at p frames.
+ * retval kStatus_Success Get successfully through the parameters.
+ * retval kStatus_NoTransferInProgress Rx FIFO streaming is not started.
+ */
+status_t FLEXCAN_TransferGetReceiveFifoRingDataEDMA(flexcan_edma_handle_t *handle,
+                                                    flexcan_frame_t **frames,
+                                                    size_t *count)
+{
+    assert(NULL != handle);
+    assert(NULL != frames);
+    assert(NULL != count);
+
+    bool overrun;
+    size_t tail;
+    size_t unread;
+    uint32_t primask;
+
+    if (NULL == handle->rxFifoRing)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+    (void)FLEXCAN_UpdateReceiveFifoRingEDMA(handle, &overrun);
+
+    primask = DisableGlobalIRQ();
+    tail    = handle->rxFifoRingTail;
+    unread  = handle->rxFifoRingUnread;
+    EnableGlobalIRQ(primask);
+
+    *frames = &handle->rxFifoRing[tail];
+    *count  = MIN(unread, handle->rxFifoRingSize - tail);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Releases the frames in the frame ring.
+ *
+ * The released frames are used again by the eDMA to receive new frames.
+ *
+ * param handle Pointer to flexcan_edma_handle_t structure.
+ * param count Number of frames to release, must not exceed the number of the unreleased frames.
+ */
+void FLEXCAN_TransferReleaseReceiveFifoRingEDMA(flexcan_edma_handle_t *handle, size_t count)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxFifoRing);
+
+    uint32_t primask;
+
+    primask = DisableGlobalIRQ();
+    /* The frames may have been dropped by an overrun after they were got. */
+    count                  = MIN(count, handle->rxFifoRingUnread);
+    handle->rxFifoRingTail = (handle->rxFifoRingTail + count) % handle->rxFifoRingSize;
+    handle->rxFifoRingUnread -= count;
+    EnableGlobalIRQ(primask);
+}
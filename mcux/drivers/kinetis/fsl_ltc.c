@@ -104,6 +104,33 @@ typedef union _ltc_xcm_block_t
     uint8_t b[16]; /*!< 16 octets block for CCM B0 and CTR0 and for GCM */
 } ltc_xcm_block_t;
 
+/*! Internal states of the AES GCM and CCM streaming process */
+typedef enum _ltc_aes_xcm_state
+{
+    kLTC_XcmInit = 1u, /*!< No message job has run yet. Context words hold CCM B0 and CTR0. */
+    kLTC_XcmUpdate,    /*!< Context words hold the LTC context saved after the last job. */
+} ltc_aes_xcm_state_t;
+
+/*! Number of LTC context register words saved between AES GCM and CCM streaming jobs. GCM: MAC, Yi and Y0.
+    CCM: MAC, CTRi and CTR0. */
+#define LTC_AES_XCM_CTX_NUM_WORDS 12U
+
+typedef struct _ltc_aes_xcm_ctx_internal
+{
+    ltc_xcm_block_t blk;                       /*!< last (in)complete block of the message passed so far */
+    uint32_t blksz;                            /*!< number of valid bytes in blk */
+    LTC_Type *base;                            /*!< LTC peripheral base address */
+    ltc_mode_symmetric_alg_t mode;             /*!< kLTC_ModeGCM or kLTC_ModeCCM */
+    ltc_mode_encrypt_t enc;                    /*!< encrypt or decrypt */
+    ltc_aes_xcm_state_t state;                 /*!< finite machine state of the streaming process */
+    uint32_t msgSize;                          /*!< number of message bytes passed to the update */
+    uint32_t ccmSize;                          /*!< CCM message size given to the initialization */
+    uint32_t tagSize;                          /*!< CCM tag size given to the initialization */
+    uint32_t keySize;                          /*!< key size in bytes */
+    uint32_t key[8];                           /*!< input key */
+    uint32_t word[LTC_AES_XCM_CTX_NUM_WORDS]; /*!< LTC context that needs to be saved/restored between LTC jobs */
+} ltc_aes_xcm_ctx_internal_t;
+
 #if defined(FSL_FEATURE_LTC_HAS_PKHA) && FSL_FEATURE_LTC_HAS_PKHA
 
 /*! @brief PKHA functions - arithmetic, copy/clear memory. */
@@ -2236,6 +2263,550 @@ status_t LTC_AES_DecryptTagCcm(LTC_Type *base,
     return status;
 }
 
+/*******************************************************************************
+ * GCM and CCM streaming Code static
+ ******************************************************************************/
+static void ltc_aes_xcm_ctx_init(ltc_aes_xcm_ctx_internal_t *ctx,
+                                 LTC_Type *base,
+                                 ltc_mode_symmetric_alg_t mode,
+                                 ltc_mode_encrypt_t enc,
+                                 const uint8_t *key,
+                                 uint32_t keySize)
+{
+    uint32_t i;
+    uint32_t *ctxW = (uint32_t *)(uint32_t)ctx;
+
+    assert(sizeof(ltc_aes_xcm_ctx_internal_t) <= sizeof(ltc_aes_xcm_ctx_t));
+
+    for (i = 0; i < (uint32_t)LTC_AES_XCM_CTX_SIZE; i++)
+    {
+        ctxW[i] = 0u;
+    }
+
+    ctx->base    = base;
+    ctx->mode    = mode;
+    ctx->enc     = enc;
+    ctx->state   = kLTC_XcmInit;
+    ctx->keySize = keySize;
+    ltc_memcpy(&ctx->key[0], key, keySize);
+}
+
+static void ltc_aes_xcm_save_context(ltc_aes_xcm_ctx_internal_t *ctx)
+{
+    (void)ltc_get_context(ctx->base, (uint8_t *)&ctx->word[0], (uint8_t)sizeof(ctx->word), 0u);
+}
+
+static void ltc_aes_xcm_restore_context(ltc_aes_xcm_ctx_internal_t *ctx, ltc_mode_algorithm_state_t as)
+{
+    /* Key and mode are written again, as the LTC may have run other jobs since the last call. */
+    (void)ltc_symmetric_alg_state(ctx->base, (const uint8_t *)&ctx->key[0], (uint8_t)ctx->keySize, kLTC_AlgorithmAES,
+                                  ctx->mode, ctx->enc, as);
+    (void)ltc_set_context(ctx->base, (const uint8_t *)&ctx->word[0], (uint8_t)sizeof(ctx->word), 0u);
+}
+
+/*!
+ * @brief Processes whole blocks of the AES GCM or CCM message in LTC jobs of up to LTC_FIFO_SZ_MAX_DOWN_ALGN bytes.
+ *
+ * The first job of CCM without AAD is INITIALIZE, the others are UPDATE. The LTC context must be restored before.
+ */
+static status_t ltc_aes_xcm_process_blocks(ltc_aes_xcm_ctx_internal_t *ctx,
+                                           const uint8_t *input,
+                                           uint32_t inputSize,
+                                           uint8_t *output)
+{
+    LTC_Type *base  = ctx->base;
+    status_t status = kStatus_Success;
+    ltc_mode_t modeReg;
+    uint32_t sz;
+
+    while ((0U != inputSize) && (kStatus_Success == status))
+    {
+        sz = (inputSize > LTC_FIFO_SZ_MAX_DOWN_ALGN) ? LTC_FIFO_SZ_MAX_DOWN_ALGN : inputSize;
+
+        /* The mode register is cleared after each job. */
+        modeReg = (uint32_t)kLTC_AlgorithmAES | (uint32_t)ctx->mode | (uint32_t)ctx->enc;
+        modeReg |= (ctx->state == kLTC_XcmInit) ? (uint32_t)kLTC_ModeInit : (uint32_t)kLTC_ModeUpdate;
+        base->MD   = modeReg;
+        ctx->state = kLTC_XcmUpdate;
+
+        status = ltc_symmetric_process_data(base, input, sz, output);
+        inputSize -= sz;
+        input  = &input[sz];
+        output = &output[sz];
+    }
+
+    return status;
+}
+
+static status_t ltc_aes_xcm_update(
+    ltc_aes_xcm_ctx_internal_t *ctx, const uint8_t *input, uint8_t *output, uint32_t inputSize, uint32_t *outputSize)
+{
+    status_t status  = kStatus_Success;
+    uint32_t outSize = 0u;
+    uint32_t sz;
+
+    if ((NULL == ctx) || (NULL == ctx->base) || (NULL == outputSize) ||
+        ((0U != inputSize) && ((NULL == input) || (NULL == output))))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* CCM authenticates the message size in the first block. */
+    if ((ctx->mode == kLTC_ModeCCM) && (inputSize > (ctx->ccmSize - ctx->msgSize)))
+    {
+        return kStatus_InvalidArgument;
+    }
+    ctx->msgSize += inputSize;
+
+    /* The last block of the message is processed by the finish, so keep it while it can be the last one. */
+    if ((ctx->blksz + inputSize) <= LTC_AES_BLOCK_SIZE)
+    {
+        ltc_memcpy(&ctx->blk.b[ctx->blksz], input, inputSize);
+        ctx->blksz += inputSize;
+        *outputSize = 0u;
+        return kStatus_Success;
+    }
+
+    ltc_aes_xcm_restore_context(ctx, kLTC_ModeUpdate);
+
+    /* Complete the block kept in the context, there is more data after it. */
+    if (0U != ctx->blksz)
+    {
+        sz = LTC_AES_BLOCK_SIZE - ctx->blksz;
+        ltc_memcpy(&ctx->blk.b[ctx->blksz], input, sz);
+        inputSize -= sz;
+        input = &input[sz];
+
+        status     = ltc_aes_xcm_process_blocks(ctx, &ctx->blk.b[0], LTC_AES_BLOCK_SIZE, output);
+        ctx->blksz = 0u;
+        outSize    = LTC_AES_BLOCK_SIZE;
+        output     = &output[LTC_AES_BLOCK_SIZE];
+    }
+
+    /* Process whole blocks, and keep the last (in)complete block. inputSize is not zero here. */
+    sz = inputSize - (((inputSize - 1U) % LTC_AES_BLOCK_SIZE) + 1U);
+    if ((kStatus_Success == status) && (0U != sz))
+    {
+        status = ltc_aes_xcm_process_blocks(ctx, input, sz, output);
+        outSize += sz;
+        inputSize -= sz;
+        input = &input[sz];
+    }
+    ltc_memcpy(&ctx->blk.b[0], input, inputSize);
+    ctx->blksz = inputSize;
+
+    ltc_aes_xcm_save_context(ctx);
+    ltc_clear_all(ctx->base, false);
+
+    *outputSize = outSize;
+    return status;
+}
+
+static status_t ltc_aes_xcm_finish(ltc_aes_xcm_ctx_internal_t *ctx,
+                                   uint8_t *output,
+                                   uint32_t *outputSize,
+                                   uint8_t *tag,
+                                   uint32_t tagSize,
+                                   ltc_mode_algorithm_state_t lastAs,
+                                   uint32_t tagIdx)
+{
+    LTC_Type *base = ctx->base;
+    uint32_t *ctxW = (uint32_t *)(uint32_t)ctx;
+    ltc_mode_t modeReg;
+    status_t status;
+    uint32_t i;
+
+    /* The last block is processed with the tag, so the message must not be empty. */
+    if ((0U == ctx->blksz) || (NULL == output) || (NULL == outputSize))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    ltc_aes_xcm_restore_context(ctx, lastAs);
+    modeReg = base->MD;
+
+    status = ltc_symmetric_process_data(base, &ctx->blk.b[0], ctx->blksz, output);
+    if (kStatus_Success == status)
+    {
+        status = ltc_aes_process_tag(base, tag, tagSize, modeReg, tagIdx);
+    }
+    *outputSize = ctx->blksz;
+
+    for (i = 0; i < (uint32_t)LTC_AES_XCM_CTX_SIZE; i++)
+    {
+        ctxW[i] = 0u;
+    }
+
+    ltc_clear_all(base, false);
+    return status;
+}
+
+#if defined(FSL_FEATURE_LTC_HAS_GCM) && FSL_FEATURE_LTC_HAS_GCM
+static status_t ltc_aes_gcm_init_stream(LTC_Type *base,
+                                        ltc_aes_xcm_ctx_t *ctx,
+                                        ltc_mode_encrypt_t encryptMode,
+                                        const uint8_t *iv,
+                                        uint32_t ivSize,
+                                        const uint8_t *aad,
+                                        uint32_t aadSize,
+                                        const uint8_t *key,
+                                        uint32_t keySize)
+{
+    ltc_aes_xcm_ctx_internal_t *ctxInternal;
+    ltc_mode_t modeReg;
+    status_t status;
+
+    if ((NULL == base) || (NULL == ctx) || (NULL == key) || (NULL == iv) || (0U == ivSize) ||
+        ((0U != aadSize) && (NULL == aad)) || (!ltc_check_key_size(keySize)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    ctxInternal = (ltc_aes_xcm_ctx_internal_t *)(uint32_t)ctx;
+    ltc_aes_xcm_ctx_init(ctxInternal, base, kLTC_ModeGCM, encryptMode, key, keySize);
+
+    status = ltc_symmetric_init(base, key, (uint8_t)keySize, kLTC_AlgorithmAES, kLTC_ModeGCM, encryptMode);
+    if (kStatus_Success == status)
+    {
+        modeReg = base->MD;
+
+        /* last chunk of IV is always INITIALIZE (for GHASH to occur) */
+        status = ltc_aes_gcm_process_iv_aad(base, iv, ivSize, modeReg, true, LTC_AES_GCM_TYPE_IV, kLTC_ModeInit);
+        if ((kStatus_Success == status) && (0U != aadSize))
+        {
+            /* message follows in the update, so process last chunk of AAD in UPDATE mode */
+            status =
+                ltc_aes_gcm_process_iv_aad(base, aad, aadSize, modeReg, true, LTC_AES_GCM_TYPE_AAD, kLTC_ModeUpdate);
+        }
+    }
+
+    ctxInternal->state = kLTC_XcmUpdate;
+    ltc_aes_xcm_save_context(ctxInternal);
+    ltc_clear_all(base, false);
+    return status;
+}
+#endif /* FSL_FEATURE_LTC_HAS_GCM */
+
+static status_t ltc_aes_ccm_init_stream(LTC_Type *base,
+                                        ltc_aes_xcm_ctx_t *ctx,
+                                        ltc_mode_encrypt_t encryptMode,
+                                        uint32_t size,
+                                        const uint8_t *iv,
+                                        uint32_t ivSize,
+                                        const uint8_t *aad,
+                                        uint32_t aadSize,
+                                        const uint8_t *key,
+                                        uint32_t keySize,
+                                        uint32_t tagSize)
+{
+    ltc_aes_xcm_ctx_internal_t *ctxInternal;
+    ltc_mode_t modeReg;
+    status_t status;
+
+    if ((NULL == base) || (NULL == ctx) || (NULL == iv) || (NULL == key) || (0U == size) ||
+        ((0U != aadSize) && (NULL == aad)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* size of Nonce (ivSize) must be element of 7,8,9,10,11,12,13 */
+    if ((ivSize < 7u) || (ivSize > 13u))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* octet length of MAC (tagSize) must be element of 4,6,8,10,12,14,16, it is encoded in B0 */
+    if ((tagSize < 4u) || (tagSize > 16u) || (0U != (tagSize & 1u)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* LTC does not support more AAD than this */
+    if ((!ltc_check_key_size(keySize)) || (aadSize >= 65280u))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    ctxInternal = (ltc_aes_xcm_ctx_internal_t *)(uint32_t)ctx;
+    ltc_aes_xcm_ctx_init(ctxInternal, base, kLTC_ModeCCM, encryptMode, key, keySize);
+    ctxInternal->ccmSize = size;
+    ctxInternal->tagSize = tagSize;
+
+    status = ltc_symmetric_init(base, key, (uint8_t)keySize, kLTC_AlgorithmAES, kLTC_ModeCCM, encryptMode);
+    if (kStatus_Success == status)
+    {
+        modeReg = base->MD;
+
+        /* Initialize LTC context for AES CCM: block B0 and initial counter CTR0 */
+        ltc_aes_ccm_context_init(base, size, iv, ivSize, aadSize, tagSize);
+
+        if (0U != aadSize)
+        {
+            /* AAD only job, the message follows in the update */
+            status = ltc_aes_ccm_process_aad(base, 0u, aad, aadSize, &modeReg);
+            if (kStatus_Success == status)
+            {
+                status = ltc_wait(base);
+            }
+            ctxInternal->state = kLTC_XcmUpdate;
+        }
+    }
+
+    ltc_aes_xcm_save_context(ctxInternal);
+    ltc_clear_all(base, false);
+    return status;
+}
+
+/*******************************************************************************
+ * GCM and CCM streaming Code public
+ ******************************************************************************/
+#if defined(FSL_FEATURE_LTC_HAS_GCM) && FSL_FEATURE_LTC_HAS_GCM
+/*!
+ * brief Initializes the AES GCM encryption in streaming.
+ *
+ * Processes the IV and the AAD, then the plain text is encrypted in chunks by ref LTC_AES_UpdateGcm and the
+ * encryption is finished by ref LTC_AES_FinishGcm. The LTC context is saved in the streaming context between
+ * the calls, so other LTC operations can run between them.
+ *
+ * param base LTC peripheral base address
+ * param[out] ctx Output streaming context
+ * param iv Input initial vector
+ * param ivSize Size of the IV
+ * param aad Input additional authentication data. Can be NULL if aadSize is zero.
+ * param aadSize Input size in bytes of AAD
+ * param key Input key to use for encryption
+ * param keySize Size of the input key, in bytes. Must be 16, 24, or 32.
+ * return Status of initialization
+ */
+status_t LTC_AES_EncryptInitGcm(LTC_Type *base,
+                                ltc_aes_xcm_ctx_t *ctx,
+                                const uint8_t *iv,
+                                uint32_t ivSize,
+                                const uint8_t *aad,
+                                uint32_t aadSize,
+                                const uint8_t *key,
+                                uint32_t keySize)
+{
+    return ltc_aes_gcm_init_stream(base, ctx, kLTC_ModeEncrypt, iv, ivSize, aad, aadSize, key, keySize);
+}
+
+/*!
+ * brief Initializes the AES GCM decryption in streaming.
+ *
+ * Processes the IV and the AAD, then the cipher text is decrypted in chunks by ref LTC_AES_UpdateGcm and the
+ * decryption is finished by ref LTC_AES_FinishGcm. The LTC context is saved in the streaming context between
+ * the calls, so other LTC operations can run between them.
+ *
+ * param base LTC peripheral base address
+ * param[out] ctx Output streaming context
+ * param iv Input initial vector
+ * param ivSize Size of the IV
+ * param aad Input additional authentication data. Can be NULL if aadSize is zero.
+ * param aadSize Input size in bytes of AAD
+ * param key Input key to use for decryption
+ * param keySize Size of the input key, in bytes. Must be 16, 24, or 32.
+ * return Status of initialization
+ */
+status_t LTC_AES_DecryptInitGcm(LTC_Type *base,
+                                ltc_aes_xcm_ctx_t *ctx,
+                                const uint8_t *iv,
+                                uint32_t ivSize,
+                                const uint8_t *aad,
+                                uint32_t aadSize,
+                                const uint8_t *key,
+                                uint32_t keySize)
+{
+    return ltc_aes_gcm_init_stream(base, ctx, kLTC_ModeDecrypt, iv, ivSize, aad, aadSize, key, keySize);
+}
+
+/*!
+ * brief Encrypts or decrypts a chunk of the AES GCM message.
+ *
+ * The chunk can be of any size. Whole blocks are processed by LTC, the rest and the last block of the chunk
+ * are kept in the context until the next chunk or the finish, as the last block of the message is processed
+ * with the tag. So the output size can differ from the input size.
+ *
+ * param[in,out] ctx Streaming context
+ * param input Input plain text to encrypt or cipher text to decrypt
+ * param[out] output Output data, at least inputSize + 16 bytes.
+ * param inputSize Size of input data in bytes
+ * param[out] outputSize Output parameter storing the number of bytes written to output
+ * return Status of the update operation
+ */
+status_t LTC_AES_UpdateGcm(
+    ltc_aes_xcm_ctx_t *ctx, const uint8_t *input, uint8_t *output, uint32_t inputSize, uint32_t *outputSize)
+{
+    ltc_aes_xcm_ctx_internal_t *ctxInternal = (ltc_aes_xcm_ctx_internal_t *)(uint32_t)ctx;
+
+    if ((NULL == ctxInternal) || (ctxInternal->mode != kLTC_ModeGCM))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    return ltc_aes_xcm_update(ctxInternal, input, output, inputSize, outputSize);
+}
+
+/*!
+ * brief Finishes the AES GCM encryption or decryption in streaming.
+ *
+ * Processes the last block of the message and the tag, then erases the context. The message must not be empty,
+ * use ref LTC_AES_EncryptTagGcm or ref LTC_AES_DecryptTagGcm to only authenticate the AAD.
+ *
+ * param[in,out] ctx Streaming context
+ * param[out] output Output data of the last block, at least 16 bytes.
+ * param[out] outputSize Output parameter storing the number of bytes written to output
+ * param[in,out] tag Output hash tag for encryption or input hash tag to compare for decryption.
+ *                   Set to NULL to skip tag processing.
+ * param tagSize Input size of the tag, in bytes. Must be 4, 8, 12, 13, 14, 15, or 16.
+ * return Status of the finish operation
+ */
+status_t LTC_AES_FinishGcm(
+    ltc_aes_xcm_ctx_t *ctx, uint8_t *output, uint32_t *outputSize, uint8_t *tag, uint32_t tagSize)
+{
+    ltc_aes_xcm_ctx_internal_t *ctxInternal = (ltc_aes_xcm_ctx_internal_t *)(uint32_t)ctx;
+
+    if ((NULL == ctxInternal) || (ctxInternal->mode != kLTC_ModeGCM))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* octet length of tag (tagSize) must be element of 4,8,12,13,14,15,16 */
+    if ((NULL != tag) && (((tagSize > 16u) || (tagSize < 12u)) && (tagSize != 4u) && (tagSize != 8u)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* the last block is processed in INITIALIZE/FINALIZE, as for the one call GCM */
+    return ltc_aes_xcm_finish(ctxInternal, output, outputSize, tag, tagSize, kLTC_ModeInitFinal, LTC_GCM_TAG_IDX);
+}
+#endif /* FSL_FEATURE_LTC_HAS_GCM */
+
+/*!
+ * brief Initializes the AES CCM encryption in streaming.
+ *
+ * Processes the AAD, then the plain text is encrypted in chunks by ref LTC_AES_UpdateCcm and the encryption
+ * is finished by ref LTC_AES_FinishCcm. The LTC context is saved in the streaming context between the calls,
+ * so other LTC operations can run between them.
+ *
+ * param base LTC peripheral base address
+ * param[out] ctx Output streaming context
+ * param size Size of the whole message in bytes, which is authenticated in the first block. Must not be zero.
+ * param iv Nonce
+ * param ivSize Length of the Nonce in bytes. Must be 7, 8, 9, 10, 11, 12, or 13.
+ * param aad Input additional authentication data. Can be NULL if aadSize is zero.
+ * param aadSize Input size in bytes of AAD.
+ * param key Input key to use for encryption
+ * param keySize Size of the input key, in bytes. Must be 16, 24, or 32.
+ * param tagSize Input size of the tag to generate, in bytes. Must be 4, 6, 8, 10, 12, 14, or 16.
+ * return Status of initialization
+ */
+status_t LTC_AES_EncryptInitCcm(LTC_Type *base,
+                                ltc_aes_xcm_ctx_t *ctx,
+                                uint32_t size,
+                                const uint8_t *iv,
+                                uint32_t ivSize,
+                                const uint8_t *aad,
+                                uint32_t aadSize,
+                                const uint8_t *key,
+                                uint32_t keySize,
+                                uint32_t tagSize)
+{
+    return ltc_aes_ccm_init_stream(base, ctx, kLTC_ModeEncrypt, size, iv, ivSize, aad, aadSize, key, keySize,
+                                   tagSize);
+}
+
+/*!
+ * brief Initializes the AES CCM decryption in streaming.
+ *
+ * Processes the AAD, then the cipher text is decrypted in chunks by ref LTC_AES_UpdateCcm and the decryption
+ * is finished by ref LTC_AES_FinishCcm. The LTC context is saved in the streaming context between the calls,
+ * so other LTC operations can run between them.
+ *
+ * param base LTC peripheral base address
+ * param[out] ctx Output streaming context
+ * param size Size of the whole message in bytes, which is authenticated in the first block. Must not be zero.
+ * param iv Nonce
+ * param ivSize Length of the Nonce in bytes. Must be 7, 8, 9, 10, 11, 12, or 13.
+ * param aad Input additional authentication data. Can be NULL if aadSize is zero.
+ * param aadSize Input size in bytes of AAD.
+ * param key Input key to use for decryption
+ * param keySize Size of the input key, in bytes. Must be 16, 24, or 32.
+ * param tagSize Input size of the received tag to compare with the computed tag, in bytes. Must be 4, 6, 8, 10, 12,
+ * 14, or 16.
+ * return Status of initialization
+ */
+status_t LTC_AES_DecryptInitCcm(LTC_Type *base,
+                                ltc_aes_xcm_ctx_t *ctx,
+                                uint32_t size,
+                                const uint8_t *iv,
+                                uint32_t ivSize,
+                                const uint8_t *aad,
+                                uint32_t aadSize,
+                                const uint8_t *key,
+                                uint32_t keySize,
+                                uint32_t tagSize)
+{
+    return ltc_aes_ccm_init_stream(base, ctx, kLTC_ModeDecrypt, size, iv, ivSize, aad, aadSize, key, keySize,
+                                   tagSize);
+}
+
+/*!
+ * brief Encrypts or decrypts a chunk of the AES CCM message.
+ *
+ * The chunk can be of any size, the total size of the chunks must not exceed the message size given to the
+ * initialization. Whole blocks are processed by LTC, the rest and the last block of the chunk are kept in the
+ * context until the next chunk or the finish, as the last block of the message is processed with the tag. So the
+ * output size can differ from the input size.
+ *
+ * param[in,out] ctx Streaming context
+ * param input Input plain text to encrypt or cipher text to decrypt
+ * param[out] output Output data, at least inputSize + 16 bytes.
+ * param inputSize Size of input data in bytes
+ * param[out] outputSize Output parameter storing the number of bytes written to output
+ * return Status of the update operation
+ */
+status_t LTC_AES_UpdateCcm(
+    ltc_aes_xcm_ctx_t *ctx, const uint8_t *input, uint8_t *output, uint32_t inputSize, uint32_t *outputSize)
+{
+    ltc_aes_xcm_ctx_internal_t *ctxInternal = (ltc_aes_xcm_ctx_internal_t *)(uint32_t)ctx;
+
+    if ((NULL == ctxInternal) || (ctxInternal->mode != kLTC_ModeCCM))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    return ltc_aes_xcm_update(ctxInternal, input, output, inputSize, outputSize);
+}
+
+/*!
+ * brief Finishes the AES CCM encryption or decryption in streaming.
+ *
+ * Processes the last block of the message and the tag, then erases the context. The total size of the chunks
+ * must be the message size given to the initialization.
+ *
+ * param[in,out] ctx Streaming context
+ * param[out] output Output data of the last block, at least 16 bytes.
+ * param[out] outputSize Output parameter storing the number of bytes written to output
+ * param[in,out] tag Output tag for encryption or received tag to compare for decryption, of the tag size given
+ *                   to the initialization. Set to NULL to skip tag processing.
+ * return Status of the finish operation
+ */
+status_t LTC_AES_FinishCcm(ltc_aes_xcm_ctx_t *ctx, uint8_t *output, uint32_t *outputSize, uint8_t *tag)
+{
+    ltc_aes_xcm_ctx_internal_t *ctxInternal = (ltc_aes_xcm_ctx_internal_t *)(uint32_t)ctx;
+    ltc_mode_algorithm_state_t lastAs;
+
+    if ((NULL == ctxInternal) || (ctxInternal->mode != kLTC_ModeCCM) || (ctxInternal->msgSize != ctxInternal->ccmSize))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Without AAD, a message of one block is processed in one INITIALIZE/FINALIZE job. */
+    lastAs = (ctxInternal->state == kLTC_XcmInit) ? kLTC_ModeInitFinal : kLTC_ModeFinalize;
+
+    return ltc_aes_xcm_finish(ctxInternal, output, outputSize, tag, ctxInternal->tagSize, lastAs, LTC_CCM_TAG_IDX);
+}
+
 #if defined(FSL_FEATURE_LTC_HAS_DES) && FSL_FEATURE_LTC_HAS_DES
 /*******************************************************************************
  * DES / 3DES Code static
@@ -20,9 +20,9 @@
  */
 /*! @name Driver version */
 /*@{*/
-/*! @brief LTC driver version. Version 2.0.8.
+/*! @brief LTC driver version. Version 2.0.9.
  *
- * Current version: 2.0.8
+ * Current version: 2.0.9
  *
  * Change log:
  * - Version 2.0.1
@@ -48,8 +48,11 @@
  *
  * - Version 2.0.8
  *   - Fix Coverity issues
+ *
+ * - Version 2.0.9
+ *   - Add AES GCM and CCM streaming functions
  */
-#define FSL_LTC_DRIVER_VERSION (MAKE_VERSION(2, 0, 8))
+#define FSL_LTC_DRIVER_VERSION (MAKE_VERSION(2, 0, 9))
 /*@}*/
 /*! @} */
 
@@ -72,6 +75,15 @@ typedef enum _ltc_aes_key_t
     kLTC_DecryptKey = 1U, /*!< Input key is a decrypt key */
 } ltc_aes_key_t;
 
+/*! @brief LTC AES GCM and CCM streaming context size. */
+#define LTC_AES_XCM_CTX_SIZE 33
+
+/*! @brief Storage type used to save AES GCM and CCM streaming context. */
+typedef struct _ltc_aes_xcm_ctx_t
+{
+    uint32_t x[LTC_AES_XCM_CTX_SIZE];
+} ltc_aes_xcm_ctx_t;
+
 /*!
  *@}
  */
@@ -431,6 +443,92 @@ status_t LTC_AES_DecryptTagGcm(LTC_Type *base,
                                uint32_t keySize,
                                const uint8_t *tag,
                                uint32_t tagSize);
+
+/*!
+ * @brief Initializes the AES GCM encryption in streaming.
+ *
+ * Processes the IV and the AAD, then the plain text is encrypted in chunks by @ref LTC_AES_UpdateGcm and the
+ * encryption is finished by @ref LTC_AES_FinishGcm. The LTC context is saved in the streaming context between
+ * the calls, so other LTC operations can run between them.
+ *
+ * @param base LTC peripheral base address
+ * @param[out] ctx Output streaming context
+ * @param iv Input initial vector
+ * @param ivSize Size of the IV
+ * @param aad Input additional authentication data. Can be NULL if aadSize is zero.
+ * @param aadSize Input size in bytes of AAD
+ * @param key Input key to use for encryption
+ * @param keySize Size of the input key, in bytes. Must be 16, 24, or 32.
+ * @return Status of initialization
+ */
+status_t LTC_AES_EncryptInitGcm(LTC_Type *base,
+                                ltc_aes_xcm_ctx_t *ctx,
+                                const uint8_t *iv,
+                                uint32_t ivSize,
+                                const uint8_t *aad,
+                                uint32_t aadSize,
+                                const uint8_t *key,
+                                uint32_t keySize);
+
+/*!
+ * @brief Initializes the AES GCM decryption in streaming.
+ *
+ * Processes the IV and the AAD, then the cipher text is decrypted in chunks by @ref LTC_AES_UpdateGcm and the
+ * decryption is finished by @ref LTC_AES_FinishGcm. The LTC context is saved in the streaming context between
+ * the calls, so other LTC operations can run between them.
+ *
+ * @param base LTC peripheral base address
+ * @param[out] ctx Output streaming context
+ * @param iv Input initial vector
+ * @param ivSize Size of the IV
+ * @param aad Input additional authentication data. Can be NULL if aadSize is zero.
+ * @param aadSize Input size in bytes of AAD
+ * @param key Input key to use for decryption
+ * @param keySize Size of the input key, in bytes. Must be 16, 24, or 32.
+ * @return Status of initialization
+ */
+status_t LTC_AES_DecryptInitGcm(LTC_Type *base,
+                                ltc_aes_xcm_ctx_t *ctx,
+                                const uint8_t *iv,
+                                uint32_t ivSize,
+                                const uint8_t *aad,
+                                uint32_t aadSize,
+                                const uint8_t *key,
+                                uint32_t keySize);
+
+/*!
+ * @brief Encrypts or decrypts a chunk of the AES GCM message.
+ *
+ * The chunk can be of any size. Whole blocks are processed by LTC, the rest and the last block of the chunk
+ * are kept in the context until the next chunk or the finish, as the last block of the message is processed
+ * with the tag. So the output size can differ from the input size.
+ *
+ * @param[in,out] ctx Streaming context
+ * @param input Input plain text to encrypt or cipher text to decrypt
+ * @param[out] output Output data, at least inputSize + 16 bytes.
+ * @param inputSize Size of input data in bytes
+ * @param[out] outputSize Output parameter storing the number of bytes written to output
+ * @return Status of the update operation
+ */
+status_t LTC_AES_UpdateGcm(
+    ltc_aes_xcm_ctx_t *ctx, const uint8_t *input, uint8_t *output, uint32_t inputSize, uint32_t *outputSize);
+
+/*!
+ * @brief Finishes the AES GCM encryption or decryption in streaming.
+ *
+ * Processes the last block of the message and the tag, then erases the context. The message must not be empty,
+ * use @ref LTC_AES_EncryptTagGcm or @ref LTC_AES_DecryptTagGcm to only authenticate the AAD.
+ *
+ * @param[in,out] ctx Streaming context
+ * @param[out] output Output data of the last block, at least 16 bytes.
+ * @param[out] outputSize Output parameter storing the number of bytes written to output
+ * @param[in,out] tag Output hash tag for encryption or input hash tag to compare for decryption.
+ *                    Set to NULL to skip tag processing.
+ * @param tagSize Input size of the tag, in bytes. Must be 4, 8, 12, 13, 14, 15, or 16.
+ * @return Status of the finish operation
+ */
+status_t LTC_AES_FinishGcm(
+    ltc_aes_xcm_ctx_t *ctx, uint8_t *output, uint32_t *outputSize, uint8_t *tag, uint32_t tagSize);
 #endif /* FSL_FEATURE_LTC_HAS_GCM */
 
 /*!
@@ -498,6 +596,100 @@ status_t LTC_AES_DecryptTagCcm(LTC_Type *base,
                                const uint8_t *tag,
                                uint32_t tagSize);
 
+/*!
+ * @brief Initializes the AES CCM encryption in streaming.
+ *
+ * Processes the AAD, then the plain text is encrypted in chunks by @ref LTC_AES_UpdateCcm and the encryption
+ * is finished by @ref LTC_AES_FinishCcm. The LTC context is saved in the streaming context between the calls,
+ * so other LTC operations can run between them.
+ *
+ * @param base LTC peripheral base address
+ * @param[out] ctx Output streaming context
+ * @param size Size of the whole message in bytes, which is authenticated in the first block. Must not be zero.
+ * @param iv Nonce
+ * @param ivSize Length of the Nonce in bytes. Must be 7, 8, 9, 10, 11, 12, or 13.
+ * @param aad Input additional authentication data. Can be NULL if aadSize is zero.
+ * @param aadSize Input size in bytes of AAD.
+ * @param key Input key to use for encryption
+ * @param keySize Size of the input key, in bytes. Must be 16, 24, or 32.
+ * @param tagSize Input size of the tag to generate, in bytes. Must be 4, 6, 8, 10, 12, 14, or 16.
+ * @return Status of initialization
+ */
+status_t LTC_AES_EncryptInitCcm(LTC_Type *base,
+                                ltc_aes_xcm_ctx_t *ctx,
+                                uint32_t size,
+                                const uint8_t *iv,
+                                uint32_t ivSize,
+                                const uint8_t *aad,
+                                uint32_t aadSize,
+                                const uint8_t *key,
+                                uint32_t keySize,
+                                uint32_t tagSize);
+
+/*!
+ * @brief Initializes the AES CCM decryption in streaming.
+ *
+ * Processes the AAD, then the cipher text is decrypted in chunks by @ref LTC_AES_UpdateCcm and the decryption
+ * is finished by @ref LTC_AES_FinishCcm. The LTC context is saved in the streaming context between the calls,
+ * so other LTC operations can run between them.
+ *
+ * @param base LTC peripheral base address
+ * @param[out] ctx Output streaming context
+ * @param size Size of the whole message in bytes, which is authenticated in the first block. Must not be zero.
+ * @param iv Nonce
+ * @param ivSize Length of the Nonce in bytes. Must be 7, 8, 9, 10, 11, 12, or 13.
+ * @param aad Input additional authentication data. Can be NULL if aadSize is zero.
+ * @param aadSize Input size in bytes of AAD.
+ * @param key Input key to use for decryption
+ * @param keySize Size of the input key, in bytes. Must be 16, 24, or 32.
+ * @param tagSize Input size of the received tag to compare with the computed tag, in bytes. Must be 4, 6, 8, 10, 12,
+ * 14, or 16.
+ * @return Status of initialization
+ */
+status_t LTC_AES_DecryptInitCcm(LTC_Type *base,
+                                ltc_aes_xcm_ctx_t *ctx,
+                                uint32_t size,
+                                const uint8_t *iv,
+                                uint32_t ivSize,
+                                const uint8_t *aad,
+                                uint32_t aadSize,
+                                const uint8_t *key,
+                                uint32_t keySize,
+                                uint32_t tagSize);
+
+/*!
+ * @brief Encrypts or decrypts a chunk of the AES CCM message.
+ *
+ * The chunk can be of any size, the total size of the chunks must not exceed the message size given to the
+ * initialization. Whole blocks are processed by LTC, the rest and the last block of the chunk are kept in the
+ * context until the next chunk or the finish, as the last block of the message is processed with the tag. So the
+ * output size can differ from the input size.
+ *
+ * @param[in,out] ctx Streaming context
+ * @param input Input plain text to encrypt or cipher text to decrypt
+ * @param[out] output Output data, at least inputSize + 16 bytes.
+ * @param inputSize Size of input data in bytes
+ * @param[out] outputSize Output parameter storing the number of bytes written to output
+ * @return Status of the update operation
+ */
+status_t LTC_AES_UpdateCcm(
+    ltc_aes_xcm_ctx_t *ctx, const uint8_t *input, uint8_t *output, uint32_t inputSize, uint32_t *outputSize);
+
+/*!
+ * @brief Finishes the AES CCM encryption or decryption in streaming.
+ *
+ * Processes the last block of the message and the tag, then erases the context. The total size of the chunks
+ * must be the message size given to the initialization.
+ *
+ * @param[in,out] ctx Streaming context
+ * @param[out] output Output data of the last block, at least 16 bytes.
+ * @param[out] outputSize Output parameter storing the number of bytes written to output
+ * @param[in,out] tag Output tag for encryption or received tag to compare for decryption, of the tag size given
+ *                    to the initialization. Set to NULL to skip tag processing.
+ * @return Status of the finish operation
+ */
+status_t LTC_AES_FinishCcm(ltc_aes_xcm_ctx_t *ctx, uint8_t *output, uint32_t *outputSize, uint8_t *tag);
+
 /*!
  *@}
  */
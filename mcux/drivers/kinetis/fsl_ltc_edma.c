@@ -44,6 +44,9 @@ static LTC_Type *const s_ltcBase[] = LTC_BASE_PTRS;
 
 #define LTC_FIFO_SZ_MAX_DOWN_ALGN (0xff0u)
 
+/* Bytes moved by eDMA for one LTC FIFO DMA request of 4 entries, one AES block. */
+#define LTC_EDMA_REQUEST_BYTES (16U)
+
 enum _ltc_edma_md_dk_bit_shift
 {
     kLTC_ModeRegBitShiftDK = 12U,
@@ -54,6 +57,7 @@ enum _ltc_edma_md_dk_bit_shift
  ******************************************************************************/
 static uint32_t LTC_GetInstance(LTC_Type *base);
 static void ltc_symmetric_process_EDMA(LTC_Type *base, uint32_t inSize, const uint8_t **inData, uint8_t **outData);
+static uint32_t ltc_get_transfer_width_EDMA(const uint8_t *buffer);
 static status_t ltc_process_message_in_sessions_EDMA(LTC_Type *base, ltc_edma_handle_t *handle);
 
 /*******************************************************************************
@@ -1560,7 +1564,17 @@ static void LTC_OutputFifoEDMACallback(edma_handle_t *handle, void *param, bool
     }
 }
 
-/* @brief Copy data to Input FIFO and reading from Ouput FIFO using eDMA. */
+/* @brief Gets the eDMA transfer size for the memory side, words if the buffer is aligned, otherwise bytes. */
+static uint32_t ltc_get_transfer_width_EDMA(const uint8_t *buffer)
+{
+    return ((0U == ((uint32_t)buffer & 3U)) ? 4U : 1U);
+}
+
+/* @brief Copy data to Input FIFO and reading from Ouput FIFO using eDMA.
+ *
+ * inSize must be multiple of 16 bytes. The FIFOs request eDMA by 4 entries, so each minor loop moves one AES block,
+ * and the input and output channels run concurrently with the LTC.
+ */
 static void ltc_symmetric_process_EDMA(LTC_Type *base, uint32_t inSize, const uint8_t **inData, uint8_t **outData)
 {
     const uint8_t *in          = *inData;
@@ -1577,15 +1591,15 @@ static void ltc_symmetric_process_EDMA(LTC_Type *base, uint32_t inSize, const ui
         (void)memset(&config, 0, sizeof(config));
 
         /* Prepare transfer. */
-        EDMA_PrepareTransfer(&config, (void *)(uint32_t *)(uintptr_t)inputBuffer, 1U,
-                             (void *)(uint32_t *)(uintptr_t)(&base->IFIFO), 4U, 4U, entry_number * 4U,
-                             kEDMA_MemoryToPeripheral);
+        EDMA_PrepareTransfer(&config, (void *)(uint32_t *)(uintptr_t)inputBuffer,
+                             ltc_get_transfer_width_EDMA(inputBuffer), (void *)(uint32_t *)(uintptr_t)(&base->IFIFO),
+                             4U, LTC_EDMA_REQUEST_BYTES, entry_number * 4U, kEDMA_MemoryToPeripheral);
         /* Submit transfer. */
         (void)EDMA_SubmitTransfer(s_edmaPrivateHandle[instance].handle->inputFifoEdmaHandle,
                                   (const edma_transfer_config_t *)(uint32_t)&config);
 
         /* Set request size.*/
-        base->CTL &= ~LTC_CTL_IFR_MASK; /* 1 entry */
+        base->CTL |= LTC_CTL_IFR_MASK; /* 4 entries */
         /* Enable Input Fifo DMA */
         LTC_EnableInputFifoDMA(base, true);
 
@@ -1596,14 +1610,15 @@ static void ltc_symmetric_process_EDMA(LTC_Type *base, uint32_t inSize, const ui
         (void)memset(&config, 0, sizeof(config));
 
         /* Prepare transfer. */
-        EDMA_PrepareTransfer(&config, (void *)(uint32_t *)(uintptr_t)(&base->OFIFO), 4U, (void *)outputBuffer, 1U, 4U,
-                             entry_number * 4U, kEDMA_PeripheralToMemory);
+        EDMA_PrepareTransfer(&config, (void *)(uint32_t *)(uintptr_t)(&base->OFIFO), 4U, (void *)outputBuffer,
+                             ltc_get_transfer_width_EDMA(outputBuffer), LTC_EDMA_REQUEST_BYTES, entry_number * 4U,
+                             kEDMA_PeripheralToMemory);
         /* Submit transfer. */
         (void)EDMA_SubmitTransfer(s_edmaPrivateHandle[instance].handle->outputFifoEdmaHandle,
                                   (const edma_transfer_config_t *)(uint32_t)&config);
 
         /* Set request size.*/
-        base->CTL &= ~LTC_CTL_OFR_MASK; /* 1 entry */
+        base->CTL |= LTC_CTL_OFR_MASK; /* 4 entries */
 
         /* Enable Output Fifo DMA */
         LTC_EnableOutputFifoDMA(base, true);
@@ -1664,7 +1679,7 @@ void LTC_CreateHandleEDMA(LTC_Type *base,
     EDMA_SetCallback(handle->inputFifoEdmaHandle, LTC_InputFifoEDMACallback, &s_edmaPrivateHandle[instance]);
     EDMA_SetCallback(handle->outputFifoEdmaHandle, LTC_OutputFifoEDMACallback, &s_edmaPrivateHandle[instance]);
 
-    /* Set request size. DMA request size is 1 entry.*/
-    base->CTL &= ~LTC_CTL_IFR_MASK;
-    base->CTL &= ~LTC_CTL_OFR_MASK;
+    /* Set request size. DMA request size is 4 entries, one AES block.*/
+    base->CTL |= LTC_CTL_IFR_MASK;
+    base->CTL |= LTC_CTL_OFR_MASK;
 }
@@ -24,8 +24,8 @@
 
 /*! @name Driver version */
 /*@{*/
-/*! @brief LTC EDMA driver version. Version 2.0.7. */
-#define FSL_LTC_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 7))
+/*! @brief LTC EDMA driver version. Version 2.0.8. */
+#define FSL_LTC_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 8))
 /*@}*/
 
 /* @brief The LTC eDMA handle type. */
@@ -29,6 +29,13 @@ typedef void (*sai_tx_isr_t)(I2S_Type *base, sai_handle_t *saiHandle);
 /*! @brief Typedef for sai rx interrupt handler. */
 typedef void (*sai_rx_isr_t)(I2S_Type *base, sai_handle_t *saiHandle);
 
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+/*! @brief Packs the low halfwords of two words into one word, low halfword first. */
+#define SAI_PACK_HALFWORDS(low, high) __PKHBT((low), (high), 16)
+#else
+#define SAI_PACK_HALFWORDS(low, high) (((low)&0xFFFFU) | ((high) << 16U))
+#endif
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -93,6 +100,32 @@ static void SAI_ReadNonBlocking(I2S_Type *base,
                                 uint8_t *buffer,
                                 uint32_t size);
 
+/*!
+ * @brief Unpacks the samples of one slot from the FIFO words a word at a time.
+ *
+ * @param fifoWords Pointer to the first FIFO word of the slot.
+ * @param stride Number of the FIFO words in a frame.
+ * @param buffer Channel buffer, 4 bytes aligned.
+ * @param bitWidth How many bits in an audio word, 16/24/32 bits.
+ * @param frameNum Number of the frames.
+ * @return Number of the frames unpacked, the rest frames are not enough for a word.
+ */
+static uint32_t SAI_UnpackSlotWords(
+    const uint32_t *fifoWords, uint32_t stride, uint32_t *buffer, uint32_t bitWidth, uint32_t frameNum);
+
+/*!
+ * @brief Packs the samples of one slot into the FIFO words a word at a time.
+ *
+ * @param fifoWords Pointer to the first FIFO word of the slot.
+ * @param stride Number of the FIFO words in a frame.
+ * @param buffer Channel buffer, 4 bytes aligned.
+ * @param bitWidth How many bits in an audio word, 16/24/32 bits.
+ * @param frameNum Number of the frames.
+ * @return Number of the frames packed, the rest frames are not enough for a word.
+ */
+static uint32_t SAI_PackSlotWords(
+    uint32_t *fifoWords, uint32_t stride, const uint32_t *buffer, uint32_t bitWidth, uint32_t frameNum);
+
 /*!
  * @brief Get classic I2S mode configurations.
  *
@@ -288,6 +321,104 @@ static void SAI_ReadNonBlocking(I2S_Type *base,
     }
 }
 
+static uint32_t SAI_UnpackSlotWords(
+    const uint32_t *fifoWords, uint32_t stride, uint32_t *buffer, uint32_t bitWidth, uint32_t frameNum)
+{
+    uint32_t i = 0U;
+    uint32_t b, c;
+
+    switch (bitWidth)
+    {
+        case 16U:
+            /* 2 frames in a word. */
+            for (i = 0U; (i + 2U) <= frameNum; i += 2U)
+            {
+                *buffer++ = SAI_PACK_HALFWORDS(fifoWords[0], fifoWords[stride]);
+                fifoWords += 2U * stride;
+            }
+            break;
+
+        case 24U:
+            /* 4 frames in 3 words. */
+            for (i = 0U; (i + 4U) <= frameNum; i += 4U)
+            {
+                b         = fifoWords[stride];
+                c         = fifoWords[2U * stride];
+                buffer[0] = (fifoWords[0] & 0xFFFFFFU) | (b << 24U);
+                buffer[1] = ((b >> 8U) & 0xFFFFU) | (c << 16U);
+                buffer[2] = ((c >> 16U) & 0xFFU) | (fifoWords[3U * stride] << 8U);
+                buffer += 3U;
+                fifoWords += 4U * stride;
+            }
+            break;
+
+        case 32U:
+            for (i = 0U; i < frameNum; i++)
+            {
+                *buffer++ = *fifoWords;
+                fifoWords += stride;
+            }
+            break;
+
+        default:
+            assert(false);
+            break;
+    }
+
+    return i;
+}
+
+static uint32_t SAI_PackSlotWords(
+    uint32_t *fifoWords, uint32_t stride, const uint32_t *buffer, uint32_t bitWidth, uint32_t frameNum)
+{
+    uint32_t i = 0U;
+    uint32_t a, b, c;
+
+    switch (bitWidth)
+    {
+        case 16U:
+            /* 2 frames in a word. */
+            for (i = 0U; (i + 2U) <= frameNum; i += 2U)
+            {
+                a                 = *buffer++;
+                fifoWords[0]      = a & 0xFFFFU;
+                fifoWords[stride] = a >> 16U;
+                fifoWords += 2U * stride;
+            }
+            break;
+
+        case 24U:
+            /* 4 frames in 3 words. */
+            for (i = 0U; (i + 4U) <= frameNum; i += 4U)
+            {
+                a                      = buffer[0];
+                b                      = buffer[1];
+                c                      = buffer[2];
+                fifoWords[0]           = a & 0xFFFFFFU;
+                fifoWords[stride]      = (a >> 24U) | ((b & 0xFFFFU) << 8U);
+                fifoWords[2U * stride] = (b >> 16U) | ((c & 0xFFU) << 16U);
+                fifoWords[3U * stride] = c >> 8U;
+                buffer += 3U;
+                fifoWords += 4U * stride;
+            }
+            break;
+
+        case 32U:
+            for (i = 0U; i < frameNum; i++)
+            {
+                *fifoWords = *buffer++;
+                fifoWords += stride;
+            }
+            break;
+
+        default:
+            assert(false);
+            break;
+    }
+
+    return i;
+}
+
 static void SAI_GetCommonConfig(sai_transceiver_t *config,
                                 sai_word_width_t bitWidth,
                                 sai_mono_stereo_t mode,
@@ -2197,6 +2328,111 @@ void SAI_ReadBlocking(I2S_Type *base, uint32_t channel, uint32_t bitWidth, uint8
     }
 }
 
+/*!
+ * brief Deinterleaves the TDM frames in FIFO word layout into per-channel buffers.
+ *
+ * The FIFO word buffer holds the slots of each frame in order, one 32-bit word per slot with the sample in the
+ * low bits, as read from the Rx FIFO data register by the CPU or by eDMA. The samples of each slot are packed into
+ * the buffer of the channel, 2, 3 or 4 bytes per sample in little endian. The samples are moved a word at a time
+ * when the channel buffer is 4 bytes aligned.
+ *
+ * param fifoWords Buffer of frameNum * channelNum FIFO words.
+ * param channelBuffers Array of channelNum channel buffer pointers, each holds frameNum samples.
+ * param channelNum Number of the slots in a frame.
+ * param bitWidth How many bits in an audio word, 16/24/32 bits.
+ * param frameNum Number of the frames.
+ */
+void SAI_DeinterleaveSamples(const uint32_t *fifoWords,
+                             uint8_t *const *channelBuffers,
+                             uint32_t channelNum,
+                             uint32_t bitWidth,
+                             uint32_t frameNum)
+{
+    assert(fifoWords && channelBuffers);
+    assert((bitWidth == 16U) || (bitWidth == 24U) || (bitWidth == 32U));
+
+    uint32_t bytesPerWord = bitWidth / 8U;
+    const uint32_t *word;
+    uint8_t *buffer;
+    uint32_t i, j, m;
+
+    for (j = 0U; j < channelNum; j++)
+    {
+        word   = &fifoWords[j];
+        buffer = channelBuffers[j];
+        i      = 0U;
+
+        if (((uint32_t)buffer & 3U) == 0U)
+        {
+            i = SAI_UnpackSlotWords(word, channelNum, (uint32_t *)(uint32_t)buffer, bitWidth, frameNum);
+            word += i * channelNum;
+            buffer += i * bytesPerWord;
+        }
+
+        /* The rest frames, or all the frames of the unaligned buffer. */
+        for (; i < frameNum; i++)
+        {
+            for (m = 0U; m < bytesPerWord; m++)
+            {
+                *buffer++ = (uint8_t)(*word >> (8U * m));
+            }
+            word += channelNum;
+        }
+    }
+}
+
+/*!
+ * brief Interleaves the per-channel buffers into TDM frames in FIFO word layout.
+ *
+ * This function is the reverse of ref SAI_DeinterleaveSamples, the FIFO word buffer can be written to the Tx
+ * FIFO data register by the CPU or by eDMA. The samples are zero extended in the FIFO words.
+ *
+ * param fifoWords Buffer of frameNum * channelNum FIFO words.
+ * param channelBuffers Array of channelNum channel buffer pointers, each holds frameNum samples.
+ * param channelNum Number of the slots in a frame.
+ * param bitWidth How many bits in an audio word, 16/24/32 bits.
+ * param frameNum Number of the frames.
+ */
+void SAI_InterleaveSamples(uint32_t *fifoWords,
+                           const uint8_t *const *channelBuffers,
+                           uint32_t channelNum,
+                           uint32_t bitWidth,
+                           uint32_t frameNum)
+{
+    assert(fifoWords && channelBuffers);
+    assert((bitWidth == 16U) || (bitWidth == 24U) || (bitWidth == 32U));
+
+    uint32_t bytesPerWord = bitWidth / 8U;
+    const uint8_t *buffer;
+    uint32_t *word;
+    uint32_t i, j, m;
+
+    for (j = 0U; j < channelNum; j++)
+    {
+        word   = &fifoWords[j];
+        buffer = channelBuffers[j];
+        i      = 0U;
+
+        if (((uint32_t)buffer & 3U) == 0U)
+        {
+            i = SAI_PackSlotWords(word, channelNum, (const uint32_t *)(uint32_t)buffer, bitWidth, frameNum);
+            word += i * channelNum;
+            buffer += i * bytesPerWord;
+        }
+
+        /* The rest frames, or all the frames of the unaligned buffer. */
+        for (; i < frameNum; i++)
+        {
+            *word = 0U;
+            for (m = 0U; m < bytesPerWord; m++)
+            {
+                *word |= (uint32_t)(*buffer++) << (8U * m);
+            }
+            word += channelNum;
+        }
+    }
+}
+
 /*!
  * brief Initializes the SAI Tx handle.
  *
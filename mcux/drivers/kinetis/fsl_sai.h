@@ -22,7 +22,7 @@
 
 /*! @name Driver version */
 /*@{*/
-#define FSL_SAI_DRIVER_VERSION (MAKE_VERSION(2, 2, 1)) /*!< Version 2.2.1 */
+#define FSL_SAI_DRIVER_VERSION (MAKE_VERSION(2, 2, 2)) /*!< Version 2.2.2 */
 /*@}*/
 
 /*! @brief SAI return status*/
@@ -1331,6 +1331,51 @@ static inline uint32_t SAI_ReadData(I2S_Type *base, uint32_t channel)
 
 /*! @} */
 
+/*!
+ * @name Sample format conversion
+ * @{
+ */
+
+/*!
+ * @brief Deinterleaves the TDM frames in FIFO word layout into per-channel buffers.
+ *
+ * The FIFO word buffer holds the slots of each frame in order, one 32-bit word per slot with the sample in the
+ * low bits, as read from the Rx FIFO data register by the CPU or by eDMA. The samples of each slot are packed into
+ * the buffer of the channel, 2, 3 or 4 bytes per sample in little endian. The samples are moved a word at a time
+ * when the channel buffer is 4 bytes aligned.
+ *
+ * @param fifoWords Buffer of frameNum * channelNum FIFO words.
+ * @param channelBuffers Array of channelNum channel buffer pointers, each holds frameNum samples.
+ * @param channelNum Number of the slots in a frame.
+ * @param bitWidth How many bits in an audio word, 16/24/32 bits.
+ * @param frameNum Number of the frames.
+ */
+void SAI_DeinterleaveSamples(const uint32_t *fifoWords,
+                             uint8_t *const *channelBuffers,
+                             uint32_t channelNum,
+                             uint32_t bitWidth,
+                             uint32_t frameNum);
+
+/*!
+ * @brief Interleaves the per-channel buffers into TDM frames in FIFO word layout.
+ *
+ * This function is the reverse of @ref SAI_DeinterleaveSamples, the FIFO word buffer can be written to the Tx
+ * FIFO data register by the CPU or by eDMA. The samples are zero extended in the FIFO words.
+ *
+ * @param fifoWords Buffer of frameNum * channelNum FIFO words.
+ * @param channelBuffers Array of channelNum channel buffer pointers, each holds frameNum samples.
+ * @param channelNum Number of the slots in a frame.
+ * @param bitWidth How many bits in an audio word, 16/24/32 bits.
+ * @param frameNum Number of the frames.
+ */
+void SAI_InterleaveSamples(uint32_t *fifoWords,
+                           const uint8_t *const *channelBuffers,
+                           uint32_t channelNum,
+                           uint32_t bitWidth,
+                           uint32_t frameNum);
+
+/*! @} */
+
 /*!
  * @name Transactional
  * @{
@@ -23,11 +23,13 @@
 
 /*! @name Driver version */
 /*@{*/
-/*! @brief TRNG driver version 2.0.4.
+/*! @brief TRNG driver version 2.0.5.
  *
- * Current version: 2.0.4
+ * Current version: 2.0.5
  *
  * Change log:
+ * - version 2.0.5
+ *   - Add CTR_DRBG seeded by the TRNG entropy, with the reseed entropy prefetched by interrupt.
  * - version 2.0.4
  *   - Fix MISRA-2012 issues.
  * - Version 2.0.3
@@ -38,7 +40,7 @@
  *   - add support for KL8x and KL28Z
  *   - update default OSCDIV for K81 to divide by 2
  */
-#define FSL_TRNG_DRIVER_VERSION (MAKE_VERSION(2, 0, 4))
+#define FSL_TRNG_DRIVER_VERSION (MAKE_VERSION(2, 0, 5))
 /*@}*/
 
 /*! @brief TRNG sample mode. Used by trng_config_t. */
@@ -123,6 +125,39 @@ typedef struct _trng_user_config
                                                            entropy sample frequency count. */
 } trng_config_t;
 
+#ifndef TRNG_DRBG_RESEED_INTERVAL
+/*! @brief Number of DRBG generate requests between two reseeds. At most 2^48 by NIST SP 800-90A. */
+#define TRNG_DRBG_RESEED_INTERVAL (0x10000U)
+#endif
+
+/*! @brief Maximum number of bytes of one DRBG generate request by NIST SP 800-90A, larger requests are split. */
+#define TRNG_DRBG_MAX_REQUEST_SIZE (0x10000U)
+
+/*! @brief DRBG seed length in bytes, the AES-128 key and block. Personalization and additional inputs
+ *  are up to this length. */
+#define TRNG_DRBG_SEED_SIZE (32U)
+
+/*!
+ * @brief DRBG block cipher function, encrypts one 16 bytes block by AES-128.
+ *
+ * It can use the AES engine of the device, for example LTC_AES_EncryptEcb(), or DCP_AES_SetKey()
+ * and DCP_AES_EncryptEcb(), or HASHCRYPT_AES_SetKey() and HASHCRYPT_AES_EncryptEcb().
+ */
+typedef status_t (*trng_drbg_aes_t)(void *aesData, const uint8_t *key, const uint8_t *input, uint8_t *output);
+
+/*! @brief TRNG CTR_DRBG handle. */
+typedef struct _trng_drbg_handle
+{
+    TRNG_Type *base;                                          /*!< TRNG base address. */
+    trng_drbg_aes_t aes;                                      /*!< AES-128 block cipher function. */
+    void *aesData;                                            /*!< Parameter of the block cipher function. */
+    uint8_t key[16];                                          /*!< DRBG state, Key. */
+    uint8_t v[16];                                            /*!< DRBG state, V. */
+    uint32_t reseedCounter;                                   /*!< DRBG state, number of requests since reseed. */
+    uint32_t entropy[TRNG_DRBG_SEED_SIZE / sizeof(uint32_t)]; /*!< Entropy prefetched for the next reseed. */
+    volatile bool entropyValid;                               /*!< Entropy is prefetched. */
+} trng_drbg_handle_t;
+
 /*******************************************************************************
  * API
  *******************************************************************************/
@@ -204,6 +239,83 @@ void TRNG_Deinit(TRNG_Type *base);
  */
 status_t TRNG_GetRandomData(TRNG_Type *base, void *data, size_t dataSize);
 
+/*!
+ * @name DRBG
+ * @{
+ */
+
+/*!
+ * @brief Instantiates the CTR_DRBG.
+ *
+ * This function instantiates a NIST SP 800-90A CTR_DRBG, AES-128 without derivation function, seeded
+ * by the TRNG entropy, and starts to prefetch the entropy of the next reseed. The entropy is prefetched
+ * in TRNG_DRBG_IRQHandler(), which must be called from the TRNG interrupt handler, so the reseed does
+ * not wait for the entropy generation. The TRNG must be initialized by TRNG_Init() before, and it must
+ * not be read by TRNG_GetRandomData() while the DRBG is instantiated.
+ *
+ * @param base  TRNG base address.
+ * @param handle  DRBG handle.
+ * @param aes  AES-128 block cipher function.
+ * @param aesData  Parameter of the block cipher function.
+ * @param personalization  Personalization string, can be NULL.
+ * @param personalizationSize  Size of the personalization string, up to TRNG_DRBG_SEED_SIZE bytes.
+ * @return If successful, returns the kStatus_Success. Otherwise, it returns an error.
+ */
+status_t TRNG_DRBG_Init(TRNG_Type *base,
+                        trng_drbg_handle_t *handle,
+                        trng_drbg_aes_t aes,
+                        void *aesData,
+                        const uint8_t *personalization,
+                        size_t personalizationSize);
+
+/*!
+ * @brief Reseeds the CTR_DRBG.
+ *
+ * The prefetched entropy is used if it is ready, otherwise this function waits for the TRNG entropy.
+ *
+ * @param handle  DRBG handle.
+ * @param additional  Additional input, can be NULL.
+ * @param additionalSize  Size of the additional input, up to TRNG_DRBG_SEED_SIZE bytes.
+ * @return If successful, returns the kStatus_Success. Otherwise, it returns an error.
+ */
+status_t TRNG_DRBG_Reseed(trng_drbg_handle_t *handle, const uint8_t *additional, size_t additionalSize);
+
+/*!
+ * @brief Gets random data from the CTR_DRBG.
+ *
+ * The DRBG is reseeded first when TRNG_DRBG_RESEED_INTERVAL requests were served since the last reseed.
+ * Requests larger than TRNG_DRBG_MAX_REQUEST_SIZE bytes are split.
+ *
+ * @param handle  DRBG handle.
+ * @param data  Pointer address used to store random data.
+ * @param dataSize  Size of the buffer pointed by the data parameter.
+ * @param additional  Additional input, can be NULL.
+ * @param additionalSize  Size of the additional input, up to TRNG_DRBG_SEED_SIZE bytes.
+ * @return If successful, returns the kStatus_Success. Otherwise, it returns an error.
+ */
+status_t TRNG_DRBG_GetRandomData(
+    trng_drbg_handle_t *handle, void *data, size_t dataSize, const uint8_t *additional, size_t additionalSize);
+
+/*!
+ * @brief Uninstantiates the CTR_DRBG.
+ *
+ * Stops the entropy prefetch and clears the DRBG state.
+ *
+ * @param handle  DRBG handle.
+ */
+void TRNG_DRBG_Deinit(trng_drbg_handle_t *handle);
+
+/*!
+ * @brief TRNG DRBG interrupt handler.
+ *
+ * Reads the entropy generated for the next reseed and masks the TRNG interrupt till the entropy is used.
+ *
+ * @param handle  DRBG handle.
+ */
+void TRNG_DRBG_IRQHandler(trng_drbg_handle_t *handle);
+
+/*! @}*/
+
 #if defined(__cplusplus)
 }
 #endif
@@ -241,11 +241,13 @@ do                                  \
 #if CASPER_ECC_P256
 
 /* Recoding length for the secure scalar multiplication:
-*  Use n=256 and w=4 --> compute ciel(384/3) = 86 + 1 digits
+*  Use n=256 and w=5 --> compute ciel(256/4) = 64 + 1 digits
 */
-#define CASPER_RECODE_LENGTH 87
+#define CASPER_RECODE_LENGTH 65
 #define invert(c, a) invert_mod_p256(c, a)
 #define ONE NISTr256
+#define PRIME NISTp256
+#define G_TABLE NISTp256_G
 
 /* Shift right by 1 <= c <= 31. z[] and x[] in system RAM, no interleaving macros used. */
 #define shiftrightSysram(z, x, c)                    \
@@ -264,11 +266,13 @@ do                                  \
 #elif CASPER_ECC_P384
 
 /* Recoding length for the secure scalar multiplication:
- *  Use n=384 and w=4 --> compute ciel(384/3) = 128 + 1 digits
+ *  Use n=384 and w=5 --> compute ciel(384/4) = 96 + 1 digits
  */
-#define CASPER_RECODE_LENGTH 129
+#define CASPER_RECODE_LENGTH 97
 #define invert(c, a) invert_mod_p384(c, a)
 #define ONE NISTr384
+#define PRIME NISTp384
+#define G_TABLE NISTp384_G
 
 /* Shift right by 1 <= c <= 31.  z[] and x[] in system RAM, no interleaving macros used. */
 #define shiftrightSysram(z, x, c)                       \
@@ -292,6 +296,17 @@ do                                  \
 #error "Define proper NIST curve"
 #endif
 
+/* Window of the secure scalar multiplication, the LUT holds 1*P, 3*P, ..., 15*P. */
+#define CASPER_RECODE_WINDOW 5
+
+/* Windows of the wNAF digits for the base point G and for the other point of the
+ * double scalar multiplication. The odd multiples of G up to 63*G are in flash.
+ */
+#define CASPER_G_WINDOW 7
+#define CASPER_G_TABLE_SIZE (1 << (CASPER_G_WINDOW - 2))
+#define CASPER_Q_WINDOW 5
+#define CASPER_Q_TABLE_SIZE (1 << (CASPER_Q_WINDOW - 2))
+
 #define multiply_casper(c, a, b) MultprecCiosMul_ct(c, a, b, &CASPER_MEM[MOD_SCRATCH_START], Np)
 #define square_casper(c, a) multiply_casper(c, a, a)
 #define sub_casper(c, a, b) CASPER_montsub(c, a, b, &CASPER_MEM[MOD_SCRATCH_START])
@@ -328,6 +343,74 @@ static uint32_t NISTr256[NUM_LIMBS] = {0x00000001, 0x00000000, 0x00000000, 0xfff
                                        0xffffffff, 0xffffffff, 0xfffffffe, 0x00000000};
 
 static uint32_t Np[2] = {1, 0};
+
+/* Odd multiples G, 3G, ..., 63G of the base point, affine in Montgomery form, for the fixed-base window. */
+static const uint32_t NISTp256_G[CASPER_G_TABLE_SIZE][2][NUM_LIMBS] = {
+    {{0x18a9143c, 0x79e730d4, 0x5fedb601, 0x75ba95fc, 0x77622510, 0x79fb732b, 0xa53755c6, 0x18905f76},
+     {0xce95560a, 0xddf25357, 0xba19e45c, 0x8b4ab8e4, 0xdd21f325, 0xd2e88688, 0x25885d85, 0x8571ff18}},
+    {{0x4eebc127, 0xffac3f90, 0x087d81fb, 0xb027f84a, 0x87cbbc98, 0x66ad77dd, 0xb6ff747e, 0x26936a3f},
+     {0xc983a7eb, 0xb04c5c1f, 0x0861fe1a, 0x583e47ad, 0x1a2ee98e, 0x78820831, 0xe587cc07, 0xd5f06a29}},
+    {{0xc45c61f5, 0xbe1b8aae, 0x94b9537d, 0x90ec649a, 0xd076c20c, 0x941cb5aa, 0x890523c8, 0xc9079605},
+     {0xe7ba4f10, 0xeb309b4a, 0xe5eb882b, 0x73c568ef, 0x7e7a1f68, 0x3540a987, 0x2dd1e916, 0x73a076bb}},
+    {{0xa0173b4f, 0x0746354e, 0xd23c00f7, 0x2bd20213, 0x0c23bb08, 0xf43eaab5, 0xc3123e03, 0x13ba5119},
+     {0x3f5b9d4d, 0x2847d030, 0x5da67bdd, 0x6742f2f2, 0x77c94195, 0xef933bdc, 0x6e240867, 0xeaedd915}},
+    {{0x264e20e8, 0x75c96e8f, 0x59a7a841, 0xabe6bfed, 0x44c8eb00, 0x2cc09c04, 0xf0c4e16b, 0xe05b3080},
+     {0xa45f3314, 0x1eb7777a, 0xce5d45e3, 0x56af7bed, 0x88b12f1a, 0x2b6e019a, 0xfd835f9b, 0x086659cd}},
+    {{0x6245e404, 0xea7d260a, 0x6e7fdfe0, 0x9de40795, 0x8dac1ab5, 0x1ff3a415, 0x649c9073, 0x3e7090f1},
+     {0x2b944e88, 0x1a768561, 0xe57f61c8, 0x250f939e, 0x1ead643d, 0x0c0daa89, 0xe125b88e, 0x68930023}},
+    {{0x4b2ed709, 0xccc42563, 0x856fd30d, 0x0e356769, 0x559e9811, 0xbcbcd43f, 0x5395b759, 0x738477ac},
+     {0xc00ee17f, 0x35752b90, 0x742ed2e3, 0x68748390, 0xbd1f5bc1, 0x7cd06422, 0xc9e7b797, 0xfbc08769}},
+    {{0xbc60055b, 0x72bcd8b7, 0x56e27e4b, 0x03cc23ee, 0xe4819370, 0xee337424, 0x0ad3da09, 0xe2aa0e43},
+     {0x6383c45d, 0x40b8524f, 0x42a41b25, 0xd7663554, 0x778a4797, 0x64efa6de, 0x7079adf4, 0x2042170a}},
+    {{0xd53c5c9d, 0x97091dcb, 0xac0a177b, 0xf17624b6, 0x2cfe2dff, 0xb0f13975, 0x6c7a574e, 0xc1a35c0a},
+     {0x93e79987, 0x227d3146, 0xe89cb80e, 0x0575bf30, 0x0d1883bb, 0x2f4e247f, 0x3274c3d0, 0xebd51226}},
+    {{0xa5659ae8, 0xfea912ba, 0x25e1a16e, 0x68363aba, 0x752c41ac, 0xb8842277, 0x2897c3fc, 0xfe545c28},
+     {0xdc4c696b, 0x2d36e9e7, 0xfba977c5, 0x5806244a, 0xe39508c1, 0x85665e9b, 0x6d12597b, 0xf720ee25}},
+    {{0xc135b208, 0x562e4cec, 0x4783f47d, 0x74e1b265, 0x5a3f3b30, 0x6d2a506c, 0xc16762fc, 0xecead9f4},
+     {0xe286e5b9, 0xf29dd4b2, 0x83bb3c61, 0x1b0fadc0, 0x7fac29a4, 0x7a75023e, 0xc9477fa3, 0xc086d5f1}},
+    {{0x2de45068, 0xf4f87653, 0x9e2e1f6e, 0x37c7a7e8, 0xa3584069, 0xd0825fa2, 0x1727bf42, 0xaf2cea7c},
+     {0x9e4785a9, 0x0360a4fb, 0x27299f4a, 0xe5fda49c, 0x71ac2f71, 0x48068e13, 0x9077666f, 0x83d0687b}},
+    {{0xd837879f, 0xa4a319ac, 0xed6b67b0, 0x6fc1b49e, 0x32f1f3af, 0xe3959933, 0x65432a2e, 0x966742eb},
+     {0xb4966228, 0x4b8dc9fe, 0x43f43950, 0x96cc6312, 0xc9b731ee, 0x12068859, 0x56f79968, 0x7b948dc3}},
+    {{0x97e2feb4, 0x042c2af4, 0xaebf7313, 0xd36a42d7, 0x084ffdd7, 0x49d2c9eb, 0x2ef7c76a, 0x9f8aa54b},
+     {0x09895e70, 0x9200b7ba, 0xddb7fb58, 0x3bd0c66f, 0x78eb4cbb, 0x2d97d108, 0xd84bde31, 0x2d431068}},
+    {{0xcb66e132, 0x5e5db46a, 0x0d925880, 0xf1be963a, 0x0317b9e2, 0x944a7027, 0x48603d48, 0xe266f959},
+     {0x5c208899, 0x98db6673, 0xa2fb18a3, 0x90472447, 0x777c619f, 0x8a966939, 0x2a3be21b, 0x3798142a}},
+    {{0x6755ff89, 0xe2f73c69, 0x473017e6, 0xdd3cf7e7, 0x3cf7600d, 0x8ef5689d, 0xb1fc87b4, 0x948dc4f8},
+     {0x4ea53299, 0xd9e9fe81, 0x98eb6028, 0x2d921ca2, 0x0c9803fc, 0xfaecedfd, 0x4d7b4745, 0xf38ae891}},
+    {{0x0f664534, 0x87151456, 0x4b68f103, 0x85ceae7c, 0x65578ab9, 0xac09c4ae, 0xf044b10c, 0x33ec6868},
+     {0x3a8ec1f1, 0x6ac4832b, 0x5847d5ef, 0x5509d128, 0x763f1574, 0xf909604f, 0xc32f63c4, 0xb16c4303}},
+    {{0xdec67ef5, 0xfd16847f, 0x233e76b7, 0x742ee464, 0xefc2b4c8, 0x0b8e4134, 0x42a3e521, 0xca640b86},
+     {0x8ceb6aa9, 0x653a0190, 0x547852d5, 0x313c300c, 0x6b237af7, 0x24e4ab12, 0x8bb47af8, 0x2ba90162}},
+    {{0x8cce08b5, 0x00467bc5, 0x7f178d55, 0xb636458c, 0xa677d806, 0xc5748bae, 0xdfa394eb, 0x2763a387},
+     {0x7d3cebb6, 0xa12b448a, 0x6f20d850, 0xe7adda3e, 0x1558462c, 0xf63ebce5, 0x620088a8, 0x58b36143}},
+    {{0xa059c142, 0xa9d89488, 0xff0b9346, 0x6f5ae714, 0x16fb3664, 0x068f237d, 0x363186ac, 0x5853e4c4},
+     {0x63c52f98, 0xe2d87d23, 0x81828876, 0x2ec4a766, 0xe14e7b1c, 0x47b864fa, 0x69192408, 0x0c0bc0e5}},
+    {{0x2ed22e91, 0x624d6049, 0x6f072822, 0x6fdfe0b5, 0x39ce2271, 0xeeca1115, 0xdb01614f, 0x98100a4f},
+     {0xa35c628f, 0xb6b0daa2, 0xc87e9a47, 0xb6f94d2e, 0x1d57d9ce, 0xc6773259, 0x03884a7b, 0xf70bfeec}},
+    {{0x248a7d06, 0x4ff23ffd, 0x878873fa, 0x80c5bfb4, 0x05745981, 0xb7d9ad90, 0x3db01994, 0x179c85db},
+     {0x61a6966c, 0xba41b062, 0xeadce5a8, 0x4d82d052, 0xa5e6a318, 0x9e91cd3b, 0x95b2dda0, 0x47795f4f}},
+    {{0xd5cd79bf, 0x1ee426cc, 0x946c6e18, 0x0032940b, 0x57477f58, 0x1b1e8ae0, 0x6d823278, 0xe94f7d34},
+     {0x782ba21a, 0xc747cb96, 0xf72b33a5, 0xc5254469, 0xc7f80c81, 0x772ef6de, 0x2cd9e6b5, 0xd73acbfe}},
+    {{0xcaa76097, 0x283c7513, 0x36c83906, 0x0a624fa9, 0x715af2c7, 0x6b20afec, 0xeba78bfd, 0x4b969974},
+     {0xd921d60e, 0x220755cc, 0x7baeca13, 0x9b944e10, 0x5ded93d4, 0x04819d51, 0x6dddfd27, 0x9bbff86e}},
+    {{0x1ff6acd3, 0x21950b42, 0x53dc6909, 0xffe70484, 0x28766127, 0xff4cd0b2, 0x4fb7db2b, 0xabdbe608},
+     {0x5e1109e8, 0x837c9228, 0xf4645b5a, 0x26147d27, 0xf7818ed8, 0x4d78f592, 0xf247fa36, 0xd394077e}},
+    {{0x3b3f64c9, 0x508cec1c, 0x1e5edf3f, 0xe20bc0ba, 0x2f4318d4, 0xda1deb85, 0x5c3fa443, 0xd20ebe0d},
+     {0x73241ea3, 0x370b4ea7, 0x5e1a5f65, 0x61f1511c, 0x82681c62, 0x99a5e23d, 0xa2f54c2d, 0xd731e383}},
+    {{0x546c4d8d, 0x97359638, 0x92f24679, 0x5f9c3fc4, 0xa8c8acd9, 0x912e8bed, 0x306634b0, 0xec3a318d},
+     {0xc31cb264, 0x80167f41, 0x522113f2, 0x3db82f6f, 0xdcafe197, 0xb155bcd2, 0x43465283, 0xfba1da59}},
+    {{0xe7305683, 0x258bbbf9, 0x07ef5be6, 0x31eea5bf, 0x46c814c1, 0x0deb0e4a, 0xa7b730dd, 0x5cee8449},
+     {0xa0182bde, 0xeab495c5, 0x9e27a6b4, 0xee759f87, 0x80e518ca, 0xc2cf6a68, 0xf14cf3f4, 0x25e8013f}},
+    {{0x7acaca28, 0x3ec832e7, 0xc7385b29, 0x1bfeea57, 0xfd1eaf38, 0x068212e3, 0x6acf8ccc, 0xc1329830},
+     {0x2aac9e59, 0xb909f2db, 0xb661782a, 0x5748060d, 0xc79b7a01, 0xc5ab2632, 0x00017626, 0xda44c6c6}},
+    {{0x5c46aa8e, 0x69d44ed6, 0xa8d063d1, 0x2100d5d3, 0xa2d17c36, 0xcb9727ea, 0x8add53b7, 0x4c2bab1b},
+     {0x15426704, 0xa084e90c, 0xa837ebea, 0x778afcd3, 0x7ce477f8, 0x6651f701, 0x46fb7a8b, 0xa0624998}},
+    {{0x7f4c04cc, 0x3667eb1a, 0xa9404f84, 0x59556621, 0x7eceb50a, 0x71cdf653, 0x9b8335fa, 0x994a44a6},
+     {0xdbeb9b69, 0xd7faf819, 0xeed4350d, 0x473c5680, 0xda44bba2, 0xb6658466, 0x872bdbf3, 0x0d1bc780}},
+    {{0x9ff91fe5, 0xb8d3d931, 0xf0518eed, 0x039c4800, 0x9182cb26, 0x95c37632, 0x82fc568d, 0x0763a434},
+     {0x383e76ba, 0x707c04d5, 0x824e8197, 0xac98b930, 0x91230de0, 0x92bf7c8f, 0x40959b70, 0x90876a01}},
+};
 #endif /* CASPER_ECC_P256 */
 
 #if CASPER_ECC_P384
@@ -344,6 +427,138 @@ static uint32_t NISTr384[NUM_LIMBS] = {0x00000001, 0xffffffff, 0xffffffff, 0x000
 
 // -p^-1 mod 2^64 = 0x100000001
 static uint32_t Np[2] = {1, 1};
+
+/* Odd multiples G, 3G, ..., 63G of the base point, affine in Montgomery form, for the fixed-base window. */
+static const uint32_t NISTp384_G[CASPER_G_TABLE_SIZE][2][NUM_LIMBS] = {
+    {{0x49c0b528, 0x3dd07566, 0xa0d6ce38, 0x20e378e2, 0x541b4d6e, 0x879c3afc,
+      0x59a30eff, 0x64548684, 0x614ede2b, 0x812ff723, 0x299e1513, 0x4d3aadc2},
+     {0x4b03a4fe, 0x23043dad, 0x7bb4a9ac, 0xa1bfa8bf, 0x2e83b050, 0x8bade756,
+      0x68f4ffd9, 0xc6c35219, 0x3969a840, 0xdd800226, 0x5a15c5e9, 0x2b78abc2}},
+    {{0xc1dc4073, 0x05e4dbe6, 0xf04f779c, 0xc54ea9ff, 0xa170ccf0, 0x6b2034e9,
+      0xd51c6c3e, 0x3a48d732, 0x263aa470, 0xe36f7e2d, 0xe7c1c3ac, 0xd283fe68},
+     {0xc04ee157, 0x7e284821, 0x7ae0e36d, 0x92d789a7, 0x4ef67446, 0x132663c0,
+      0xd2e1d0b4, 0x68012d5a, 0x5102b339, 0xf6db68b1, 0x983292af, 0x465465fc}},
+    {{0x68f1f0df, 0xbb595eba, 0xcc873466, 0xc185c0cb, 0x293c703b, 0x7f1eb1b5,
+      0xaacc05e6, 0x60db2cf5, 0xe2e8e4c6, 0xc676b987, 0x1d178ffb, 0xe1bb26b1},
+     {0x7073fa21, 0x2b694ba0, 0x72f34566, 0x22c16e2e, 0x01c35b99, 0x80b61b31,
+      0x982c0411, 0x4b237faf, 0x24de236d, 0xe6c59440, 0xe209e4a3, 0x4db1c9d6}},
+    {{0x7d69222b, 0xdf13b9d1, 0x874774b1, 0x4ce6415f, 0x211faa95, 0x731edcf8,
+      0x659753ed, 0x5f4215d1, 0x9db2df55, 0xf893db58, 0x1c89025b, 0x932c9f81},
+     {0x7706a61e, 0x0996b220, 0xa8641c79, 0x135349d5, 0x50130844, 0x65aad76f,
+      0x01fff780, 0x0ff37c04, 0x693b0706, 0xf57f238e, 0xaf6c9b3e, 0xd90a16b6}},
+    {{0x2353b92f, 0x2f5d200e, 0x3fd7e4f9, 0xe35d8729, 0xa96d745d, 0x26094833,
+      0x3cbfff3f, 0xdc351dc1, 0xdad54d6a, 0x26d464c6, 0x53636c6a, 0x5cab1d1d},
+     {0xb18ec0b0, 0xf2813072, 0xd742aa2f, 0x3777e270, 0x033ca7c2, 0x27f061c7,
+      0x68ead0d8, 0xa6ecaccc, 0xee69a754, 0x7d9429f4, 0x31e8f5c6, 0xe7706334}},
+    {{0xb68b8c7d, 0xc7708b19, 0x44377aba, 0x4532077c, 0x6cdad64f, 0x0dcc6770,
+      0x147b6602, 0x01b8bf56, 0xf0561d79, 0xf8d89885, 0x7ba9c437, 0x9c19e9fc},
+     {0xbdc4ba25, 0x764eb146, 0xac144b83, 0x604fe46b, 0x8a77e780, 0x3ce81329,
+      0xfe9e682e, 0x2e070f36, 0x3a53287a, 0x41821d0c, 0x3533f918, 0x9aa62f9f}},
+    {{0x75ccbdfb, 0x9b7aeb7e, 0xf6749a95, 0xb25e28c5, 0x33b7d4ae, 0x8a7a8e46,
+      0xd9c1bd56, 0xdb5203a8, 0xed22df97, 0xd2657265, 0x8cf23c94, 0xb51c56e1},
+     {0x6c3d812d, 0xf4d39459, 0x87cae0c2, 0xd8e88f1a, 0xcf4d0fe3, 0x789a2a48,
+      0xfec38d60, 0xb7feac2d, 0x3b490ec3, 0x81fdbd1c, 0xcc6979e1, 0x4617adb7}},
+    {{0x4709f4a9, 0x446ad888, 0xec3dabd8, 0x2b7210e2, 0x50e07b34, 0x83ccf195,
+      0x789b3075, 0x59500917, 0xeb085993, 0x0fc01fd4, 0x4903026b, 0xfb62d26f},
+     {0x6fe989bb, 0x2309cc9d, 0x144bd586, 0x61609cbd, 0xde06610c, 0x4b23d3a0,
+      0xd898f470, 0xdddc2866, 0x400c5797, 0x8733fc41, 0xd0bc2716, 0x5a68c6fe}},
+    {{0x4b4a3cd0, 0x8903e130, 0x8ff1f43e, 0x3ea4ea4c, 0xf655a10d, 0xe6fc3f2a,
+      0x524ffefc, 0x7be3737d, 0x5330455e, 0x9f692855, 0xe475ce70, 0x524f166e},
+     {0x6c12f055, 0x3fcc69cd, 0xd5b9c0da, 0x4e23b6ff, 0x336bf183, 0x49ce6993,
+      0x4a54504a, 0xf87d6d85, 0xb3c2677a, 0x25eb5df1, 0x55b164c9, 0xac37986f}},
+    {{0xbaa84c08, 0x82a2ed4a, 0x41a8c912, 0x22c4cc5f, 0x154aad5e, 0xca109c3b,
+      0xfc38538e, 0x23891298, 0x539802ae, 0xb3b6639c, 0x0390d706, 0xfa0f1f45},
+     {0xb0dc21d0, 0x46b78e5d, 0xc3da2eac, 0xa8c72d3c, 0x6ff2f643, 0x9170b378,
+      0xb67f30c3, 0x3f5a799b, 0x8264b672, 0x15d1dc77, 0xe9577764, 0xa1d47b23}},
+    {{0x0422ce2f, 0x08265e51, 0xdd2f9e21, 0x88e0d496, 0x6177f75d, 0x30128aa0,
+      0xbd9ebe69, 0x2e59ab62, 0x5df0e537, 0x1b1a0f6c, 0xdac012b5, 0xab16c626},
+     {0x008c5de7, 0x8014214b, 0x38f17bea, 0xaa740a9e, 0x8a149098, 0x262ebb49,
+      0x8527cd59, 0xb454111e, 0xacea5817, 0x266ad15a, 0x1353ccba, 0x21824f41}},
+    {{0x12e3683b, 0xd1b4e74d, 0x569b8ef6, 0x990ed20b, 0x429c0a18, 0xb9d3dd25,
+      0x2a351783, 0x1c75b8ab, 0x905432f0, 0x61e4ca2b, 0xeea8f224, 0x80826a69},
+     {0xec52abad, 0x7fc33a6b, 0xa65e4813, 0x0bcca3f0, 0xa527cebe, 0x7ad8a132,
+      0xeaf22c7e, 0xf0138950, 0x566718c1, 0x282d2437, 0xe2212559, 0x9dfccb0d}},
+    {{0x58ce3b83, 0x1e937227, 0x3cb3fb36, 0xbb280dfa, 0xe2be174a, 0x57d0f3d2,
+      0x208abe1e, 0x9bd51b99, 0xde248024, 0x3809ab50, 0xa5bb7331, 0xc29c6e2c},
+     {0x61124f05, 0x9944fd2e, 0x9009e391, 0x83ccbc4e, 0x9424a3cc, 0x01628f05,
+      0xea8e4344, 0xd6a2f51d, 0x4cebc96e, 0xda3e1a3d, 0xe97809dc, 0x1fe6fb42}},
+    {{0x467d66e4, 0xa04482d2, 0x4d78291d, 0xcf191293, 0x482396f9, 0x8e0d4168,
+      0xd18f14d0, 0x7228e2d5, 0x9c6a58fe, 0x2f7e8d50, 0x373e5aec, 0xe8ca780e},
+     {0x1b68e9f8, 0x42aad1d6, 0x69e2f8f4, 0x58a6d7f5, 0x31da1bea, 0xd779adfe,
+      0x38c85a85, 0x7d265406, 0xd44d3cdf, 0x67e67195, 0xc5134ed7, 0x17820a0b}},
+    {{0xd3021470, 0x019d6ac5, 0x780443d6, 0x25846b66, 0x55c97647, 0xce3c15ed,
+      0x0e3feb0f, 0x3dc22d49, 0xa7df26e4, 0x2065b7cb, 0x187cea1f, 0xc8b00ae8},
+     {0x865dded3, 0x1a5284a0, 0x20c83de2, 0x293c1649, 0xcce851b3, 0xab178d26,
+      0x404505fb, 0x8e6db10b, 0x90c82033, 0xf6f57e71, 0x5977f16c, 0x1d2a1c01}},
+    {{0x7c8906a4, 0xa39c8931, 0x9e821ee6, 0xb6e7ecdd, 0xf0df4fe6, 0x2ecf8340,
+      0x53c14965, 0xd42f7dc9, 0xe3ba8285, 0x1afb51a3, 0x0a3305d1, 0x6c07c404},
+     {0x127fc1da, 0xdab83288, 0x374c4b08, 0xbc0a699b, 0x42eb20dd, 0x402a9bab,
+      0x045a7a1c, 0xd7dd464f, 0x36beecc4, 0x5b3d0d6d, 0x6398a19d, 0x475a3e75}},
+    {{0x2fb3ba63, 0x61333a38, 0x5b943c86, 0xdf330d9d, 0x955ef3af, 0xbbc7c7ee,
+      0x60f09efb, 0xda631fc1, 0x41d5c400, 0x68af6226, 0x6c833e9d, 0xcc9e97a4},
+     {0x3a625e76, 0x7fd73e8e, 0xc209e55e, 0x13bf6124, 0x48b90b91, 0x08467cea,
+      0xbb6f0aba, 0x8a416eb9, 0xb8c31072, 0x6fcc93a1, 0x9057dad7, 0xa7fd2b61}},
+    {{0x3720ec9b, 0x58a5b543, 0x2d7c2fb4, 0xbb3800d5, 0xdde6bd0a, 0x4a508620,
+      0xa02583fd, 0x65f16273, 0x4fc78523, 0x832bd8e3, 0xe9417bc6, 0xd6149f75},
+     {0x3deeb52a, 0xfeb026e9, 0xa55e0956, 0x0ce18088, 0x988092a2, 0x50018998,
+      0x28f35eee, 0x22f19fab, 0x52ccd35c, 0xac8a877f, 0x30e23f26, 0xb13a8ad8}},
+    {{0xe44f61a3, 0x0202d57d, 0xb5630ef2, 0x4027704b, 0xf5b54a5d, 0xa129e2df,
+      0x97482b86, 0xacb60a75, 0x7ef27114, 0x9261ede8, 0xdefc58b5, 0x1eba28f3},
+     {0x8be5589e, 0x6c91c0c9, 0x14594bee, 0x2f1643d5, 0x5d2ca034, 0x2ea91243,
+      0x94047d1f, 0xb50649a8, 0x638ca337, 0x284fcbb5, 0xfe85bf85, 0xfa0e07b7}},
+    {{0x506e0e42, 0x7d894f80, 0x8e3d2c46, 0xd984244a, 0x2b7f006f, 0x6d7edf64,
+      0xde9b6230, 0x36a1cd6d, 0xb76c0665, 0xc9985040, 0xb89b1fc2, 0x587df4d6},
+     {0x6a71ae7a, 0x4c063847, 0xe8294747, 0x7b2b0ab3, 0xb53153b8, 0x345c553a,
+      0x436d9fe2, 0xb646e453, 0x1cd60340, 0x1a95355f, 0x074968fb, 0x2d7bc128}},
+    {{0xbca6d14c, 0xad148e87, 0x456a201e, 0x41dfd24d, 0xa80d68f3, 0x73a82933,
+      0x852ca035, 0x89746c8d, 0x95fd71ae, 0xe3bc7788, 0xda92245d, 0x8764cd2c},
+     {0x82eb23e2, 0xa2fe2c47, 0x0f3c9d6e, 0x5ac762e0, 0x21646f31, 0x57860ce1,
+      0x4f9f589a, 0xbdc9d6c3, 0xd193272e, 0x679952c7, 0xeb18f1c5, 0x82ea702e}},
+    {{0x00846d44, 0x37fa9355, 0x0578bc8c, 0x09112fc5, 0x39c4943d, 0xdad9f5b2,
+      0x416dbd86, 0x7314f5f0, 0x01fefb56, 0x5cf095a9, 0x22dab393, 0x35178bad},
+     {0x36baf1a7, 0xcf79fc1b, 0x749e5498, 0x1b7ee42d, 0xede314bb, 0xbce78aa9,
+      0xbd0628df, 0xaaf8e0f6, 0x15cbf948, 0xa974b094, 0xc9632b78, 0x8f3f1f63}},
+    {{0x4fddda5b, 0xd4c41156, 0x73ad9112, 0xd4af65c6, 0x39eb8f59, 0xffe8e0bb,
+      0x8d6fcf13, 0xb0040c0e, 0x1f2bb599, 0x99e1c0c6, 0xb2ac3405, 0x9c94c858},
+     {0x6eeed85d, 0x8f8878d7, 0x51fcca3f, 0x62b2f543, 0xe5b56918, 0xeb3b44a9,
+      0xb7234e93, 0x16f96676, 0xbd2af19e, 0x17477722, 0xdb83a485, 0x42eb2979}},
+    {{0xf0c668ca, 0x6f888f7d, 0x5f0dc66c, 0x65c78878, 0x5f5b07a0, 0xbfb18512,
+      0xd878acd0, 0x780abff7, 0x570cf950, 0x504f21b1, 0xda233371, 0xea5b37c5},
+     {0x22437ed1, 0x487ae8bd, 0x249cf9b7, 0x9c701758, 0x98fb34ff, 0xf86562a8,
+      0x65e0fc91, 0xdfeea1a2, 0x2e20fc23, 0xeef00691, 0xdfa72a8b, 0xac9dfec7}},
+    {{0x697136c6, 0xfa5c3aef, 0xa5ea6fb8, 0x8ea5af63, 0x42e365a4, 0xa6691565,
+      0x5b6e3386, 0x47c56c11, 0xcea03f56, 0x1197832b, 0x50e4ea9e, 0x0b470bb2},
+     {0x13b25712, 0x3113c743, 0xd2497d48, 0x8d6c174e, 0x49c9ebe8, 0xfc4486ee,
+      0x7f82bdd3, 0x2487edd5, 0x5b57be2f, 0x771e6441, 0xe28b2bdb, 0x2d1cc518}},
+    {{0x2070ac8d, 0x2c4ccac7, 0xec4a22b8, 0x1947c0ca, 0x8c5a78d9, 0xa5e0fb59,
+      0x41a84de7, 0x464ae8d2, 0xdaaabc27, 0x3dba16e9, 0x4f35cb3c, 0x16634a50},
+     {0xb16ec84f, 0xadc18bf9, 0x7359dd35, 0x324d067e, 0x570543f0, 0xdaeac0c3,
+      0x3c887d36, 0x0b224000, 0x373f1a0d, 0xc69489e2, 0xcbaa0d97, 0x518b047d}},
+    {{0xfbde49ef, 0x3b1bddc6, 0x8a0915cc, 0xdaed7c26, 0x0f0422a2, 0x0b011061,
+      0xa7c54b16, 0xcf485c74, 0x15c3aae2, 0x642ec4e6, 0xe0f383ea, 0xa8ba8f10},
+     {0x95618501, 0x2a2054b4, 0x089efa8b, 0xebec6442, 0x4e2fa83e, 0x5786a19a,
+      0x39069963, 0xd2c71ad1, 0x481765e2, 0xadc93d9a, 0x7ecc9485, 0xedf2e3eb}},
+    {{0x069f3367, 0xbcab5f60, 0x1718ec3c, 0xfd6622bc, 0xe3a142d6, 0xa4fb7867,
+      0x085faeb3, 0x6078d8bf, 0x60f4554f, 0xfa5cbfda, 0x690cd408, 0xb3fcd5d1},
+     {0x281f7884, 0x4ebdee7d, 0x180a63a7, 0x82af23aa, 0x3d079f61, 0x8de3107c,
+      0xbe2334f8, 0x17c6b5cb, 0x97d0fa06, 0x6a91e739, 0x14ceeed4, 0x74602573}},
+    {{0xf97f865c, 0xb14ba61c, 0x694b8b0d, 0x73bae4c1, 0xac4bbf62, 0xa14967df,
+      0x9bf446e0, 0x1e9dd150, 0x1c99ceef, 0xc052f3eb, 0x7a78c189, 0x814d7fa0},
+     {0xab74b05d, 0xa101a483, 0xa1737b65, 0x7788c258, 0xe809a13c, 0x0d60bab7,
+      0x73c81d5b, 0x8f427bc4, 0x2952c1fc, 0xd2e13055, 0x4b26df63, 0x0a823b9a}},
+    {{0x27bf64c9, 0xaf467ce2, 0xf929974c, 0xdfca6897, 0x5c322738, 0x64473b59,
+      0x1ed0e315, 0x96a917cf, 0x0de64db9, 0x3703435b, 0x9267b646, 0x9ba03967},
+     {0x3a522fbe, 0xdf0c2aae, 0xb335eff0, 0x41bdb741, 0x7b059703, 0xaccf2edd,
+      0x28463cce, 0x6fb34b30, 0xd9e3ca19, 0x96d9ba0b, 0x504655c1, 0xff336f12}},
+    {{0xfc60a6e0, 0x48da1fd3, 0x222241e8, 0x54fb5a34, 0x772ae080, 0x6035e34f,
+      0x332982d0, 0x5ff77ff2, 0x00fe51fd, 0x23664673, 0xef6ba006, 0xc93ea049},
+     {0x7d381266, 0x6640f117, 0x6ae9f4ac, 0x394d32cd, 0x70d303eb, 0xe6a78853,
+      0xe5275767, 0x0dda19ff, 0x01466d23, 0xb0a6c772, 0x1fc69829, 0xc4cc1145}},
+    {{0xaaed89c0, 0xc5c0e6d7, 0x149a1896, 0x6ce8ead6, 0x8c949f8f, 0x7a50f745,
+      0x6e2b71aa, 0xcd7e35f7, 0x9a049f7a, 0xf6159e51, 0xf1e52d1e, 0x1c9bf0b0},
+     {0x18202c80, 0x3bb6c1f5, 0x1ecd7b1a, 0x8d3a5f62, 0x88d17f19, 0x3bb034e8,
+      0x97d4048d, 0xdc89bd49, 0x3735df22, 0xf5af7b8e, 0xa0a689e8, 0x52bb3712}},
+};
 #endif /* CASPER_ECC_P384 */
 
 /*******************************************************************************
@@ -378,7 +593,9 @@ void Jac_addition(uint32_t *X3,
 
 /* Compute (X3 : Y3: Z3) = (X1: Y1: Z1) + (X2, Y2)
  * where (X1: Y1: Z1) != (X2, Y2)
- * (X3 : Y3: Z3) may not overlap with (X1: Y1: Z1).
+ * (X3 : Y3: Z3) may be the same as (X1: Y1: Z1), each input coordinate is read
+ * for the last time before the output coordinate is written.
+ * (X3 : Y3: Z3) may not partially overlap with (X1: Y1: Z1) or overlap (X2, Y2).
  * Source: 2004 HankersonMenezesVanstone, page 91.
  */
 void Jac_add_affine(
@@ -392,7 +609,7 @@ void Jac_double(uint32_t *X3, uint32_t *Y3, uint32_t *Z3, uint32_t *X1, uint32_t
 
 /* Constant time elliptic curve scalar multiplication.
  * Source: https://eprint.iacr.org/2014/130.pdf
- * when using w = 4.
+ * when using w = 5.
  * Computes (X3 : Y3 : Z3) = k * (X1, Y1) \in E(F_p)
  * p is the prime used to define the finite field F_p
  * q is the (prime) order of the curve
@@ -402,7 +619,8 @@ void Jac_scalar_multiplication(
 
 /* Compute the double scalar multiplication
 * (X3 : Y3 : Z3) = k1 * (X1, Y1) + k2 * (X2, Y2)
-* Using Shamir's trick and precomputing 16 points.
+* Using interleaved wNAF with the flash table of G if one of the points is
+* the base point G, otherwise using Shamir's trick and precomputing 16 points.
 * This code is *not* constant time since this is used
 * for verification only.
 */
@@ -1702,7 +1920,9 @@ void Jac_addition(uint32_t *X3,
 
 /* Compute (X3 : Y3: Z3) = (X1: Y1: Z1) + (X2, Y2)
  * where (X1: Y1: Z1) != (X2, Y2)
- * (X3 : Y3: Z3) may not overlap with (X1: Y1: Z1).
+ * (X3 : Y3: Z3) may be the same as (X1: Y1: Z1), each input coordinate is read
+ * for the last time before the output coordinate is written.
+ * (X3 : Y3: Z3) may not partially overlap with (X1: Y1: Z1) or overlap (X2, Y2).
  * Source: 2004 HankersonMenezesVanstone, page 91.
  */
 void Jac_add_affine(
@@ -1894,7 +2114,7 @@ static uint8_t int8abs(int8_t v)
 
 /* Constant time elliptic curve scalar multiplication.
  * Source: https://eprint.iacr.org/2014/130.pdf
- * when using w = 4.
+ * when using w = 5.
  * Computes (X3 : Y3 : Z3) = k * (X1, Y1) \in E(F_p)
  * p is the prime used to define the finite field F_p
  * q is the (prime) order of the curve
@@ -1910,11 +2130,11 @@ void Jac_scalar_multiplication(
     /* Point to the start of the LUT table space. */
     mem = &CASPER_MEM[LUT_SCRATCH_START];
 
-    scalar = &CASPER_MEM[LUT_SCRATCH_START + 12 * CASPER_NUM_LIMBS];
-    X = &CASPER_MEM[LUT_SCRATCH_START + 13 * CASPER_NUM_LIMBS];
-    Y = &CASPER_MEM[LUT_SCRATCH_START + 14 * CASPER_NUM_LIMBS];
-    Z = &CASPER_MEM[LUT_SCRATCH_START + 15 * CASPER_NUM_LIMBS];
-    M = &CASPER_MEM[LUT_SCRATCH_START + 16 * CASPER_NUM_LIMBS];
+    scalar = &CASPER_MEM[LUT_SCRATCH_START + 24 * CASPER_NUM_LIMBS];
+    X = &CASPER_MEM[LUT_SCRATCH_START + 25 * CASPER_NUM_LIMBS];
+    Y = &CASPER_MEM[LUT_SCRATCH_START + 26 * CASPER_NUM_LIMBS];
+    Z = &CASPER_MEM[LUT_SCRATCH_START + 27 * CASPER_NUM_LIMBS];
+    M = &CASPER_MEM[LUT_SCRATCH_START + 28 * CASPER_NUM_LIMBS];
 
     /* Point to memory the recoded scalar.
      * CASPER_RECODE_LENGTH bytes is needed.
@@ -1924,7 +2144,7 @@ void Jac_scalar_multiplication(
 
     CASPER_MEMCPY(scalar, k, sizeof(uint32_t) * NUM_LIMBS);
 
-/* Precomputation: compute 1*P, 3*P, 5*P, and 7*P */
+/* Precomputation: compute 1*P, 3*P, 5*P, ..., 15*P */
 #define LUT(P, x) (mem + (3 * ((P)-1) / 2 + (x)) * CASPER_NUM_LIMBS)
 
     /* Set 1*P */
@@ -1939,21 +2159,21 @@ void Jac_scalar_multiplication(
     /* Compute 3*P = 2P + P */
     Jac_add_affine(LUT(3, 0), LUT(3, 1), LUT(3, 2), X3, Y3, Z3, X1, Y1);
 
-    /* Compute 5*P = 3P + 2P */
-    Jac_addition(LUT(5, 0), LUT(5, 1), LUT(5, 2), LUT(3, 0), LUT(3, 1), LUT(3, 2), X3, Y3, Z3);
-
-    /* Compute 7*P = 5P + 2P */
-    Jac_addition(LUT(7, 0), LUT(7, 1), LUT(7, 2), LUT(5, 0), LUT(5, 1), LUT(5, 2), X3, Y3, Z3);
+    /* Compute (i + 2)*P = i*P + 2P */
+    for (i = 5; i < (1 << (CASPER_RECODE_WINDOW - 1)); i += 2)
+    {
+        Jac_addition(LUT(i, 0), LUT(i, 1), LUT(i, 2), LUT(i - 2, 0), LUT(i - 2, 1), LUT(i - 2, 2), X3, Y3, Z3);
+    }
 
     /* Recode the scalar */
     odd = casper_get_word(&scalar[0]) & 1u;
     sub_n(M, q, scalar, NUM_LIMBS); // todo!!!
     casper_select(scalar, M, scalar, odd, NUM_LIMBS);
 
-    /* Use n=384 and w=4 --> compute ciel(384/3) = 128 + 1 digits */
+    /* Use w=5 --> compute ciel(N_bitlen/4) + 1 digits */
     uint32_t scalarSysram[/*CASPER_*/ NUM_LIMBS];
     CASPER_MEMCPY(scalarSysram, scalar, /*CASPER_*/ NUM_LIMBS * sizeof(uint32_t));
-    recode(rec, scalarSysram, N_bitlen, 4);
+    recode(rec, scalarSysram, N_bitlen, CASPER_RECODE_WINDOW);
 
     /* Set the first value. */
     index = int8abs(rec[CASPER_RECODE_LENGTH - 1]);
@@ -1966,25 +2186,20 @@ void Jac_scalar_multiplication(
  * all elements and masking out the correct one.
  */
 
-#define GET_LUT(x, y, z, index)                       \
-    do                                                \
-    {                                                 \
-        int m;                                        \
-        copy(x, LUT(1, 0));                           \
-        copy(y, LUT(1, 1));                           \
-        copy(z, LUT(1, 2));                           \
-        m = (index == 3);                             \
-        casper_select(x, x, LUT(3, 0), m, NUM_LIMBS); \
-        casper_select(y, y, LUT(3, 1), m, NUM_LIMBS); \
-        casper_select(z, z, LUT(3, 2), m, NUM_LIMBS); \
-        m = (index == 5);                             \
-        casper_select(x, x, LUT(5, 0), m, NUM_LIMBS); \
-        casper_select(y, y, LUT(5, 1), m, NUM_LIMBS); \
-        casper_select(z, z, LUT(5, 2), m, NUM_LIMBS); \
-        m = (index == 7);                             \
-        casper_select(x, x, LUT(7, 0), m, NUM_LIMBS); \
-        casper_select(y, y, LUT(7, 1), m, NUM_LIMBS); \
-        casper_select(z, z, LUT(7, 2), m, NUM_LIMBS); \
+#define GET_LUT(x, y, z, index)                                    \
+    do                                                             \
+    {                                                              \
+        int m, j;                                                  \
+        copy(x, LUT(1, 0));                                        \
+        copy(y, LUT(1, 1));                                        \
+        copy(z, LUT(1, 2));                                        \
+        for (j = 3; j < (1 << (CASPER_RECODE_WINDOW - 1)); j += 2) \
+        {                                                          \
+            m = (index == j);                                      \
+            casper_select(x, x, LUT(j, 0), m, NUM_LIMBS);          \
+            casper_select(y, y, LUT(j, 1), m, NUM_LIMBS);          \
+            casper_select(z, z, LUT(j, 2), m, NUM_LIMBS);          \
+        }                                                          \
     } while (0)
 
     GET_LUT(X3, Y3, Z3, index);
@@ -1998,6 +2213,7 @@ void Jac_scalar_multiplication(
         Jac_double(X3, Y3, Z3, X3, Y3, Z3);
         Jac_double(X3, Y3, Z3, X3, Y3, Z3);
         Jac_double(X3, Y3, Z3, X3, Y3, Z3);
+        Jac_double(X3, Y3, Z3, X3, Y3, Z3);
 
         index = int8abs(rec[i]);
         sign = ((uint8_t)rec[i]) >> 7;
@@ -2016,9 +2232,148 @@ void Jac_scalar_multiplication(
     casper_select(Y3, M, Y3, odd, NUM_LIMBS);
 }
 
-#undef LUT
 #undef GET_LUT
 
+/* Width-w NAF of the n-bit integer k into n + 1 digits, least significant first.
+ * Each digit is 0 or odd in { +/- 1, +/- 3, ..., +/- 2^(w-1)-1 }, and at most one
+ * of any w consecutive digits is non-zero.
+ * Return the index of the most significant non-zero digit, or -1 if k is zero.
+ */
+static int wnaf(int8_t *c, uint32_t *k, int n, int w)
+{
+    int i, j, top = -1;
+    int32_t d;
+    uint32_t K[NUM_LIMBS + 1];
+
+    CASPER_MEMCPY(K, k, NUM_LIMBS * sizeof(uint32_t));
+    K[NUM_LIMBS] = 0;
+    for (i = 0; i <= n; i++)
+    {
+        d = 0;
+        if ((K[0] & 1u) != 0u)
+        {
+            /* Clear the w lowest bits of k with the signed digit. */
+            d = (int32_t)(K[0] & ((1u << w) - 1u));
+            if (d >= (1 << (w - 1)))
+            {
+                d -= (1 << w);
+                add_n_1(K, K, (uint32_t)(-d), NUM_LIMBS + 1);
+            }
+            else
+            {
+                K[0] -= (uint32_t)d;
+            }
+            top = i;
+        }
+        c[i] = (int8_t)d;
+
+        for (j = 0; j < NUM_LIMBS; j++)
+        {
+            K[j] = (K[j + 1] << 31) | (K[j] >> 1);
+        }
+        K[NUM_LIMBS] >>= 1;
+    }
+
+    return top;
+}
+
+/* Return 1 if (X1, Y1) in Montgomery form is the base point G, and return 0 otherwise. */
+static int casper_is_base_point(uint32_t *X1, uint32_t *Y1)
+{
+    uint32_t d = 0;
+    int i;
+
+    for (i = 0; i < NUM_LIMBS; i++)
+    {
+        d |= (casper_get_word(&X1[i]) ^ G_TABLE[0][0][i]) | (casper_get_word(&Y1[i]) ^ G_TABLE[0][1][i]);
+    }
+
+    return (d == 0U);
+}
+
+/* Compute the double scalar multiplication
+ * (X3 : Y3 : Z3) = k1 * G + k2 * (X2, Y2)
+ * where G is the base point. The wNAF digits of k1 and k2 are interleaved so that
+ * the doublings are shared. The odd multiples of G are read from the flash table
+ * G_TABLE as affine points, only 1*Q, 3*Q, ..., 15*Q of Q = (X2, Y2) are computed.
+ * The LUT entries are CASPER_NUM_LIMBS apart and are added in place.
+ * This code is *not* constant time since this is used
+ * for verification only.
+ */
+static void double_scalar_multiplication_G(
+    uint32_t *X3, uint32_t *Y3, uint32_t *Z3, uint32_t *k1, uint32_t *X2, uint32_t *Y2, uint32_t *k2)
+{
+    uint32_t *mem, *Gx, *Gy, *Ty;
+    uint32_t zeroes[NUM_LIMBS] = {0};
+    int8_t naf1[N_bitlen + 1];
+    int8_t naf2[N_bitlen + 1];
+    int i, index, top;
+
+    mem = &CASPER_MEM[LUT_SCRATCH_START];
+    Gx = &CASPER_MEM[LUT_SCRATCH_START + (3 * CASPER_Q_TABLE_SIZE + 0) * CASPER_NUM_LIMBS];
+    Gy = &CASPER_MEM[LUT_SCRATCH_START + (3 * CASPER_Q_TABLE_SIZE + 1) * CASPER_NUM_LIMBS];
+    Ty = &CASPER_MEM[LUT_SCRATCH_START + (3 * CASPER_Q_TABLE_SIZE + 2) * CASPER_NUM_LIMBS];
+
+    /* Precomputation: compute 1*Q, 3*Q, ..., 15*Q, 2*Q is kept in (X3 : Y3 : Z3). */
+    copy(LUT(1, 0), X2);
+    copy(LUT(1, 1), Y2);
+    copy(LUT(1, 2), ONE);
+    Jac_double(X3, Y3, Z3, X2, Y2, LUT(1, 2));
+    Jac_add_affine(LUT(3, 0), LUT(3, 1), LUT(3, 2), X3, Y3, Z3, X2, Y2);
+    for (i = 5; i < (1 << (CASPER_Q_WINDOW - 1)); i += 2)
+    {
+        Jac_addition(LUT(i, 0), LUT(i, 1), LUT(i, 2), LUT(i - 2, 0), LUT(i - 2, 1), LUT(i - 2, 2), X3, Y3, Z3);
+    }
+
+    top = wnaf(naf1, k1, N_bitlen, CASPER_G_WINDOW);
+    i = wnaf(naf2, k2, N_bitlen, CASPER_Q_WINDOW);
+    if (i > top)
+    {
+        top = i;
+    }
+
+    /* Start from the point at infinity, the first addition copies the point. */
+    copy(X3, zeroes);
+    copy(Y3, zeroes);
+    copy(Z3, zeroes);
+
+    for (i = top; i >= 0; i--)
+    {
+        if (i < top)
+        {
+            Jac_double(X3, Y3, Z3, X3, Y3, Z3);
+        }
+
+        if (naf2[i] != 0)
+        {
+            index = int8abs(naf2[i]);
+            if (naf2[i] > 0)
+            {
+                Jac_addition(X3, Y3, Z3, X3, Y3, Z3, LUT(index, 0), LUT(index, 1), LUT(index, 2));
+            }
+            else
+            {
+                sub_n(Ty, PRIME, LUT(index, 1), NUM_LIMBS);
+                Jac_addition(X3, Y3, Z3, X3, Y3, Z3, LUT(index, 0), Ty, LUT(index, 2));
+            }
+        }
+
+        if (naf1[i] != 0)
+        {
+            index = int8abs(naf1[i]) / 2;
+            CASPER_MEMCPY(Gx, G_TABLE[index][0], NUM_LIMBS * sizeof(uint32_t));
+            CASPER_MEMCPY(Gy, G_TABLE[index][1], NUM_LIMBS * sizeof(uint32_t));
+            if (naf1[i] < 0)
+            {
+                sub_n(Gy, PRIME, Gy, NUM_LIMBS);
+            }
+            Jac_add_affine(X3, Y3, Z3, X3, Y3, Z3, Gx, Gy);
+        }
+    }
+}
+
+#undef LUT
+
 /*
  * Pre-compute the following 16 points:
  * 00 00 = 0*P + 0*Q  <-- Not needed when using sliding windows
@@ -2202,6 +2557,18 @@ void double_scalar_multiplication(uint32_t *X3,
     uint32_t index, c = 0;
     uint32_t *p1, *p2, x1, x2, *lut, *Tx, *Ty, *Tz;
 
+    /* The verification uses the base point for one of the points. */
+    if (casper_is_base_point(X1, Y1))
+    {
+        double_scalar_multiplication_G(X3, Y3, Z3, k1, X2, Y2, k2);
+        return;
+    }
+    if (casper_is_base_point(X2, Y2))
+    {
+        double_scalar_multiplication_G(X3, Y3, Z3, k2, X1, Y1, k1);
+        return;
+    }
+
     precompute_double_scalar_LUT(X1, Y1, X2, Y2);
 
     lut = &CASPER_MEM[LUT_SCRATCH_START];
@@ -23,9 +23,9 @@
  */
 /*! @name Driver version */
 /*@{*/
-/*! @brief CASPER driver version. Version 2.0.2.
+/*! @brief CASPER driver version. Version 2.0.3.
  *
- * Current version: 2.0.2
+ * Current version: 2.0.3
  *
  * Change log:
  * - Version 2.0.0
@@ -34,8 +34,11 @@
  *   - Bug fix KPSDK-24531 double_scalar_multiplication() result may be all zeroes for some specific input
  * - Version 2.0.2
  *   - Bug fix KPSDK-25015 CASPER_MEMCPY hard-fault on LPC55xx when both source and destination buffers are outside of CASPER_RAM
+ * - Version 2.0.3
+ *   - Use w=5 window for the constant time scalar multiplication
+ *   - Use interleaved wNAF with a precomputed flash table of the base point for the double scalar multiplication
  */
-#define FSL_CASPER_DRIVER_VERSION (MAKE_VERSION(2, 0, 2))
+#define FSL_CASPER_DRIVER_VERSION (MAKE_VERSION(2, 0, 3))
 /*@}*/
 
 /*! @brief CASPER operation
@@ -864,6 +864,125 @@ status_t HASHCRYPT_SHA_UpdateNonBlocking(HASHCRYPT_Type *base,
     return status;
 }
 
+/*!
+ * @brief Prepares the running hash for DMA input.
+ *
+ * This function adds the message size to the context, completes the buffered block and processes
+ * it by CPU, and keeps the last incomplete block in the context for the padding. The full blocks
+ * left are returned in input and inputSize, and the HASHCRYPT requests the DMA to fill INDATA. The
+ * HASHCRYPT interrupt is enabled for this context, the ISR completes the hash after the DMA input.
+ *
+ * @param base HASHCRYPT peripheral base address.
+ * @param ctx Hash context.
+ * @param[in,out] input Input data, returns the full blocks to be written by DMA.
+ * @param[in,out] inputSize Size of input data in bytes, returns the size of the full blocks.
+ * @return kStatus_Success, or kStatus_InvalidArgument if the context is not valid.
+ */
+status_t hashcrypt_sha_dma_prepare(HASHCRYPT_Type *base,
+                                   hashcrypt_hash_ctx_t *ctx,
+                                   const uint8_t **input,
+                                   size_t *inputSize)
+{
+    hashcrypt_sha_ctx_internal_t *ctxInternal;
+    const uint8_t *message = *input;
+    size_t messageSize     = *inputSize;
+    size_t toCopy;
+    status_t status;
+
+    ctxInternal = (hashcrypt_sha_ctx_internal_t *)ctx;
+    status      = hashcrypt_sha_check_context(base, ctxInternal);
+    if (kStatus_Success != status)
+    {
+        return status;
+    }
+
+    ctxInternal->fullMessageSize += messageSize;
+    /* if we are still less than 64 bytes, keep only in context */
+    if ((ctxInternal->blksz + messageSize) <= SHA_BLOCK_SIZE)
+    {
+        hashcrypt_memcpy((&ctxInternal->blk.b[0]) + ctxInternal->blksz, message, messageSize);
+        ctxInternal->blksz += messageSize;
+        *inputSize = 0;
+        return kStatus_Success;
+    }
+
+    if (ctxInternal->state != kHASHCRYPT_HashUpdate)
+    {
+        /* start NEW hash */
+        hashcrypt_engine_init(base, ctxInternal->algo);
+        ctxInternal->state = kHASHCRYPT_HashUpdate;
+    }
+
+    /* first fill the internal buffer to full block */
+    if (ctxInternal->blksz)
+    {
+        toCopy = SHA_BLOCK_SIZE - ctxInternal->blksz;
+        hashcrypt_memcpy(&ctxInternal->blk.b[ctxInternal->blksz], message, toCopy);
+        message += toCopy;
+        messageSize -= toCopy;
+
+        /* process full internal block */
+        hashcrypt_sha_one_block(base, &ctxInternal->blk.b[0]);
+    }
+
+    /* poll waiting, the buffered block is consumed before the internal block is written again */
+    while (0 == (base->STATUS & HASHCRYPT_STATUS_WAITING_MASK))
+    {
+    }
+
+    /* copy last incomplete message bytes into internal block */
+    ctxInternal->blksz = messageSize % SHA_BLOCK_SIZE;
+    messageSize -= ctxInternal->blksz;
+    hashcrypt_memcpy(&ctxInternal->blk.b[0], message + messageSize, ctxInternal->blksz);
+
+    if (messageSize != 0u)
+    {
+        /* the ISR completes the hash of this context, then the DMA pushes the full blocks */
+        s_ctx = ctx;
+        EnableIRQ(HASHCRYPT_IRQn);
+        base->CTRL |= HASHCRYPT_CTRL_DMA_I_MASK;
+    }
+
+    *input     = message;
+    *inputSize = messageSize;
+    return kStatus_Success;
+}
+
+/*!
+ * @brief Completes the DMA input of the running hash.
+ *
+ * This function is called when the DMA has written the last block. It does not wait for the
+ * digest, the digest and error interrupts are enabled instead, and HASHCRYPT_DriverIRQHandler gives
+ * INDATA back to the CPU and invokes the callback set by HASHCRYPT_SHA_SetCallback(). When no block
+ * was written by DMA or the DMA input failed, the callback is invoked directly.
+ *
+ * @param base HASHCRYPT peripheral base address.
+ * @param ctx Hash context.
+ * @param status Status of the DMA input.
+ */
+void hashcrypt_sha_dma_complete(HASHCRYPT_Type *base, hashcrypt_hash_ctx_t *ctx, status_t status)
+{
+    hashcrypt_sha_ctx_internal_t *ctxInternal = (hashcrypt_sha_ctx_internal_t *)ctx;
+
+    if (0 != (base->CTRL & HASHCRYPT_CTRL_DMA_I_MASK))
+    {
+        if (kStatus_Success == status)
+        {
+            /* the ISR completes the hash when the digest of the last block is ready */
+            ctxInternal->remainingBlcks = 0;
+            base->INTENSET              = HASHCRYPT_INTENCLR_DIGEST_MASK | HASHCRYPT_INTENCLR_ERROR_MASK;
+            return;
+        }
+        base->CTRL &= ~HASHCRYPT_CTRL_DMA_I_MASK;
+    }
+
+    /* Invoke callback if there is one */
+    if (NULL != ctxInternal->hashCallback)
+    {
+        ctxInternal->hashCallback(base, ctx, status, ctxInternal->userData);
+    }
+}
+
 status_t HASHCRYPT_AES_SetKey(HASHCRYPT_Type *base, hashcrypt_handle_t *handle, const uint8_t *key, size_t keySize)
 {
     status_t retVal = kStatus_InvalidArgument;
@@ -1159,13 +1278,16 @@ void HASHCRYPT_DriverIRQHandler(void)
             base->MEMCTRL = HASHCRYPT_MEMCTRL_MASTER(1) | HASHCRYPT_MEMCTRL_COUNT(numBlocks);
             return;
         }
-        /* no full blocks left, disable interrupts and AHB master mode */
+        /* no full blocks left, disable interrupts, AHB master mode and DMA input */
         base->INTENCLR = HASHCRYPT_INTENCLR_DIGEST_MASK | HASHCRYPT_INTENCLR_ERROR_MASK;
         base->MEMCTRL  = HASHCRYPT_MEMCTRL_MASTER(0);
-        status         = kStatus_Success;
+        base->CTRL &= ~HASHCRYPT_CTRL_DMA_I_MASK;
+        status = kStatus_Success;
     }
     else
     {
+        base->INTENCLR = HASHCRYPT_INTENCLR_DIGEST_MASK | HASHCRYPT_INTENCLR_ERROR_MASK;
+        base->CTRL &= ~HASHCRYPT_CTRL_DMA_I_MASK;
         status = kStatus_Fail;
     }
 
@@ -26,9 +26,9 @@ enum _hashcrypt_status
  */
 /*! @name Driver version */
 /*@{*/
-/*! @brief HASHCRYPT driver version. Version 2.1.0.
+/*! @brief HASHCRYPT driver version. Version 2.1.1.
  *
- * Current version: 2.1.0
+ * Current version: 2.1.1
  *
  * Change log:
  * - Version 2.0.0
@@ -41,8 +41,10 @@ enum _hashcrypt_status
  *   - Remove SHA512 and AES ICB algorithm definitions
  * - Version 2.1.0
  *   - Update the register name and macro to align with new header.
+ * - Version 2.1.1
+ *   - Add SHA update with the INDATA filled by DMA, see fsl_hashcrypt_dma.h.
  */
-#define FSL_HASHCRYPT_DRIVER_VERSION (MAKE_VERSION(2, 1, 0))
+#define FSL_HASHCRYPT_DRIVER_VERSION (MAKE_VERSION(2, 1, 1))
 /*@}*/
 
 /*! @brief Algorithm definitions correspond with the values for Mode field in Control register !*/
@@ -425,6 +427,13 @@ status_t HASHCRYPT_SHA_UpdateNonBlocking(HASHCRYPT_Type *base,
  *@}
  */ /* end of hashcrypt_background_driver_hash */
 
+/* Internal functions used by the HASHCRYPT DMA driver. */
+extern status_t hashcrypt_sha_dma_prepare(HASHCRYPT_Type *base,
+                                          hashcrypt_hash_ctx_t *ctx,
+                                          const uint8_t **input,
+                                          size_t *inputSize);
+extern void hashcrypt_sha_dma_complete(HASHCRYPT_Type *base, hashcrypt_hash_ctx_t *ctx, status_t status);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,240 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_hashcrypt_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.hashcrypt_dma"
+#endif
+
+/*! @brief Maximum bytes of one DMA transfer of words. */
+#define HASHCRYPT_DMA_MAX_TRANSFER_BYTES (DMA_MAX_TRANSFER_COUNT * sizeof(uint32_t))
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*!
+ * @brief Takes the next chunk of the input for the DMA.
+ *
+ * The chunk is taken from the input when it is 4 bytes aligned, or copied to the buffer not in
+ * use by the DMA when it is not.
+ *
+ * @param handle Pointer to hashcrypt_dma_handle_t structure.
+ */
+static void HASHCRYPT_SHA_PrepareChunkDMA(hashcrypt_dma_handle_t *handle);
+
+/*!
+ * @brief Starts the DMA transfer of one chunk to the HASHCRYPT INDATA register.
+ *
+ * @param handle Pointer to hashcrypt_dma_handle_t structure.
+ * @param chunk 4 bytes aligned chunk.
+ * @param chunkSize Size of the chunk in bytes, a multiple of the SHA block size.
+ */
+static void HASHCRYPT_SHA_StartChunkDMA(hashcrypt_dma_handle_t *handle, const uint8_t *chunk, size_t chunkSize);
+
+/*!
+ * @brief HASHCRYPT DMA transfer finished callback function.
+ *
+ * This function is called when the DMA transfer of a chunk finished. It starts the next chunk and
+ * prepares the one after it, or completes the hash update when all chunks are transferred. A failed
+ * transfer completes the hash update with kStatus_Fail.
+ *
+ * @param handle The DMA handle.
+ * @param param Callback function parameter.
+ */
+static void HASHCRYPT_SHA_DMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void HASHCRYPT_SHA_PrepareChunkDMA(hashcrypt_dma_handle_t *handle)
+{
+    size_t chunkSize;
+
+    if (0U == ((uint32_t)handle->data & 3U))
+    {
+        chunkSize         = MIN(handle->dataSize, HASHCRYPT_DMA_MAX_TRANSFER_BYTES);
+        handle->nextChunk = handle->data;
+    }
+    else
+    {
+        chunkSize = MIN(handle->dataSize, HASHCRYPT_SHA_DMA_BUFFER_SIZE);
+        (void)memcpy(handle->buffer[handle->bufferIndex], handle->data, chunkSize);
+        handle->nextChunk   = (const uint8_t *)handle->buffer[handle->bufferIndex];
+        handle->bufferIndex = handle->bufferIndex ^ 1U;
+    }
+
+    handle->nextChunkSize = chunkSize;
+    handle->data += chunkSize;
+    handle->dataSize -= chunkSize;
+}
+
+static void HASHCRYPT_SHA_StartChunkDMA(hashcrypt_dma_handle_t *handle, const uint8_t *chunk, size_t chunkSize)
+{
+    dma_transfer_config_t xferConfig;
+
+    /* The destination is the INDATA register, the DMA request is raised while the HASHCRYPT waits for data. */
+    DMA_PrepareTransfer(&xferConfig, (void *)(uint32_t)chunk, (void *)(uint32_t)&handle->base->INDATA,
+                        sizeof(uint32_t), chunkSize, kDMA_MemoryToPeripheral, NULL);
+    (void)DMA_SubmitTransfer(handle->dmaHandle, &xferConfig);
+    DMA_StartTransfer(handle->dmaHandle);
+}
+
+static void HASHCRYPT_SHA_DMACallback(dma_handle_t *handle, void *param, bool transferDone, uint32_t intmode)
+{
+    assert(NULL != param);
+
+    hashcrypt_dma_handle_t *hashHandle = (hashcrypt_dma_handle_t *)param;
+
+    /* Avoid warning for unused parameters. */
+    handle  = handle;
+    intmode = intmode;
+
+    if (transferDone)
+    {
+        if (0U != hashHandle->nextChunkSize)
+        {
+            /* Start the chunk prepared during the transfer, then prepare the one after it. */
+            HASHCRYPT_SHA_StartChunkDMA(hashHandle, hashHandle->nextChunk, hashHandle->nextChunkSize);
+            HASHCRYPT_SHA_PrepareChunkDMA(hashHandle);
+        }
+        else
+        {
+            hashHandle->busy = false;
+            hashcrypt_sha_dma_complete(hashHandle->base, hashHandle->ctx, kStatus_Success);
+        }
+    }
+    else
+    {
+        /* The DMA transfer failed, give INDATA back to the CPU and report the error. */
+        hashHandle->busy = false;
+        hashcrypt_sha_dma_complete(hashHandle->base, hashHandle->ctx, kStatus_Fail);
+    }
+}
+
+/*!
+ * brief Initializes the HASHCRYPT handle which is used in DMA transactional functions.
+ *
+ * The DMA handle should be created by DMA_CreateHandle before on the channel of the HASHCRYPT DMA
+ * request, and must not be used for other transfers.
+ *
+ * param base HASHCRYPT peripheral base address.
+ * param handle Pointer to hashcrypt_dma_handle_t structure.
+ * param dmaHandle User requested DMA handle for the input data transfer.
+ */
+void HASHCRYPT_SHA_CreateHandleDMA(HASHCRYPT_Type *base, hashcrypt_dma_handle_t *handle, dma_handle_t *dmaHandle)
+{
+    assert(NULL != handle);
+    assert(NULL != dmaHandle);
+
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->base      = base;
+    handle->dmaHandle = dmaHandle;
+
+    DMA_SetCallback(dmaHandle, HASHCRYPT_SHA_DMACallback, handle);
+}
+
+/*!
+ * brief Add data to current HASH using DMA.
+ *
+ * This function is the non-blocking version of HASHCRYPT_SHA_Update. The full blocks of the input are
+ * written to the HASHCRYPT INDATA register by DMA, in chunks of up to 4 KB when the input is 4 bytes
+ * aligned, or through two buffers of HASHCRYPT_SHA_DMA_BUFFER_SIZE bytes alternately filled by CPU
+ * while the DMA transfers the other one when it is not. The input bytes which do not fill a block are
+ * kept in the context as HASHCRYPT_SHA_Update does. The callback set by HASHCRYPT_SHA_SetCallback for
+ * this context is called from the HASHCRYPT digest interrupt when the last block is processed, then
+ * HASHCRYPT_SHA_Update, HASHCRYPT_SHA_UpdateDMA or HASHCRYPT_SHA_Finish can be called. If the data is
+ * all kept in the context, the callback is called in this function.
+ *
+ * note The input data must stay valid until the callback is called. The HASHCRYPT can't run AES
+ *      while the update is in progress.
+ * note The HASHCRYPT reads 4 bytes aligned input by its own AHB master in HASHCRYPT_SHA_Update and
+ *      HASHCRYPT_SHA_UpdateNonBlocking, this function is for unaligned input and for input streamed in
+ *      several updates.
+ *
+ * param base HASHCRYPT peripheral base address.
+ * param handle Pointer to hashcrypt_dma_handle_t structure.
+ * param ctx HASH context, initialized by HASHCRYPT_SHA_Init.
+ * param input Input data.
+ * param inputSize Size of input data in bytes.
+ * retval kStatus_Success The update is started.
+ * retval kStatus_DMA_Busy The previous update is not done.
+ * retval kStatus_InvalidArgument The context is not valid.
+ */
+status_t HASHCRYPT_SHA_UpdateDMA(HASHCRYPT_Type *base,
+                                 hashcrypt_dma_handle_t *handle,
+                                 hashcrypt_hash_ctx_t *ctx,
+                                 const uint8_t *input,
+                                 size_t inputSize)
+{
+    assert(NULL != handle);
+    assert((NULL != input) || (0U == inputSize));
+
+    const uint8_t *chunk;
+    size_t chunkSize;
+    status_t status;
+
+    if (handle->busy)
+    {
+        return kStatus_DMA_Busy;
+    }
+
+    /* The buffered and the tail bytes are handled by CPU, the full blocks left are for the DMA. */
+    status = hashcrypt_sha_dma_prepare(base, ctx, &input, &inputSize);
+    if (kStatus_Success != status)
+    {
+        return status;
+    }
+
+    if (0U == inputSize)
+    {
+        hashcrypt_sha_dma_complete(base, ctx, kStatus_Success);
+        return kStatus_Success;
+    }
+
+    handle->busy        = true;
+    handle->ctx         = ctx;
+    handle->data        = input;
+    handle->dataSize    = inputSize;
+    handle->bufferIndex = 0U;
+
+    /* Prepare the second chunk before the first is started, then the callback always has one ready. */
+    HASHCRYPT_SHA_PrepareChunkDMA(handle);
+    chunk     = handle->nextChunk;
+    chunkSize = handle->nextChunkSize;
+    HASHCRYPT_SHA_PrepareChunkDMA(handle);
+    HASHCRYPT_SHA_StartChunkDMA(handle, chunk, chunkSize);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Aborts the HASH update using DMA.
+ *
+ * The hash context is not valid after abort, it should be initialized again by HASHCRYPT_SHA_Init.
+ *
+ * param base HASHCRYPT peripheral base address.
+ * param handle Pointer to hashcrypt_dma_handle_t structure.
+ */
+void HASHCRYPT_SHA_AbortDMA(HASHCRYPT_Type *base, hashcrypt_dma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    DMA_AbortTransfer(handle->dmaHandle);
+    base->INTENCLR = HASHCRYPT_INTENCLR_DIGEST_MASK | HASHCRYPT_INTENCLR_ERROR_MASK;
+    base->CTRL &= ~HASHCRYPT_CTRL_DMA_I_MASK;
+
+    handle->busy = false;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_HASHCRYPT_DMA_H_
+#define _FSL_HASHCRYPT_DMA_H_
+
+#include "fsl_hashcrypt.h"
+#include "fsl_dma.h"
+
+/*!
+ * @addtogroup hashcrypt_dma
+ * @{
+ */
+
+/*! @file */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @name Driver version */
+/*@{*/
+/*! @brief HASHCRYPT DMA driver version. Version 2.0.0. */
+#define FSL_HASHCRYPT_DMA_DRIVER_VERSION (MAKE_VERSION(2, 0, 0))
+/*@}*/
+
+#ifndef HASHCRYPT_SHA_DMA_BUFFER_SIZE
+/*! @brief Size in bytes of each of the two buffers the input is copied to when it is not 4 bytes aligned.
+ *  It must be a multiple of the 64 bytes SHA block. */
+#define HASHCRYPT_SHA_DMA_BUFFER_SIZE 512U
+#endif
+
+/* Forward declaration of the handle typedef. */
+typedef struct _hashcrypt_dma_handle hashcrypt_dma_handle_t;
+
+/*!
+ * @brief HASHCRYPT DMA handle
+ */
+struct _hashcrypt_dma_handle
+{
+    HASHCRYPT_Type *base;                                   /*!< HASHCRYPT peripheral base address. */
+    dma_handle_t *dmaHandle;                                /*!< The DMA channel used. */
+    hashcrypt_hash_ctx_t *ctx;                              /*!< Hash context of the running update. */
+    const uint8_t *data;                                    /*!< Input data not yet passed to the DMA. */
+    size_t dataSize;                                        /*!< Size of the input data not yet passed. */
+    uint32_t buffer[2][HASHCRYPT_SHA_DMA_BUFFER_SIZE / 4U]; /*!< Aligned copies of unaligned input. */
+    const uint8_t *nextChunk;                               /*!< Chunk started when the DMA transfer is done. */
+    size_t nextChunkSize;                                   /*!< Size of the next chunk. */
+    uint8_t bufferIndex;                                    /*!< Buffer the next unaligned chunk is copied to. */
+    volatile bool busy;                                     /*!< True while the update is in progress. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name DMA transactional
+ * @{
+ */
+
+/*!
+ * @brief Initializes the HASHCRYPT handle which is used in DMA transactional functions.
+ *
+ * The DMA handle should be created by DMA_CreateHandle before on the channel of the HASHCRYPT DMA
+ * request, and must not be used for other transfers.
+ *
+ * @param base HASHCRYPT peripheral base address.
+ * @param handle Pointer to hashcrypt_dma_handle_t structure.
+ * @param dmaHandle User requested DMA handle for the input data transfer.
+ */
+void HASHCRYPT_SHA_CreateHandleDMA(HASHCRYPT_Type *base, hashcrypt_dma_handle_t *handle, dma_handle_t *dmaHandle);
+
+/*!
+ * @brief Add data to current HASH using DMA.
+ *
+ * This function is the non-blocking version of HASHCRYPT_SHA_Update. The full blocks of the input are
+ * written to the HASHCRYPT INDATA register by DMA, in chunks of up to 4 KB when the input is 4 bytes
+ * aligned, or through two buffers of HASHCRYPT_SHA_DMA_BUFFER_SIZE bytes alternately filled by CPU
+ * while the DMA transfers the other one when it is not. The input bytes which do not fill a block are
+ * kept in the context as HASHCRYPT_SHA_Update does. The callback set by HASHCRYPT_SHA_SetCallback for
+ * this context is called from the HASHCRYPT digest interrupt when the last block is processed, then
+ * HASHCRYPT_SHA_Update, HASHCRYPT_SHA_UpdateDMA or HASHCRYPT_SHA_Finish can be called. If the data is
+ * all kept in the context, the callback is called in this function.
+ *
+ * @note The input data must stay valid until the callback is called. The HASHCRYPT can't run AES
+ *       while the update is in progress.
+ * @note The HASHCRYPT reads 4 bytes aligned input by its own AHB master in HASHCRYPT_SHA_Update and
+ *       HASHCRYPT_SHA_UpdateNonBlocking, this function is for unaligned input and for input streamed in
+ *       several updates.
+ *
+ * @param base HASHCRYPT peripheral base address.
+ * @param handle Pointer to hashcrypt_dma_handle_t structure.
+ * @param ctx HASH context, initialized by HASHCRYPT_SHA_Init.
+ * @param input Input data.
+ * @param inputSize Size of input data in bytes.
+ * @retval kStatus_Success The update is started.
+ * @retval kStatus_DMA_Busy The previous update is not done.
+ * @retval kStatus_InvalidArgument The context is not valid.
+ */
+status_t HASHCRYPT_SHA_UpdateDMA(HASHCRYPT_Type *base,
+                                 hashcrypt_dma_handle_t *handle,
+                                 hashcrypt_hash_ctx_t *ctx,
+                                 const uint8_t *input,
+                                 size_t inputSize);
+
+/*!
+ * @brief Aborts the HASH update using DMA.
+ *
+ * The hash context is not valid after abort, it should be initialized again by HASHCRYPT_SHA_Init.
+ *
+ * @param base HASHCRYPT peripheral base address.
+ * @param handle Pointer to hashcrypt_dma_handle_t structure.
+ */
+void HASHCRYPT_SHA_AbortDMA(HASHCRYPT_Type *base, hashcrypt_dma_handle_t *handle);
+
+/*@}*/
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_HASHCRYPT_DMA_H_ */
@@ -30,7 +30,7 @@
 
 /*! @name Driver version */
 /*@{*/
-#define FSL_POWERQUAD_DRIVER_VERSION (MAKE_VERSION(2, 0, 1)) /*!< Version 2.0.1. */
+#define FSL_POWERQUAD_DRIVER_VERSION (MAKE_VERSION(2, 0, 3)) /*!< Version 2.0.3. */
 /*@}*/
 
 #define PQ_FLOAT32 0U
@@ -102,6 +102,10 @@
 #define PQ_FIR_CORRELATION 2U
 #define PQ_FIR_INCREMENTAL 4U
 
+/*! @brief PowerQuad private RAM, only the PowerQuad engines can access it. */
+#define PQ_PRIVATE_RAM_BASE 0xE0000000U
+#define PQ_PRIVATE_RAM_SIZE 0x4000U
+
 #define _pq_ln0(x) __arm_mcr(CP_PQ, PQ_LN, x, PQ_FLOAT32 | PQ_COMP0_ONLY, 0, PQ_TRANS)
 #define _pq_inv0(x) __arm_mcr(CP_PQ, PQ_INV, x, PQ_FLOAT32 | PQ_COMP0_ONLY, 0, PQ_TRANS)
 #define _pq_sqrt0(x) __arm_mcr(CP_PQ, PQ_SQRT, x, PQ_FLOAT32 | PQ_COMP0_ONLY, 0, PQ_TRANS)
@@ -1665,6 +1669,76 @@ typedef union _pq_float
     uint32_t integerX; /*!< Iterger type.*/
 } pq_float_t;
 
+/* Forward declaration of the job typedef. */
+typedef struct _pq_job pq_job_t;
+
+/*! @brief PowerQuad job callback, called from PQ_JobQueueIRQHandler when the job is done. */
+typedef void (*pq_job_callback_t)(POWERQUAD_Type *base, pq_job_t *job, void *userData);
+
+/*!
+ * @brief PowerQuad job, one matrix, transform or FIR engine operation run by the job queue.
+ *
+ * The register values are the ones written by the blocking functions, for example the control of
+ * PQ_MatrixMultiplication is (CP_MTX << 4) | PQ_MTX_MULT.
+ */
+struct _pq_job
+{
+    uint32_t control;           /*!< CONTROL register, machine and operation. */
+    uint32_t length;            /*!< LENGTH register. */
+    uint32_t misc;              /*!< MISC register, the scale of PQ_MTX_SCALE or the offset of PQ_FIR_INCREMENTAL. */
+    void *pAData;               /*!< Input A. */
+    void *pBData;               /*!< Input B, NULL if not used. */
+    void *pTmpData;             /*!< Temporary region, NULL to keep the current one. */
+    void *pResult;              /*!< Output, NULL if not used. */
+    const pq_config_t *config;  /*!< Formats of the job, NULL to keep the current ones. */
+    pq_job_callback_t callback; /*!< Callback function, can be NULL. */
+    void *userData;             /*!< Callback function parameter. */
+    uint32_t errorStatus;       /*!< ERRSTAT of the job, set by the queue. */
+    uint32_t startCycle;        /*!< DWT cycle count at the start of the job, set by the queue. */
+    uint32_t cycles;            /*!< Cycles from the start to the completion interrupt, set by the queue. */
+    pq_job_t *next;             /*!< Next job in the queue. */
+};
+
+/*! @brief PowerQuad job queue, the jobs run in submission order. */
+typedef struct _pq_job_queue
+{
+    pq_job_t *volatile head; /*!< Job running on the PowerQuad. */
+    pq_job_t *tail;          /*!< Last job submitted. */
+    uint32_t jobCount;       /*!< Number of jobs done. */
+    uint64_t totalCycles;    /*!< Sum of the cycles of the jobs done. */
+    uint32_t maxCycles;      /*!< Maximum cycles of a job. */
+} pq_job_queue_t;
+
+/*!
+ * @brief Buffer placed in the PowerQuad private RAM by PQ_PlanPrivateRam.
+ *
+ * The operations of a processing graph are numbered in the order they run. A buffer is live from
+ * the first operation using it to the last one, buffers which are not live at the same time can
+ * share the memory.
+ */
+typedef struct _pq_ram_buffer
+{
+    uint32_t size;    /*!< Size in bytes. */
+    uint16_t firstOp; /*!< Index of the first operation using the buffer. */
+    uint16_t lastOp;  /*!< Index of the last operation using the buffer. */
+    void *address;    /*!< Address in the private RAM, set by PQ_PlanPrivateRam. */
+} pq_ram_buffer_t;
+
+/*!
+ * @brief PowerQuad stream, the FIR or FFT input window kept in the private RAM.
+ *
+ * The window holds the history samples of the previous blocks followed by the new block, so the
+ * engine reads the whole window in place without copying the history by CPU.
+ */
+typedef struct _pq_stream
+{
+    void *pWindow;          /*!< Window in the private RAM, historyLength + blockSize samples. */
+    void *pTaps;            /*!< FIR taps in the private RAM, NULL for the FFT stream. */
+    uint32_t tapLength;     /*!< Number of FIR taps, 0 for the FFT stream. */
+    uint32_t historyLength; /*!< Samples kept from the previous blocks. */
+    uint32_t blockSize;     /*!< New samples of each block. */
+} pq_stream_t;
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -2716,6 +2790,167 @@ void PQ_MatrixTranspose(POWERQUAD_Type *base, uint32_t length, void *pData, void
  */
 void PQ_MatrixScale(POWERQUAD_Type *base, uint32_t length, float misc, void *pData, void *pResult);
 
+/*!
+ * @brief Initializes the PowerQuad job queue.
+ *
+ * The queue runs the submitted jobs one after another, each job is started from the PowerQuad
+ * completion interrupt of the previous one, so the CPU does not wait for the jobs. The jobs are run
+ * in submission order, a job can use the output of the jobs submitted before it.
+ * PQ_JobQueueIRQHandler must be called from the PowerQuad interrupt handler. The blocking engine
+ * functions and the coprocessor functions must not be used while the queue is busy. The DWT cycle
+ * counter is enabled for the timing statistics.
+ *
+ * @param base  POWERQUAD peripheral base address
+ * @param queue Job queue.
+ */
+void PQ_CreateJobQueue(POWERQUAD_Type *base, pq_job_queue_t *queue);
+
+/*!
+ * @brief Submits a job to the PowerQuad job queue.
+ *
+ * The job is started at once if the queue is idle. The job structure and its buffers must stay
+ * valid until its callback is called.
+ *
+ * @param base  POWERQUAD peripheral base address
+ * @param queue Job queue.
+ * @param job Job to run.
+ */
+void PQ_SubmitJob(POWERQUAD_Type *base, pq_job_queue_t *queue, pq_job_t *job);
+
+/*!
+ * @brief Checks if the PowerQuad job queue is idle.
+ *
+ * @param queue Job queue.
+ * @return true if all submitted jobs are done.
+ */
+static inline bool PQ_IsJobQueueIdle(pq_job_queue_t *queue)
+{
+    return (NULL == queue->head);
+}
+
+/*!
+ * @brief PowerQuad job queue interrupt handler.
+ *
+ * Completes the running job, starts the next one and calls the callback of the completed job.
+ *
+ * @param base  POWERQUAD peripheral base address
+ * @param queue Job queue.
+ */
+void PQ_JobQueueIRQHandler(POWERQUAD_Type *base, pq_job_queue_t *queue);
+
+/*!
+ * @brief Places buffers of a processing graph in the PowerQuad private RAM.
+ *
+ * The largest buffers are placed first, each one at the lowest offset which does not overlap the
+ * buffers live at the same time. An operation can write its output to the buffer read by the next
+ * operation, so consecutive operations chain in the private RAM without copies. The sizes are
+ * rounded up to 4 bytes. The region must not overlap the TMPBASE region used by the engines.
+ *
+ * @param buffers Buffers to place, the address members are set by this function.
+ * @param bufferNum Number of buffers.
+ * @param ramBase Start of the region in the private RAM, 4 bytes aligned.
+ * @param ramSize Size of the region in bytes.
+ * @retval kStatus_Success All buffers are placed.
+ * @retval kStatus_OutOfRange The buffers do not fit in the region.
+ */
+status_t PQ_PlanPrivateRam(pq_ram_buffer_t *buffers, uint32_t bufferNum, void *ramBase, uint32_t ramSize);
+
+/*!
+ * @brief Copies data by the PowerQuad matrix engine.
+ *
+ * The private RAM can only be accessed by the PowerQuad, this function moves the data between the
+ * system RAM and the private RAM, or inside the private RAM, by scaling with 1.0 in the float
+ * machine format. The samples are read and written in the external format of the current
+ * INAFORMAT, float or 32-bit fixed point, the prescalers are not applied and the formats are
+ * restored afterwards. The copy is not bit exact: float NaN payloads and denormals may change, and
+ * 32-bit fixed point samples keep only the 24 most significant bits of the float mantissa. The
+ * function returns when the copy is done.
+ *
+ * @param base  POWERQUAD peripheral base address
+ * @param pSrc Source, 32-bit samples.
+ * @param pDst Destination, 32-bit samples.
+ * @param length Number of samples.
+ */
+void PQ_EngineCopy(POWERQUAD_Type *base, void *pSrc, void *pDst, uint32_t length);
+
+/*!
+ * @brief Initializes the streaming FIR filter.
+ *
+ * The taps and the input window of tapLength - 1 + blockSize samples are placed in the private
+ * RAM region, the taps are copied there and the history is cleared. Each block is then filtered by
+ * overlap-save, the engine reads the tapLength - 1 history samples in front of the new block, so
+ * only the outputs of the new block are computed. The samples are 32-bit, float or fixed point as
+ * set by PQ_SetFormat, the format must be set before this function.
+ *
+ * @param base  POWERQUAD peripheral base address
+ * @param stream Stream handle.
+ * @param pTaps FIR taps in positive order, 32-bit samples.
+ * @param tapLength Number of taps.
+ * @param blockSize Samples in each block.
+ * @param ramBase Start of the region in the private RAM for the stream.
+ * @param ramSize Size of the region in bytes.
+ * @retval kStatus_Success The stream is initialized.
+ * @retval kStatus_OutOfRange The taps and the window do not fit in the region.
+ */
+status_t PQ_FIRStreamInit(POWERQUAD_Type *base,
+                          pq_stream_t *stream,
+                          void *pTaps,
+                          uint32_t tapLength,
+                          uint32_t blockSize,
+                          void *ramBase,
+                          uint32_t ramSize);
+
+/*!
+ * @brief Filters one block of the FIR stream.
+ *
+ * The history is moved to the front of the window in chunks of at most blockSize samples, so the
+ * moves do not overlap for any tapLength, and the block is copied behind it by the engine. Then the
+ * FIR engine writes the blockSize outputs to pDst directly. The samples are moved by
+ * PQ_EngineCopy and have its precision. The function returns when the outputs are written.
+ *
+ * @param base  POWERQUAD peripheral base address
+ * @param stream Stream handle.
+ * @param pSrc Input block, blockSize samples.
+ * @param pDst Output block, blockSize samples.
+ */
+void PQ_FIRStreamProcess(POWERQUAD_Type *base, pq_stream_t *stream, void *pSrc, void *pDst);
+
+/*!
+ * @brief Initializes the streaming real FFT.
+ *
+ * The input window of fftLength samples is placed in the private RAM region and cleared. Each
+ * call to PQ_FFTStreamProcess adds hopSize new samples and transforms the last fftLength samples,
+ * the windows of the consecutive frames overlap by fftLength - hopSize samples. The FFT formats
+ * must be set before this function, the window must not overlap the TMPBASE region.
+ *
+ * @param base  POWERQUAD peripheral base address
+ * @param stream Stream handle.
+ * @param fftLength FFT length.
+ * @param hopSize New samples of each frame, not more than fftLength.
+ * @param ramBase Start of the region in the private RAM for the stream.
+ * @param ramSize Size of the region in bytes.
+ * @retval kStatus_Success The stream is initialized.
+ * @retval kStatus_OutOfRange The window does not fit in the region.
+ */
+status_t PQ_FFTStreamInit(
+    POWERQUAD_Type *base, pq_stream_t *stream, uint32_t fftLength, uint32_t hopSize, void *ramBase, uint32_t ramSize);
+
+/*!
+ * @brief Transforms one frame of the FFT stream.
+ *
+ * The history is moved down in chunks of at most hopSize samples, so any overlap of the frames is
+ * supported, and the hopSize samples are added to the window by PQ_EngineCopy, with its precision.
+ * Then the real FFT reads the window in place and writes the fftLength complex outputs to pResult.
+ * pResult can be a planned buffer in the private RAM, so that the next engine operation reads the
+ * spectrum in place. The function returns when the FFT is done.
+ *
+ * @param base  POWERQUAD peripheral base address
+ * @param stream Stream handle.
+ * @param pSrc New samples, hopSize samples.
+ * @param pResult FFT output, fftLength complex samples.
+ */
+void PQ_FFTStreamProcess(POWERQUAD_Type *base, pq_stream_t *stream, void *pSrc, void *pResult);
+
 /* @} */
 
 #if defined(__cplusplus)
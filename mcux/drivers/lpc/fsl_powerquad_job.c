@@ -0,0 +1,149 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_powerquad.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.powerquad_job"
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void PQ_StartJob(POWERQUAD_Type *base, pq_job_t *job)
+{
+    if (NULL != job->config)
+    {
+        PQ_SetConfig(base, job->config);
+    }
+
+    if (((CP_FFT << 4) | PQ_TRANS_RFFT) == job->control || ((CP_FFT << 4) | PQ_TRANS_RDCT) == job->control)
+    {
+        /* Set 0's for imaginary inputs as not be reading them in by the machine */
+        base->GPREG[1]  = 0;
+        base->GPREG[3]  = 0;
+        base->GPREG[5]  = 0;
+        base->GPREG[7]  = 0;
+        base->GPREG[9]  = 0;
+        base->GPREG[11] = 0;
+        base->GPREG[13] = 0;
+        base->GPREG[15] = 0;
+    }
+    else if (((CP_MTX << 4) | PQ_MTX_INV) == job->control)
+    {
+        /* Workaround:
+         *
+         * Matrix inv depends on the coproc 1/x function, this puts coproc to right state.
+         */
+        _pq_inv0(1.0);
+    }
+    else
+    {
+    }
+
+    if (NULL != job->pTmpData)
+    {
+        base->TMPBASE = (uint32_t)job->pTmpData;
+    }
+    base->OUTBASE = (uint32_t)job->pResult;
+    base->INABASE = (uint32_t)job->pAData;
+    base->INBBASE = (uint32_t)job->pBData;
+    base->LENGTH  = job->length;
+    base->MISC    = job->misc;
+
+    job->startCycle = DWT->CYCCNT;
+    base->CONTROL   = job->control;
+}
+
+void PQ_CreateJobQueue(POWERQUAD_Type *base, pq_job_queue_t *queue)
+{
+    assert(queue);
+
+    memset(queue, 0, sizeof(*queue));
+
+    /* Cycle counter for the job timing. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    base->INTRSTAT = POWERQUAD_INTRSTAT_INTR_STAT_MASK;
+    base->INTREN |= POWERQUAD_INTREN_INTR_COMP_MASK;
+}
+
+void PQ_SubmitJob(POWERQUAD_Type *base, pq_job_queue_t *queue, pq_job_t *job)
+{
+    assert(queue);
+    assert(job);
+
+    uint32_t primask;
+
+    job->next        = NULL;
+    job->errorStatus = 0;
+    job->cycles      = 0;
+
+    /* The interrupt handler removes the done job from the head. */
+    primask = DisableGlobalIRQ();
+    if (NULL == queue->head)
+    {
+        queue->head = job;
+        queue->tail = job;
+        PQ_StartJob(base, job);
+    }
+    else
+    {
+        queue->tail->next = job;
+        queue->tail       = job;
+    }
+    EnableGlobalIRQ(primask);
+}
+
+void PQ_JobQueueIRQHandler(POWERQUAD_Type *base, pq_job_queue_t *queue)
+{
+    assert(queue);
+
+    pq_job_t *job = queue->head;
+    uint32_t cycles;
+
+    base->INTRSTAT = POWERQUAD_INTRSTAT_INTR_STAT_MASK;
+
+    if ((NULL == job) || (0U != (base->CONTROL & INST_BUSY)))
+    {
+        return;
+    }
+
+    cycles           = DWT->CYCCNT - job->startCycle;
+    job->cycles      = cycles;
+    job->errorStatus = base->ERRSTAT;
+    base->ERRSTAT    = 0;
+
+    queue->jobCount++;
+    queue->totalCycles += cycles;
+    if (cycles > queue->maxCycles)
+    {
+        queue->maxCycles = cycles;
+    }
+
+    /* Keep the PowerQuad busy, start the next job before the callback. */
+    queue->head = job->next;
+    if (NULL != queue->head)
+    {
+        PQ_StartJob(base, queue->head);
+    }
+    else
+    {
+        queue->tail = NULL;
+    }
+
+    if (NULL != job->callback)
+    {
+        job->callback(base, job, job->userData);
+    }
+}
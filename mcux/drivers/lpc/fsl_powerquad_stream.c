@@ -0,0 +1,293 @@
+/*
+ * Copyright 2019 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_powerquad.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.powerquad_stream"
+#endif
+
+/* Matrix engine supports 16x16 at the most. */
+#define PQ_MATRIX_MAX_DIM 16U
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void PQ_EngineScale(POWERQUAD_Type *base, uint32_t *pSrc, uint32_t *pDst, uint32_t length, float scale)
+{
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t inAFormat = base->INAFORMAT;
+    uint32_t outFormat = base->OUTFORMAT;
+    uint32_t sampleFormat;
+
+    /*
+     * The samples keep the external format set by the caller, float or 32-bit fixed point. The
+     * prescalers are cleared and the matrix engine runs in float, the FFT machine format q31 is
+     * not supported by it. The caller's formats are restored afterwards.
+     */
+    if (((inAFormat & POWERQUAD_INAFORMAT_INA_FORMATEXT_MASK) >> POWERQUAD_INAFORMAT_INA_FORMATEXT_SHIFT) ==
+        (uint32_t)kPQ_Float)
+    {
+        sampleFormat = (uint32_t)kPQ_Float;
+    }
+    else
+    {
+        sampleFormat = (uint32_t)kPQ_32Bit;
+    }
+    base->INAFORMAT = POWERQUAD_INAFORMAT_INA_FORMATEXT(sampleFormat) | POWERQUAD_INAFORMAT_INA_FORMATINT(kPQ_Float);
+    base->OUTFORMAT = POWERQUAD_OUTFORMAT_OUT_FORMATEXT(sampleFormat) | POWERQUAD_OUTFORMAT_OUT_FORMATINT(kPQ_Float);
+
+    while (length > 0U)
+    {
+        if (length >= PQ_MATRIX_MAX_DIM)
+        {
+            cols = PQ_MATRIX_MAX_DIM;
+            rows = MIN(length / PQ_MATRIX_MAX_DIM, PQ_MATRIX_MAX_DIM);
+        }
+        else
+        {
+            cols = length;
+            rows = 1U;
+        }
+
+        PQ_MatrixScale(base, POWERQUAD_MAKE_MATRIX_LEN(rows, cols, cols), scale, pSrc, pDst);
+        PQ_WaitDone(base);
+
+        pSrc += rows * cols;
+        pDst += rows * cols;
+        length -= rows * cols;
+    }
+
+    base->INAFORMAT = inAFormat;
+    base->OUTFORMAT = outFormat;
+}
+
+static void PQ_EngineClear(POWERQUAD_Type *base, uint32_t *pDst, uint32_t length)
+{
+    /* Scale a known zero source, the private RAM content may not be a number and 0 * NaN is NaN. */
+    static uint32_t s_pqZero[PQ_MATRIX_MAX_DIM];
+    uint32_t count;
+
+    while (length > 0U)
+    {
+        count = MIN(length, PQ_MATRIX_MAX_DIM);
+        PQ_EngineScale(base, s_pqZero, pDst, count, 0.0f);
+        pDst += count;
+        length -= count;
+    }
+}
+
+/* Moves the window samples from pWindow[shift] down to pWindow[0] in chunks that do not overlap. */
+static void PQ_EngineShiftDown(POWERQUAD_Type *base, uint32_t *pWindow, uint32_t shift, uint32_t length)
+{
+    uint32_t count;
+
+    while (length > 0U)
+    {
+        count = MIN(length, shift);
+        PQ_EngineScale(base, &pWindow[shift], pWindow, count, 1.0f);
+        pWindow += count;
+        length -= count;
+    }
+}
+
+static bool PQ_IsBufferLiveTogether(const pq_ram_buffer_t *a, const pq_ram_buffer_t *b)
+{
+    return ((a->firstOp <= b->lastOp) && (b->firstOp <= a->lastOp));
+}
+
+status_t PQ_PlanPrivateRam(pq_ram_buffer_t *buffers, uint32_t bufferNum, void *ramBase, uint32_t ramSize)
+{
+    assert(buffers);
+    assert(((uint32_t)ramBase & 3U) == 0U);
+
+    uint32_t i;
+    uint32_t n;
+    uint32_t cur;
+    uint32_t size;
+    uint32_t offset;
+    uint32_t placedOffset;
+    uint32_t placedSize;
+    bool moved;
+
+    for (i = 0U; i < bufferNum; i++)
+    {
+        buffers[i].address = NULL;
+    }
+
+    for (n = 0U; n < bufferNum; n++)
+    {
+        /* The largest buffer not placed yet has the least choice, place it first. */
+        cur = bufferNum;
+        for (i = 0U; i < bufferNum; i++)
+        {
+            if ((NULL == buffers[i].address) && ((cur == bufferNum) || (buffers[i].size > buffers[cur].size)))
+            {
+                cur = i;
+            }
+        }
+
+        size = (buffers[cur].size + 3U) & ~3U;
+
+        /* Move up past the placed buffers live at the same time, till no one overlaps. */
+        offset = 0U;
+        do
+        {
+            moved = false;
+            for (i = 0U; i < bufferNum; i++)
+            {
+                if ((NULL == buffers[i].address) || (!PQ_IsBufferLiveTogether(&buffers[i], &buffers[cur])))
+                {
+                    continue;
+                }
+
+                placedOffset = (uint32_t)buffers[i].address - (uint32_t)ramBase;
+                placedSize   = (buffers[i].size + 3U) & ~3U;
+                if ((offset < (placedOffset + placedSize)) && (placedOffset < (offset + size)))
+                {
+                    offset = placedOffset + placedSize;
+                    moved  = true;
+                }
+            }
+        } while (moved);
+
+        if ((offset + size) > ramSize)
+        {
+            return kStatus_OutOfRange;
+        }
+
+        buffers[cur].address = (void *)((uint32_t)ramBase + offset);
+    }
+
+    return kStatus_Success;
+}
+
+void PQ_EngineCopy(POWERQUAD_Type *base, void *pSrc, void *pDst, uint32_t length)
+{
+    assert(pSrc);
+    assert(pDst);
+
+    PQ_EngineScale(base, (uint32_t *)pSrc, (uint32_t *)pDst, length, 1.0f);
+}
+
+status_t PQ_FIRStreamInit(POWERQUAD_Type *base,
+                          pq_stream_t *stream,
+                          void *pTaps,
+                          uint32_t tapLength,
+                          uint32_t blockSize,
+                          void *ramBase,
+                          uint32_t ramSize)
+{
+    assert(stream);
+    assert(pTaps);
+    assert(tapLength > 0U);
+    assert(blockSize > 0U);
+
+    pq_ram_buffer_t buffers[2];
+    status_t status;
+
+    (void)memset(buffers, 0, sizeof(buffers));
+    buffers[0].size = tapLength * sizeof(uint32_t);
+    buffers[1].size = (tapLength - 1U + blockSize) * sizeof(uint32_t);
+
+    status = PQ_PlanPrivateRam(buffers, 2U, ramBase, ramSize);
+    if (kStatus_Success != status)
+    {
+        return status;
+    }
+
+    stream->pTaps         = buffers[0].address;
+    stream->pWindow       = buffers[1].address;
+    stream->tapLength     = tapLength;
+    stream->historyLength = tapLength - 1U;
+    stream->blockSize     = blockSize;
+
+    PQ_EngineCopy(base, pTaps, stream->pTaps, tapLength);
+
+    PQ_EngineClear(base, (uint32_t *)stream->pWindow, stream->historyLength);
+
+    return kStatus_Success;
+}
+
+void PQ_FIRStreamProcess(POWERQUAD_Type *base, pq_stream_t *stream, void *pSrc, void *pDst)
+{
+    assert(stream);
+    assert(pSrc);
+    assert(pDst);
+
+    uint32_t *pWindow = (uint32_t *)stream->pWindow;
+
+    PQ_EngineShiftDown(base, pWindow, stream->blockSize, stream->historyLength);
+    PQ_EngineCopy(base, pSrc, &pWindow[stream->historyLength], stream->blockSize);
+
+    /*
+     * Incremental FIR from the first new sample, the same as arm_fir_f32 does: the A length is the
+     * number of new samples and MISC is their offset from the input base. The outputs in front of
+     * the offset are not computed and not written, so the output base is moved back by the offset.
+     */
+    base->INABASE = (uint32_t)pWindow;
+    base->INBBASE = (uint32_t)stream->pTaps;
+    base->LENGTH  = (stream->tapLength << 16U) | stream->blockSize;
+    base->OUTBASE = (uint32_t)pDst - (stream->historyLength * sizeof(uint32_t));
+    base->MISC    = stream->historyLength;
+    base->CONTROL = (CP_FIR << 4U) | PQ_FIR_INCREMENTAL;
+
+    PQ_WaitDone(base);
+}
+
+status_t PQ_FFTStreamInit(
+    POWERQUAD_Type *base, pq_stream_t *stream, uint32_t fftLength, uint32_t hopSize, void *ramBase, uint32_t ramSize)
+{
+    assert(stream);
+    assert((hopSize > 0U) && (hopSize <= fftLength));
+
+    pq_ram_buffer_t buffer;
+    status_t status;
+
+    (void)memset(&buffer, 0, sizeof(buffer));
+    buffer.size = fftLength * sizeof(uint32_t);
+
+    status = PQ_PlanPrivateRam(&buffer, 1U, ramBase, ramSize);
+    if (kStatus_Success != status)
+    {
+        return status;
+    }
+
+    stream->pTaps         = NULL;
+    stream->pWindow       = buffer.address;
+    stream->tapLength     = 0U;
+    stream->historyLength = fftLength - hopSize;
+    stream->blockSize     = hopSize;
+
+    PQ_EngineClear(base, (uint32_t *)stream->pWindow, fftLength);
+
+    return kStatus_Success;
+}
+
+void PQ_FFTStreamProcess(POWERQUAD_Type *base, pq_stream_t *stream, void *pSrc, void *pResult)
+{
+    assert(stream);
+    assert(pSrc);
+    assert(pResult);
+
+    uint32_t *pWindow = (uint32_t *)stream->pWindow;
+
+    if (stream->historyLength > 0U)
+    {
+        PQ_EngineShiftDown(base, pWindow, stream->blockSize, stream->historyLength);
+    }
+    PQ_EngineCopy(base, pSrc, &pWindow[stream->historyLength], stream->blockSize);
+
+    PQ_TransformRFFT(base, stream->historyLength + stream->blockSize, pWindow, pResult);
+    PQ_WaitDone(base);
+}